@@ -0,0 +1,156 @@
+#pragma once
+
+//! Include the STL objects used to time and report the benchmarks
+#include <chrono>
+#include <vector>
+#include <string>
+#include <stdio.h>
+
+namespace Benchmarks {
+	/*
+	 *		Name: BenchmarkResult
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Store the timing of a single measured benchmark
+	**/
+	struct BenchmarkResult {
+		//! The name of the benchmark
+		std::string name;
+
+		//! The number of operations that were timed
+		size_t operations = 0;
+
+		//! The total time spent performing the operations (in milliseconds)
+		double milliseconds = 0.0;
+
+		/*
+			BenchmarkResult : nanosecondsPerOp - Get the average time taken by each operation
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return double - Returns the average time in nanoseconds
+		*/
+		inline double nanosecondsPerOp() const { return (operations ? milliseconds * 1000000.0 / operations : 0.0); }
+	};
+
+	/*
+	 *		Name: BenchmarkSettings
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Store the values shared by every benchmark suite
+	**/
+	struct BenchmarkSettings {
+		//! The minimum time each benchmark is run for (in milliseconds)
+		double minMilliseconds = 250.0;
+
+		//! The path of a TrueType font used by the text benchmarks (Text benchmarks are skipped when nullptr)
+		const char* fontPath = nullptr;
+	};
+
+	/*
+		doNotOptimise - Prevent the compiler from removing the calculation of a value
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		Template T - The type of the value to keep
+
+		param[in] pValue - The value that must be calculated
+	*/
+	template<typename T>
+	inline void doNotOptimise(const T& pValue) {
+		//Read the value through a volatile pointer
+		const volatile char* sink = (const volatile char*)&pValue;
+		(void)*sink;
+	}
+
+	/*
+		runBenchmark - Time a function, repeating it until the minimum run time has been reached
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		Template TFunc - A callable object taking a size_t count of operations to perform
+
+		param[in] pName - The name to report the benchmark with
+		param[in] pSettings - The settings to run the benchmark with
+		param[in] pFunc - The function to time, which performs the requested number of operations
+
+		return BenchmarkResult - Returns the timing of the benchmark
+
+		NOTE:
+		The batch size doubles until a batch takes at least a tenth of the minimum run time, so that
+		the clock overhead is negligible for short operations
+	*/
+	template<typename TFunc>
+	BenchmarkResult runBenchmark(const char* pName, const BenchmarkSettings& pSettings, TFunc&& pFunc) {
+		typedef std::chrono::steady_clock clock;
+
+		//Warm up the function
+		pFunc((size_t)1);
+
+		//Create the result to fill
+		BenchmarkResult result;
+		result.name = pName;
+
+		//Run batches until the minimum time is spent
+		size_t batch = 1;
+		while (result.milliseconds < pSettings.minMilliseconds) {
+			//Time the batch
+			const auto START = clock::now();
+			pFunc(batch);
+			const double ELAPSED = std::chrono::duration<double, std::milli>(clock::now() - START).count();
+
+			//Accumulate the timing
+			result.operations += batch;
+			result.milliseconds += ELAPSED;
+
+			//Grow short batches
+			if (ELAPSED < pSettings.minMilliseconds * .1) batch *= 2;
+		}
+
+		//Output the result
+		printf("  %-48s %14.1f ns/op %12zu ops\n", pName, result.nanosecondsPerOp(), result.operations);
+		return result;
+	}
+
+	/*
+		printSuite - Output the heading of a benchmark suite
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pName - The name of the suite
+	*/
+	inline void printSuite(const char* pName) { printf("\n%s\n", pName); }
+
+	/*
+	 *		Name: BenchmarkSuite
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Name a function that runs a group of related benchmarks
+	**/
+	struct BenchmarkSuite {
+		//! The name used to select the suite from the command line
+		const char* name;
+
+		//! The function that runs the suite's benchmarks
+		void(*run)(const BenchmarkSettings& pSettings);
+	};
+
+	//! Prototype the benchmark suites
+	void runGlobalsBenchmarks(const BenchmarkSettings& pSettings);
+	void runMapGenerationBenchmarks(const BenchmarkSettings& pSettings);
+	void runRenderingBenchmarks(const BenchmarkSettings& pSettings);
+	void runResourceBenchmarks(const BenchmarkSettings& pSettings);
+	void runUIBenchmarks(const BenchmarkSettings& pSettings);
+}
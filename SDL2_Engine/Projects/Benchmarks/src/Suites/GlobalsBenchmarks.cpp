@@ -0,0 +1,56 @@
+#include "../Benchmark.hpp"
+
+//! Include the SDL2_Engine objects
+#include <Globals.hpp>
+#include <Debug/Logger.hpp>
+#include <Input/InputRecorder.hpp>
+#include <Utilities/TypeID.hpp>
+using namespace SDL2_Engine;
+
+//! Include the STL objects used for the reference lookup
+#include <unordered_map>
+#include <cstdint>
+
+namespace Benchmarks {
+	/*
+		runGlobalsBenchmarks - Time the retrieval of interfaces from the Globals singleton
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+
+		NOTE:
+		The Logger must have been added to the Globals before this is called. The hashed map lookup
+		that Globals used before interfaces were assigned slots is timed for comparison
+	*/
+	void runGlobalsBenchmarks(const BenchmarkSettings& pSettings) {
+		printSuite("Globals");
+
+		//Time the slot lookup of an existing interface
+		runBenchmark("get<Logger>", pSettings, [](const size_t& pCount) {
+			uintptr_t sum = 0;
+			for (size_t i = 0; i < pCount; i++) sum += (uintptr_t)&Globals::get<Debug::Logger>();
+			doNotOptimise(sum);
+		});
+
+		//Time checking for an interface that was not added
+		runBenchmark("interfaceExists<InputRecorder>", pSettings, [](const size_t& pCount) {
+			size_t found = 0;
+			for (size_t i = 0; i < pCount; i++) found += Globals::interfaceExists<Input::InputRecorder>();
+			doNotOptimise(found);
+		});
+
+		//Build the reference map, holding as many entries as a full engine setup
+		std::unordered_map<Utilities::typeID, Utilities::IGlobal*> reference;
+		for (size_t i = 0; i < 16; i++) reference[(Utilities::typeID)i * 2654435761u] = nullptr;
+		reference[Utilities::typeToID<Debug::Logger>()] = &Globals::get<Debug::Logger>();
+
+		//Time the hashed lookup
+		runBenchmark("reference unordered_map lookup", pSettings, [&](const size_t& pCount) {
+			uintptr_t sum = 0;
+			for (size_t i = 0; i < pCount; i++) sum += (uintptr_t)reference.find(Utilities::typeToID<Debug::Logger>())->second;
+			doNotOptimise(sum);
+		});
+	}
+}
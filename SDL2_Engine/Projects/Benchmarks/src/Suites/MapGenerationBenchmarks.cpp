@@ -0,0 +1,370 @@
+#include "../Benchmark.hpp"
+
+//! Include the BombSquad map generation objects
+#include <Game/MapGeneration/MapGenerator.hpp>
+#include <Game/MapGeneration/CellBoard.hpp>
+#include <Game/MapGeneration/RegionIdentifier.hpp>
+#include <Game/MapGeneration/PathFinder.hpp>
+using namespace BombSquad;
+
+//! Include the SDL2_Engine random generator
+#include <Utilities/Random.hpp>
+using namespace SDL2_Engine;
+
+//! Include the queue used by the breadth first searches
+#include <queue>
+
+namespace Benchmarks {
+	/*
+		createRandomMap - Create a map with randomly placed free and restricted tiles
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pWidth - The width of the map to create
+		param[in] pHeight - The height of the map to create
+		param[in] pFreeChance - The 0 - 1 chance of each tile being free
+		param[in] pSeed - The seed used to place the tiles
+
+		return gameMap - Returns the filled map
+	*/
+	gameMap createRandomMap(const size_t& pWidth, const size_t& pHeight, const float& pFreeChance, const uint64_t& pSeed) {
+		//Create the generator and map
+		Utilities::Random rng(pSeed);
+		gameMap map(pWidth, pHeight);
+
+		//Fill the tiles
+		for (size_t x = 0; x < pWidth; x++) {
+			for (size_t y = 0; y < pHeight; y++)
+				map[x][y] = (rng.chance(pFreeChance) ? ETileType::Free : ETileType::Restricted);
+		}
+		return map;
+	}
+
+	/*
+		legacyAnalyseDepth - Flood search each coordinate of a Region separately to find the distance from a coordinate not 
+							 contained in the region, as Region::analyseDepth did before the multi-source search
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pRegion - The Region to analyse
+		param[out] pDepth - Receives the depth of each contained coordinate
+	*/
+	void legacyAnalyseDepth(const Region& pRegion, depthMap& pDepth) {
+		//Create a temporary coordinate element that tracks position and parent object data
+		struct CoordTrace {
+			//! Store the position
+			coord pos;
+
+			//! Store the parent of the coordinate
+			CoordTrace* parent = nullptr;
+		};
+
+		//Setup the depth map
+		pDepth.setBounds(pRegion.locationMap.width(), pRegion.locationMap.height());
+
+		//Store the offsets used to find neighbors
+		const coord OFFSETS[] = { {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {-1, 1}, {1, 1}, {1, -1} };
+		const size_t OFFSET_SIZE = sizeof(OFFSETS) / sizeof(const coord);
+
+		//Loop through all coordinates to find their depth
+		for (const coord& COORD : pRegion.contained) {
+			//Create the search values for the coordinate
+			hitMap searched(pRegion.locationMap.width(), pRegion.locationMap.height());
+			std::queue<CoordTrace*> unsearched;
+			std::vector<CoordTrace> traceGrid(pRegion.locationMap.size());
+
+			//Start the search at the coordinate
+			traceGrid[searched.index(COORD.x, COORD.y)].pos = COORD;
+			unsearched.push(&traceGrid[searched.index(COORD.x, COORD.y)]);
+			searched[COORD.x][COORD.y] = 1;
+
+			//Search until a coordinate outside of the region or the map is found
+			bool outOfBounds = false;
+			CoordTrace* current = nullptr;
+			while (unsearched.size()) {
+				//Get the next item
+				current = unsearched.front();
+				unsearched.pop();
+
+				//Check to see if this location is outside of the region
+				if (!pRegion.locationMap[current->pos.x][current->pos.y]) break;
+
+				//Add neighboring cells to the unsearched list
+				for (size_t j = 0; j < OFFSET_SIZE; j++) {
+					const coord OFFSET = current->pos + OFFSETS[j];
+					if (OFFSET.x < 0 || OFFSET.y < 0 || OFFSET.x >= (int)searched.width() || OFFSET.y >= (int)searched.height()) {
+						outOfBounds = true;
+						break;
+					}
+					else if (!searched[OFFSET.x][OFFSET.y]) {
+						CoordTrace& trace = traceGrid[searched.index(OFFSET.x, OFFSET.y)];
+						trace.pos = OFFSET;
+						trace.parent = current;
+						unsearched.push(&trace);
+						searched[OFFSET.x][OFFSET.y] = 1;
+					}
+				}
+				if (outOfBounds) break;
+			}
+
+			//Trace the path back to find the depth
+			if (current) {
+				pDepth[COORD.x][COORD.y] = -1;
+				for (; current; current = current->parent) pDepth[COORD.x][COORD.y]++;
+			}
+		}
+	}
+
+	/*
+		breadthFirstDistances - Find the shortest path length from a coordinate to every coordinate with a plain breadth first search
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pMap - The gameMap to search
+		param[in] pTraversable - The Tile Type which can be moved through
+		param[in] pSource - The coordinate to measure the path lengths from
+		param[out] pDistances - Receives the path length of each coordinate (-1 where it can't be reached)
+	*/
+	void breadthFirstDistances(const gameMap& pMap, const ETileType& pTraversable, const coord& pSource, Map<int>& pDistances) {
+		//Store the offsets used to identify neighbours
+		const coord OFFSETS[] = { {0, 1}, {0, -1}, {1, 0}, {-1, 0} };
+
+		//Reset the distances
+		pDistances.setBounds(pMap.width(), pMap.height());
+		pDistances.fill(-1);
+
+		//Flood outwards from the source
+		std::queue<coord> open;
+		pDistances[pSource.x][pSource.y] = 0;
+		open.push(pSource);
+		while (open.size()) {
+			const coord CURRENT = open.front();
+			open.pop();
+			for (const coord& DIR : OFFSETS) {
+				const coord NEXT = CURRENT + DIR;
+				if (NEXT.x < 0 || NEXT.y < 0 || NEXT.x >= (int)pMap.width() || NEXT.y >= (int)pMap.height() ||
+					pMap[NEXT.x][NEXT.y] != pTraversable || pDistances[NEXT.x][NEXT.y] != -1)
+					continue;
+				pDistances[NEXT.x][NEXT.y] = pDistances[CURRENT.x][CURRENT.y] + 1;
+				open.push(NEXT);
+			}
+		}
+	}
+
+	/*
+		findTraversable - Collect every coordinate on a gameMap of a Tile Type
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pMap - The gameMap to search
+		param[in] pTraversable - The Tile Type to collect
+
+		return coords - Returns the coordinates of the matching tiles
+	*/
+	coords findTraversable(const gameMap& pMap, const ETileType& pTraversable) {
+		coords found;
+		for (int x = 0; x < (int)pMap.width(); x++) {
+			for (int y = 0; y < (int)pMap.height(); y++) {
+				if (pMap[x][y] == pTraversable) found.push_back(coord(x, y));
+			}
+		}
+		return found;
+	}
+
+	/*
+		runMapGenerationBenchmarks - Time the stages of the BombSquad map generation across map sizes
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+	*/
+	void runMapGenerationBenchmarks(const BenchmarkSettings& pSettings) {
+		//Store the square map sizes to test
+		const size_t SIZES[] = { 32, 64, 128, 256, 512 };
+
+		//Get the default automata rules
+		const MapGenerator DEFAULTS;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////------------------------------------Cellular Automata--------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		printSuite("Map Generation - automata step (Legacy gameMap vs CellBoard)");
+		for (const size_t& SIZE : SIZES) {
+			//Create the starting map
+			const gameMap START = createRandomMap(SIZE, SIZE, DEFAULTS.getInitialChance(), SIZE);
+			const std::string DIM = std::to_string(SIZE) + "x" + std::to_string(SIZE);
+
+			//Time a single in place step of the Legacy mode
+			gameMap map = START;
+			runBenchmark(("legacy step " + DIM).c_str(), pSettings, [&](const size_t& pCount) {
+				size_t changed = 0;
+				for (size_t i = 0; i < pCount; i++) changed += DEFAULTS.simulateStep(map);
+				doNotOptimise(changed);
+			});
+
+			//Time a single step of the packed board
+			CellBoard board;
+			board.load(START, ETileType::Free);
+			runBenchmark(("board step " + DIM).c_str(), pSettings, [&](const size_t& pCount) {
+				size_t changed = 0;
+				for (size_t i = 0; i < pCount; i++) changed += board.step(DEFAULTS.getBirthRate(), DEFAULTS.getDeathLimit());
+				doNotOptimise(changed);
+			});
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////---------------------------------------Region Depth----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		printSuite("Map Generation - Region::analyseDepth (70% open, per coordinate search vs multi-source)");
+		const size_t LEGACY_DEPTH_SIZE = 64;
+		for (const size_t& SIZE : SIZES) {
+			//Identify the regions of a random map
+			RegionIdentifier identifier(ETileType::Free, createRandomMap(SIZE, SIZE, .7f, SIZE));
+
+			const std::string DIM = std::to_string(SIZE) + "x" + std::to_string(SIZE);
+
+			//Time the per coordinate search, which is only practical on the smaller maps
+			depthMap legacy;
+			if (SIZE <= LEGACY_DEPTH_SIZE) {
+				runBenchmark(("per coordinate search " + DIM).c_str(), pSettings, [&](const size_t& pCount) {
+					for (size_t i = 0; i < pCount; i++) {
+						for (const Region& REGION : identifier.regions) legacyAnalyseDepth(REGION, legacy);
+					}
+					doNotOptimise(legacy.width());
+				});
+			}
+
+			//Time analysing every region, reusing the scratch buffers as the generator does
+			DepthScratch scratch;
+			runBenchmark(("analyseDepth " + DIM).c_str(), pSettings, [&](const size_t& pCount) {
+				for (size_t i = 0; i < pCount; i++) {
+					for (Region& region : identifier.regions) region.analyseDepth(scratch);
+				}
+				doNotOptimise(identifier.regions.size());
+			});
+
+			//Check the searches agree on the depth of every coordinate
+			if (SIZE <= LEGACY_DEPTH_SIZE) {
+				size_t mismatches = 0, total = 0;
+				for (const Region& REGION : identifier.regions) {
+					legacyAnalyseDepth(REGION, legacy);
+					for (const coord& COORD : REGION.contained) {
+						if (legacy[COORD.x][COORD.y] != REGION.distanceFromExternal[COORD.x][COORD.y]) ++mismatches;
+						++total;
+					}
+				}
+				if (mismatches) printf("  The searches disagreed on the depth of %zu of %zu coordinates\n", mismatches, total);
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////----------------------------------------Path Finding---------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		printSuite("Map Generation - PathFinder (60% open, breadth first search vs A* and flood)");
+		const size_t PATH_BOARDS = 16, PATH_PAIRS = 64, PATH_SIZE = 64;
+		size_t reachMismatches = 0, lengthMismatches = 0, floodMismatches = 0, pairs = 0;
+		for (size_t board = 0; board < PATH_BOARDS; board++) {
+			//Create a random board and the coordinates that can be moved through
+			const gameMap MAP = createRandomMap(PATH_SIZE, PATH_SIZE, .6f, board + 1);
+			const coords OPEN = findTraversable(MAP, ETileType::Free);
+			if (OPEN.empty()) continue;
+
+			//Setup the path finder for the board
+			PathFinder finder;
+			finder.setMap(MAP, ETileType::Free);
+
+			//Compare the paths between random pairs of coordinates
+			Utilities::Random rng(board);
+			Map<int> expected, totals(PATH_SIZE, PATH_SIZE);
+			coords path;
+			for (size_t i = 0; i < PATH_PAIRS; i++, pairs++) {
+				const coord START = OPEN[(size_t)rng.range(OPEN.size())];
+				const coord END = OPEN[(size_t)rng.range(OPEN.size())];
+				breadthFirstDistances(MAP, ETileType::Free, START, expected);
+
+				//Check A* finds a path of the same length whenever one exists
+				const int DISTANCE = expected[END.x][END.y];
+				const bool FOUND = finder.findPath(START, END, path);
+				if (FOUND != (DISTANCE != -1)) ++reachMismatches;
+				else if (FOUND && (int)path.size() != DISTANCE) ++lengthMismatches;
+
+				//Check the flood reaches the same coordinates with the same lengths
+				totals.fill(0);
+				finder.accumulateDistances(START, totals);
+				for (const coord& POS : OPEN) {
+					if (POS != START && totals[POS.x][POS.y] != std::max(expected[POS.x][POS.y], 0)) {
+						++floodMismatches;
+						break;
+					}
+				}
+			}
+		}
+		if (reachMismatches || lengthMismatches || floodMismatches)
+			printf("  Of %zu pairs A* disagreed on reachability for %zu and path length for %zu, the flood disagreed for %zu\n", pairs, reachMismatches, lengthMismatches, floodMismatches);
+
+		//Time finding paths between random coordinates on larger boards
+		for (const size_t& SIZE : { (size_t)64, (size_t)256 }) {
+			//Setup the board
+			const gameMap MAP = createRandomMap(SIZE, SIZE, .6f, SIZE);
+			const coords OPEN = findTraversable(MAP, ETileType::Free);
+			PathFinder finder;
+			finder.setMap(MAP, ETileType::Free);
+			const std::string DIM = std::to_string(SIZE) + "x" + std::to_string(SIZE);
+
+			//Time the breadth first search
+			Utilities::Random rng(SIZE);
+			Map<int> distances;
+			runBenchmark(("breadth first search " + DIM).c_str(), pSettings, [&](const size_t& pCount) {
+				int total = 0;
+				for (size_t i = 0; i < pCount; i++) {
+					const coord START = OPEN[(size_t)rng.range(OPEN.size())], END = OPEN[(size_t)rng.range(OPEN.size())];
+					breadthFirstDistances(MAP, ETileType::Free, START, distances);
+					total += distances[END.x][END.y];
+				}
+				doNotOptimise(total);
+			});
+
+			//Time the A* search
+			coords path;
+			runBenchmark(("PathFinder::findPath " + DIM).c_str(), pSettings, [&](const size_t& pCount) {
+				size_t total = 0;
+				for (size_t i = 0; i < pCount; i++) {
+					const coord START = OPEN[(size_t)rng.range(OPEN.size())], END = OPEN[(size_t)rng.range(OPEN.size())];
+					if (finder.findPath(START, END, path)) total += path.size();
+				}
+				doNotOptimise(total);
+			});
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------Complete Generation-------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		printSuite("Map Generation - generateMap (single worker, 4 players)");
+		const size_t MAP_SIZES[][2] = { { 25, 15 }, { 64, 64 }, { 128, 128 } };
+		const EAutomataMode MODES[] = { EAutomataMode::Legacy, EAutomataMode::Synchronous };
+		for (const auto& DIM : MAP_SIZES) {
+			for (const EAutomataMode& MODE : MODES) {
+				//Setup a generator with a fixed seed
+				MapGenerator generator;
+				generator.setSeed(DIM[0] * DIM[1]);
+				generator.setWorkerCount(1);
+				generator.setAutomataMode(MODE);
+
+				//Time generating a complete map
+				const std::string NAME = std::string(MODE == EAutomataMode::Legacy ? "legacy " : "synchronous ") + std::to_string(DIM[0]) + "x" + std::to_string(DIM[1]);
+				runBenchmark(NAME.c_str(), pSettings, [&](const size_t& pCount) {
+					for (size_t i = 0; i < pCount; i++) doNotOptimise(generator.generateMap(DIM[0], DIM[1], 4).size());
+				});
+			}
+		}
+	}
+}
@@ -0,0 +1,313 @@
+#include "../Benchmark.hpp"
+
+//! Include the SDL2_Engine rendering objects
+#include <Globals.hpp>
+#include <Rendering/Renderer.hpp>
+#include <Rendering/RendererInitialiser.hpp>
+#include <Rendering/BasicSceneRenderer.hpp>
+#include <Rendering/BatchedSceneRenderer.hpp>
+#include <Rendering/RenderLayer.hpp>
+#include <Utilities/Random.hpp>
+using namespace SDL2_Engine;
+using namespace SDL2_Engine::Rendering;
+
+//! Include the BombSquad map generator
+#include <Game/MapGeneration/MapGenerator.hpp>
+using namespace BombSquad;
+
+//! Include the SDL objects
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+//! Include the STL algorithms used to clamp the tile ranges
+#include <algorithm>
+
+//! Define the dimensions of the surface that is rendered to
+#define TARGET_WIDTH 1280
+#define TARGET_HEIGHT 720
+
+//! Define the number of textures the sprites are drawn from
+#define SPRITE_TEXTURE_COUNT 4
+
+//! Define the number of distinct strings the text benchmarks cycle through
+#define TEXT_STRING_COUNT 64
+
+//! Define the area the BombSquad arena is drawn in
+#define ARENA_X 46
+#define ARENA_Y 58
+#define ARENA_W 1196
+#define ARENA_H 612
+
+//! Define the number of frames between obstacles being destroyed in the tile layer benchmark
+#define TILE_CHANGE_INTERVAL 30
+
+namespace Benchmarks {
+	/*
+		drawSpriteFrame - Submit a frame of tiles, sprites and rectangles similar to a BombSquad game scene
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pScene - The Scene Renderer to draw with
+		param[in] pRenderer - The SDL Renderer being drawn to
+		param[in] pTextures - The textures to draw the tiles and sprites with
+
+		return RenderStats - Returns the statistics of the presented frame
+	*/
+	RenderStats drawSpriteFrame(ISceneRenderer& pScene, SDL_Renderer*& pRenderer, SDL_Texture* pTextures[SPRITE_TEXTURE_COUNT]) {
+		//Use the same layout each frame
+		Utilities::Random rng(1);
+
+		//Draw a background of tiles from the first two textures
+		const int TILE = 32;
+		for (int x = 0; x < TARGET_WIDTH / TILE; x++) {
+			for (int y = 0; y < TARGET_HEIGHT / TILE; y++)
+				pScene.drawTexture(pRenderer, pTextures[rng.range(2)], { x * TILE, y * TILE, TILE, TILE });
+		}
+
+		//Draw sprites from the remaining textures with a tint, and a highlight rectangle over some
+		for (int i = 0; i < 400; i++) {
+			const SDL_Rect POS = { (int)rng.range(TARGET_WIDTH - TILE), (int)rng.range(TARGET_HEIGHT - TILE), TILE, TILE };
+			pScene.drawTexture(pRenderer, pTextures[2 + rng.range(2)], POS, nullptr, (i & 1 ? Colour(Colour::White) : Colour(Colour::Red)));
+			if (!(i % 8)) pScene.drawRect(pRenderer, POS, Colour::Yellow);
+		}
+
+		//Draw the interface panels
+		for (int i = 0; i < 16; i++) pScene.drawRect(pRenderer, { 8 + i * 78, 8, 70, 24 }, Colour::Black, true, nullptr);
+
+		//Submit the frame
+		pScene.presentFrame(pRenderer);
+		return pScene.getFrameStats();
+	}
+
+	/*
+		runTileLayerBenchmarks - Compare drawing a BombSquad arena tile by tile against drawing it from a Render Layer
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+
+		NOTE:
+		Render Layers draw through the Renderer in the Globals, which requires a window. Set the
+		SDL_VIDEODRIVER environment variable to dummy to run the benchmarks without a display
+	*/
+	void runTileLayerBenchmarks(const BenchmarkSettings& pSettings) {
+		//Create a hidden window to render to
+		SDL_Window* window = (SDL_InitSubSystem(SDL_INIT_VIDEO) ? nullptr : SDL_CreateWindow("Benchmarks", 0, 0, TARGET_WIDTH, TARGET_HEIGHT, SDL_WINDOW_HIDDEN));
+		if (!window) {
+			printf("\nTile layer benchmarks skipped, failed to create a window (Set SDL_VIDEODRIVER=dummy to run without a display). Error: %s\n", SDL_GetError());
+			return;
+		}
+
+		//Create the Renderer in software so the results are comparable with the other rendering benchmarks
+		Initialisation::RendererInitialiser setup;
+		setup.properties = ERendererProperties::Software_Fallback;
+		setup.properties |= ERendererProperties::Target_Texture;
+		setup.sceneRenderer = new BasicSceneRenderer();
+		if (!Globals::addInterface<Renderer>(window, setup)) {
+			printf("\nTile layer benchmarks skipped, failed to create the Renderer\n");
+			return;
+		}
+		Renderer& rend = Globals::get<Renderer>();
+
+		//Create a sprite sheet with a row of tiles
+		SDL_Surface* surface = SDL_CreateRGBSurface(0, 256, 64, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+		SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 96, 96, 96, 255));
+		SDL_Texture* sheet = SDL_CreateTextureFromSurface(rend.getRenderer(), surface);
+		SDL_FreeSurface(surface);
+
+		//Generate an arena the size of a default game
+		MapGenerator generator;
+		generator.setSeed(1);
+		generator.setWorkerCount(1);
+		gameMap map = generator.generateMap(25, 15, 4);
+		const SDL_Point DIM = { ARENA_W / (int)map.width(), ARENA_H / (int)map.height() };
+
+		//Store the obstacles that can be destroyed
+		std::vector<SDL_Point> obstacles;
+		for (size_t x = 0; x < map.width(); x++) {
+			for (size_t y = 0; y < map.height(); y++) {
+				if (map[x][y] == ETileType::Obstacle) obstacles.push_back({ (int)x, (int)y });
+			}
+		}
+
+		//Draw the tiles overlapping an area, as the GameScene does
+		const layerDrawFunc DRAW_TILES = [&](const SDL_Rect& pArea, const SDL_Point& pOffset) {
+			for (int x = pArea.x / DIM.x; x <= std::min((pArea.x + pArea.w - 1) / DIM.x, (int)map.width() - 1); x++) {
+				for (int y = pArea.y / DIM.y; y <= std::min((pArea.y + pArea.h - 1) / DIM.y, (int)map.height() - 1); y++) {
+					const int TILE = (int)map[x][y];
+					if (TILE < 0) continue;
+					const SDL_Rect SRC = { TILE * 32, 32, 32, 32 };
+					rend.drawTexture(sheet, { pOffset.x + DIM.x * x, pOffset.y + DIM.y * y, DIM.x, DIM.y }, &SRC);
+				}
+			}
+		};
+
+		//Destroy an obstacle at a regular interval, returning the area that changed
+		size_t frame = 0, destroyed = 0;
+		const auto destroyObstacle = [&](SDL_Rect& pChanged) {
+			if (++frame % TILE_CHANGE_INTERVAL || obstacles.empty()) return false;
+			const SDL_Point& TILE = obstacles[destroyed++ % obstacles.size()];
+			map[TILE.x][TILE.y] = (map[TILE.x][TILE.y] == ETileType::Obstacle ? ETileType::Free : ETileType::Obstacle);
+			pChanged = { DIM.x * TILE.x, DIM.y * TILE.y, DIM.x, DIM.y };
+			return true;
+		};
+
+		printSuite("Rendering - 25x15 arena tiles (software Renderer, an obstacle destroyed every 30 frames)");
+
+		//Time drawing every tile each frame
+		RenderStats total;
+		size_t frames = 0;
+		runBenchmark("tile by tile frame", pSettings, [&](const size_t& pCount) {
+			for (size_t i = 0; i < pCount; i++) {
+				SDL_Rect changed;
+				destroyObstacle(changed);
+				DRAW_TILES({ 0, 0, DIM.x * (int)map.width(), DIM.y * (int)map.height() }, { ARENA_X, ARENA_Y });
+				rend.presentFrame();
+				total.drawCalls += rend.getFrameStats().drawCalls;
+				++frames;
+			}
+		});
+		printf("    %.1f draw calls per frame\n", (double)total.drawCalls / frames);
+
+		//Time drawing the tiles from a Render Layer
+		RenderLayer layer;
+		layer.create(DIM.x * (int)map.width(), DIM.y * (int)map.height(), DRAW_TILES, DIM.x * 4, DIM.y * 4);
+		total = RenderStats();
+		frames = 0;
+		runBenchmark(layer.isCached() ? "RenderLayer frame" : "RenderLayer frame (no render target support)", pSettings, [&](const size_t& pCount) {
+			for (size_t i = 0; i < pCount; i++) {
+				SDL_Rect changed;
+				if (destroyObstacle(changed)) layer.markDirty(changed);
+				layer.draw({ ARENA_X, ARENA_Y });
+				rend.presentFrame();
+				total.drawCalls += rend.getFrameStats().drawCalls;
+				++frames;
+			}
+		});
+		printf("    %.1f draw calls per frame (%zu chunks)\n", (double)total.drawCalls / frames, layer.getChunkCount());
+
+		//Free the resources, the Renderer and window are destroyed with the Globals
+		layer.destroy();
+		SDL_DestroyTexture(sheet);
+	}
+
+	/*
+		runRenderingBenchmarks - Time the Scene Renderers drawing to an SDL software renderer
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+
+		NOTE:
+		The software renderer needs no window or video driver, so the benchmarks can run headless.
+		Text benchmarks are only run when a font path has been provided
+	*/
+	void runRenderingBenchmarks(const BenchmarkSettings& pSettings) {
+		//Create the surface and renderer to draw to
+		SDL_Surface* target = SDL_CreateRGBSurface(0, TARGET_WIDTH, TARGET_HEIGHT, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+		SDL_Renderer* renderer = (target ? SDL_CreateSoftwareRenderer(target) : nullptr);
+		if (!renderer) {
+			printf("\nRendering benchmarks skipped, failed to create the software renderer. Error: %s\n", SDL_GetError());
+			if (target) SDL_FreeSurface(target);
+			runTileLayerBenchmarks(pSettings);
+			return;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------------Batching------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		//Create the textures to draw
+		SDL_Texture* textures[SPRITE_TEXTURE_COUNT];
+		for (int i = 0; i < SPRITE_TEXTURE_COUNT; i++) {
+			SDL_Surface* surface = SDL_CreateRGBSurface(0, 32, 32, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+			SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, (Uint8)(64 * i), 128, (Uint8)(255 - 64 * i), 255));
+			textures[i] = SDL_CreateTextureFromSurface(renderer, surface);
+			SDL_FreeSurface(surface);
+		}
+
+		//Create the Scene Renderers to compare
+		BasicSceneRenderer basic;
+		BatchedSceneRenderer batched;
+		ISceneRenderer* scenes[] = { &basic, &batched };
+		const char* NAMES[] = { "BasicSceneRenderer frame", "BatchedSceneRenderer frame" };
+
+		printSuite("Rendering - sprite frame (software renderer)");
+		for (int i = 0; i < 2; i++) {
+			//Setup the Scene Renderer
+			scenes[i]->createRenderer(renderer);
+
+			//Time drawing whole frames
+			RenderStats stats;
+			runBenchmark(NAMES[i], pSettings, [&](const size_t& pCount) {
+				for (size_t f = 0; f < pCount; f++) stats = drawSpriteFrame(*scenes[i], renderer, textures);
+			});
+
+			//Output the work submitted for each frame
+			printf("    %u commands, %u draw calls, %u state changes per frame\n", stats.commands, stats.drawCalls, stats.stateChanges);
+			scenes[i]->destroyRenderer();
+		}
+
+		//Destroy the textures
+		for (int i = 0; i < SPRITE_TEXTURE_COUNT; i++) SDL_DestroyTexture(textures[i]);
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-------------------------------------------Text--------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		//Load the font
+		_TTF_Font* font = nullptr;
+		const bool TTF_STARTED = (pSettings.fontPath && !TTF_Init());
+		if (TTF_STARTED) font = TTF_OpenFont(pSettings.fontPath, 24);
+		if (!font) printf("\nText benchmarks skipped, %s\n", (pSettings.fontPath ? "the font could not be loaded" : "no font was provided (-font <path>)"));
+		else {
+			//Create the strings to cycle through
+			std::vector<std::string> strings(TEXT_STRING_COUNT);
+			for (size_t i = 0; i < TEXT_STRING_COUNT; i++) strings[i] = "Player " + std::to_string(i % 4 + 1) + " - Wins: " + std::to_string(i * 7);
+
+			printSuite("Rendering - drawText (software renderer)");
+
+			//Time rasterising a new texture for every call, as drawText did before text was cached
+			runBenchmark("uncached TTF_RenderText + texture", pSettings, [&](const size_t& pCount) {
+				for (size_t i = 0; i < pCount; i++) {
+					SDL_Surface* surface = TTF_RenderText_Solid(font, strings[i % TEXT_STRING_COUNT].c_str(), { 0, 0, 0, 255 });
+					SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+					SDL_Rect pos = { 10, 10, surface->w, surface->h };
+					SDL_RenderCopy(renderer, texture, nullptr, &pos);
+					SDL_DestroyTexture(texture);
+					SDL_FreeSurface(surface);
+				}
+			});
+
+			//Time each of the cache modes
+			const ETextCacheMode MODES[] = { ETextCacheMode::Glyphs, ETextCacheMode::String };
+			const char* MODE_NAMES[] = { "BasicSceneRenderer drawText (Glyphs)", "BasicSceneRenderer drawText (String)" };
+			for (int m = 0; m < 2; m++) {
+				BasicSceneRenderer scene;
+				scene.createRenderer(renderer);
+				runBenchmark(MODE_NAMES[m], pSettings, [&](const size_t& pCount) {
+					for (size_t i = 0; i < pCount; i++) {
+						const char* text = strings[i % TEXT_STRING_COUNT].c_str();
+						scene.drawText(renderer, text, font, { 10, 10 }, Colour::Black, ETextAlignment::Null, ETextRenderType::Solid, MODES[m]);
+						if (i % TEXT_STRING_COUNT == TEXT_STRING_COUNT - 1) scene.presentFrame(renderer);
+					}
+				});
+				scene.destroyRenderer();
+			}
+
+			//Close the font
+			TTF_CloseFont(font);
+		}
+		if (TTF_STARTED) TTF_Quit();
+
+		//Destroy the renderer
+		SDL_DestroyRenderer(renderer);
+		SDL_FreeSurface(target);
+
+		//Time the Render Layer through the engine Renderer
+		runTileLayerBenchmarks(pSettings);
+	}
+}
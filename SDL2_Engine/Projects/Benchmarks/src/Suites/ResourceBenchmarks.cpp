@@ -0,0 +1,322 @@
+#include "../Benchmark.hpp"
+
+//! Include the SDL2_Engine objects
+#include <Resources/Resources.hpp>
+#include <Resources/ResourceArchive.hpp>
+#include <Resources/ResourceTypes/LocalResourceGeneric.hpp>
+#include <Utilities/Random.hpp>
+using namespace SDL2_Engine;
+
+//! Include the string stream used by the reference resource key
+#include <sstream>
+
+//! Include the map used by the reference resource sweep
+#include <unordered_map>
+
+//! Include the SDL objects
+#include <SDL.h>
+
+//! Include the directory functionality
+#include <dirent.h>
+#ifdef _WIN32
+#include <direct.h>
+#define makeDirectory(PATH) _mkdir(PATH)
+#define removeDirectory(PATH) _rmdir(PATH)
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#define makeDirectory(PATH) mkdir(PATH, 0755)
+#define removeDirectory(PATH) rmdir(PATH)
+#endif
+
+//! Define the asset set that is generated to load
+#define ASSET_DIRECTORY "BenchmarkAssets"
+#define ASSET_ARCHIVE "BenchmarkAssets.pak"
+#define ASSET_PREFIX "assets/"
+#define ASSET_FOLDERS 16
+#define ASSETS_PER_FOLDER 128
+#define ASSET_MIN_SIZE 256
+#define ASSET_MAX_SIZE 8192
+
+namespace Benchmarks {
+	/*
+		readAll - Read the remaining contents of a stream and close it
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pStream - The stream to read (Can be nullptr)
+		param[in] pBuffer - The buffer to read into, resized to fit the stream
+
+		return size_t - Returns the number of bytes read
+	*/
+	size_t readAll(SDL_RWops* pStream, std::vector<char>& pBuffer) {
+		//Check there is a stream
+		if (!pStream) return 0;
+
+		//Read the contents
+		const Sint64 SIZE = SDL_RWsize(pStream);
+		if (SIZE > 0 && (size_t)SIZE > pBuffer.size()) pBuffer.resize((size_t)SIZE);
+		const size_t READ = (SIZE > 0 ? SDL_RWread(pStream, pBuffer.data(), 1, (size_t)SIZE) : 0);
+		SDL_RWclose(pStream);
+		return READ;
+	}
+
+	/*
+		findFiles - Recursively search a directory for files, as the game does at startup
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pDirectory - The directory to search, ending with a separator
+		param[in] pFiles - The vector to add the paths of the found files to
+	*/
+	void findFiles(const std::string& pDirectory, std::vector<std::string>& pFiles) {
+		//Open the directory
+		DIR* directory = opendir(pDirectory.c_str());
+		if (!directory) return;
+
+		//Process the elements
+		while (struct dirent* element = readdir(directory)) {
+			const std::string NAME = element->d_name;
+			if (NAME == "." || NAME == "..") continue;
+			else if (element->d_type == DT_DIR) findFiles(pDirectory + NAME + '/', pFiles);
+			else pFiles.push_back(pDirectory + NAME);
+		}
+
+		//Close the directory
+		closedir(directory);
+	}
+
+	/*
+		streamKey - Generate a resource key by streaming the values to a string, as Resources did before keys were typed
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		Template TArgs - A parameter pack of stream-able values
+
+		param[in] pArgs - The values that identify the resource
+
+		return size_t - Returns the hash of the streamed string
+	*/
+	template<typename ... TArgs>
+	size_t streamKey(const TArgs& ... pArgs) {
+		std::ostringstream os;
+		const int EXPAND[] = { 0, ((os << pArgs), 0)... };
+		(void)EXPAND;
+		return std::hash<std::string>{}(os.str());
+	}
+
+	/*
+		runResourceKeyBenchmarks - Time the generation of resource keys and the retrieval of loaded resources
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+		param[in] pPath - The path of a file that can be loaded as a Generic resource
+	*/
+	void runResourceKeyBenchmarks(const BenchmarkSettings& pSettings, const char* pPath) {
+		//Time the key of a Font, identified by a path and size
+		const char* FONT_PATH = "resources/Fonts/Ebrima.ttf";
+		runBenchmark("typed key (type, path, size)", pSettings, [&](const size_t& pCount) {
+			size_t sum = 0;
+			for (size_t i = 0; i < pCount; i++) sum += Resources::hashData(EResourceType::Font, FONT_PATH, (int)(i & 63));
+			doNotOptimise(sum);
+		});
+		runBenchmark("reference stream key (type, path, size)", pSettings, [&](const size_t& pCount) {
+			size_t sum = 0;
+			for (size_t i = 0; i < pCount; i++) sum += streamKey((int)EResourceType::Font, FONT_PATH, (int)(i & 63));
+			doNotOptimise(sum);
+		});
+
+		//Create a Resources Manager outside of the Globals, without a Renderer
+		Resources resources(nullptr, 1);
+		if (!resources.createInterface()) return;
+
+		//Time retrieving a resource that is already loaded
+		LocalResource<Generic> held = resources.loadResource<Generic>(pPath);
+		if (held->status() == EResourceLoadStatus::Loaded) {
+			runBenchmark("loadResource<Generic> hit", pSettings, [&](const size_t& pCount) {
+				size_t sum = 0;
+				for (size_t i = 0; i < pCount; i++) sum += resources.loadResource<Generic>(pPath)->size();
+				doNotOptimise(sum);
+			});
+		}
+
+		//Release the resource before the manager is destroyed
+		held = nullptr;
+		resources.destroyInterface();
+	}
+
+	/*
+		runResourceCacheBenchmarks - Time the per update cost of tracking loaded resources and reloading resources across a scene change
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+		param[in] pPaths - The paths of the files to load as Generic resources
+	*/
+	void runResourceCacheBenchmarks(const BenchmarkSettings& pSettings, const std::vector<std::string>& pPaths) {
+		//Create a Resources Manager outside of the Globals, without a Renderer
+		Resources resources(nullptr, 1);
+		if (!resources.createInterface()) return;
+
+		//Load every file, holding the resources as a scene would
+		std::vector<LocalResource<Generic>> scene;
+		for (const auto& path : pPaths) scene.push_back(resources.loadResource<Generic>(path.c_str()));
+
+		//Time the update while the resources are in use
+		runBenchmark("update (2048 resources in use)", pSettings, [&](const size_t& pCount) {
+			for (size_t i = 0; i < pCount; i++) resources.update();
+			doNotOptimise(resources.getCacheUsage());
+		});
+
+		//Time the sweep Resources performed each update before unused resources were tracked
+		std::unordered_map<size_t, LocalResourceBase> swept;
+		for (size_t i = 0; i < scene.size(); i++) swept[i] = scene[i];
+		runBenchmark("reference unique() sweep (2048 resources in use)", pSettings, [&](const size_t& pCount) {
+			size_t unused = 0;
+			for (size_t i = 0; i < pCount; i++) {
+				for (const auto& it : swept) if (it.second.unique()) ++unused;
+			}
+			doNotOptimise(unused);
+		});
+		swept.clear();
+
+		//Time releasing and reloading the scene with the resources kept in the cache
+		auto changeScene = [&](const size_t& pCount) {
+			size_t bytes = 0;
+			for (size_t i = 0; i < pCount; i++) {
+				scene.clear();
+				resources.update();
+				for (const auto& path : pPaths) scene.push_back(resources.loadResource<Generic>(path.c_str()));
+				bytes += scene.back()->size();
+			}
+			doNotOptimise(bytes);
+		};
+		resources.setEvictionInterval(0.f);
+		runBenchmark("scene change (release + reload 2048, cached)", pSettings, changeScene);
+
+		//Time the same change with every unused resource freed, as before
+		resources.setCacheBudget(0);
+		runBenchmark("scene change (release + reload 2048, no cache)", pSettings, changeScene);
+
+		//Release the resources before the manager is destroyed
+		scene.clear();
+		resources.destroyInterface();
+	}
+
+	/*
+		runResourceBenchmarks - Time the loading of resources from loose files and Resource Archives and the retrieval of loaded resources
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+
+		NOTE:
+		The asset set is generated in the working directory and removed afterwards. As the files were just
+		written they are in the operating system's cache, so the timings measure the cost of searching
+		directories and opening files rather than reading from the disk. The Logger must have been added
+		to the Globals before this is called
+	*/
+	void runResourceBenchmarks(const BenchmarkSettings& pSettings) {
+		printSuite("Resources");
+
+		//Generate the loose asset set
+		std::vector<std::string> assets;
+		std::vector<std::string> folders;
+		{
+			Utilities::Random rng(1);
+			std::vector<char> data(ASSET_MAX_SIZE);
+			bool created = (makeDirectory(ASSET_DIRECTORY) == 0);
+			for (int f = 0; f < ASSET_FOLDERS && created; f++) {
+				//Create the folder
+				folders.push_back(std::string(ASSET_DIRECTORY "/Folder") + std::to_string(f));
+				if (!(created = (makeDirectory(folders.back().c_str()) == 0))) break;
+
+				//Fill it with files of varying size
+				for (int i = 0; i < ASSETS_PER_FOLDER && created; i++) {
+					assets.push_back(folders.back() + "/Asset" + std::to_string(i) + ".bin");
+					const size_t SIZE = ASSET_MIN_SIZE + (size_t)rng.range(ASSET_MAX_SIZE - ASSET_MIN_SIZE);
+					for (size_t j = 0; j < SIZE; j++) data[j] = (char)rng.next();
+					SDL_RWops* file = SDL_RWFromFile(assets.back().c_str(), "wb");
+					created = (file && SDL_RWwrite(file, data.data(), SIZE, 1) == 1);
+					if (file) SDL_RWclose(file);
+				}
+			}
+
+			//Pack the asset set
+			if (!created || !ResourceArchive::pack(ASSET_DIRECTORY, ASSET_ARCHIVE, ASSET_PREFIX)) printf("  Failed to create the asset set in '%s', skipping the resource benchmarks\n", ASSET_DIRECTORY);
+			else {
+				std::vector<char> buffer;
+
+				//Time searching for and reading every loose file
+				runBenchmark("loose cold start (search + read 2048 files)", pSettings, [&](const size_t& pCount) {
+					size_t bytes = 0;
+					for (size_t i = 0; i < pCount; i++) {
+						std::vector<std::string> found;
+						findFiles(ASSET_DIRECTORY "/", found);
+						for (const auto& path : found) bytes += readAll(SDL_RWFromFile(path.c_str(), "rb"), buffer);
+					}
+					doNotOptimise(bytes);
+				});
+
+				//Time opening the archive and reading every entry
+				runBenchmark("packed cold start (open + read 2048 entries)", pSettings, [&](const size_t& pCount) {
+					size_t bytes = 0;
+					for (size_t i = 0; i < pCount; i++) {
+						ResourceArchive archive;
+						archive.open(ASSET_ARCHIVE);
+						for (size_t j = 0; j < archive.getEntryCount(); j++) bytes += readAll(archive.openEntry(archive.getEntryName(j)), buffer);
+					}
+					doNotOptimise(bytes);
+				});
+
+				//Time opening a single known resource
+				size_t next = 0;
+				runBenchmark("loose open + close", pSettings, [&](const size_t& pCount) {
+					size_t opened = 0;
+					for (size_t i = 0; i < pCount; i++) {
+						if (SDL_RWops* file = SDL_RWFromFile(assets[next++ % assets.size()].c_str(), "rb")) {
+							SDL_RWclose(file);
+							++opened;
+						}
+					}
+					doNotOptimise(opened);
+				});
+
+				//Time opening the entry of a single known resource
+				ResourceArchive archive;
+				archive.open(ASSET_ARCHIVE);
+				std::vector<std::string> entryPaths;
+				for (const auto& path : assets) entryPaths.push_back(ASSET_PREFIX + path.substr(sizeof(ASSET_DIRECTORY)));
+				runBenchmark("packed open + close", pSettings, [&](const size_t& pCount) {
+					size_t opened = 0;
+					for (size_t i = 0; i < pCount; i++) {
+						if (SDL_RWops* entry = archive.openEntry(entryPaths[next++ % entryPaths.size()].c_str())) {
+							SDL_RWclose(entry);
+							++opened;
+						}
+					}
+					doNotOptimise(opened);
+				});
+
+				//Time the resource keys and cache hits
+				runResourceKeyBenchmarks(pSettings, assets.front().c_str());
+
+				//Time the tracking of loaded resources
+				runResourceCacheBenchmarks(pSettings, assets);
+			}
+		}
+
+		//Remove the asset set
+		remove(ASSET_ARCHIVE);
+		for (const auto& path : assets) remove(path.c_str());
+		for (const auto& folder : folders) removeDirectory(folder.c_str());
+		removeDirectory(ASSET_DIRECTORY);
+	}
+}
@@ -0,0 +1,135 @@
+#include "../Benchmark.hpp"
+
+//! Include the SDL2_Engine UI objects
+#include <UI/Canvas.hpp>
+#include <UI/CanvasInitialiser.hpp>
+#include <UI/UIElements/UIButton.hpp>
+#include <UI/UIElements/UIPanel.hpp>
+#include <Utilities/Random.hpp>
+using namespace SDL2_Engine;
+using namespace SDL2_Engine::UI;
+using namespace SDL2_Engine::UI::UIElements;
+
+//! Define the area the buttons are laid out in
+#define LAYOUT_WIDTH 1280
+#define LAYOUT_HEIGHT 720
+
+//! Define the number of points the mouse is tested at
+#define SAMPLE_POINTS 1024
+
+namespace Benchmarks {
+	/*
+		runCanvasBenchmarks - Time finding the button under the mouse on a Canvas filled with buttons
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+		param[in] pColumns - The number of columns of buttons
+		param[in] pRows - The number of rows of buttons
+	*/
+	void runCanvasBenchmarks(const BenchmarkSettings& pSettings, const int& pColumns, const int& pRows) {
+		//Create a Canvas outside of the Globals, as only the interaction map is used
+		Initialisation::CanvasInitialiser setup;
+		Canvas canvas(setup);
+
+		//Fill the layout with buttons, leaving a gap between them
+		const int CELL_W = LAYOUT_WIDTH / pColumns, CELL_H = LAYOUT_HEIGHT / pRows;
+		std::vector<IUIAction*> buttons;
+		for (int y = 0; y < pRows; y++) {
+			for (int x = 0; x < pColumns; x++) {
+				UIButton* button = canvas.createUI<UIButton>();
+				button->setLocation({ x * CELL_W, y * CELL_H, CELL_W * 3 / 4, CELL_H * 3 / 4 });
+				buttons.push_back(button);
+			}
+		}
+
+		//Add a background panel that can't be interacted with
+		UIPanel* background = canvas.createUI<UIPanel>();
+		background->setLocation({ 0, 0, LAYOUT_WIDTH, LAYOUT_HEIGHT });
+		canvas.rebuildInteractionMap();
+
+		//Generate the points the mouse is tested at
+		Utilities::Random rng(1);
+		std::vector<int> points(SAMPLE_POINTS * 2);
+		for (size_t i = 0; i < points.size(); i += 2) {
+			points[i] = (int)rng.range(LAYOUT_WIDTH);
+			points[i + 1] = (int)rng.range(LAYOUT_HEIGHT);
+		}
+
+		//Find the button at a point by checking every button, as the Canvas did before the grid
+		auto linearFind = [&](const int& pX, const int& pY) -> IUIBase* {
+			for (size_t i = 0; i < buttons.size(); i++) {
+				IUIBase* buffer = dynamic_cast<IUIBase*>(buttons[i]);
+				if (buffer->getLocation().contains(pX, pY)) return buffer;
+			}
+			return nullptr;
+		};
+
+		//Check the grid finds the same buttons
+		size_t mismatches = 0;
+		for (size_t i = 0; i < points.size(); i += 2) {
+			if (canvas.getActionObjectAt(points[i], points[i + 1]) != linearFind(points[i], points[i + 1])) ++mismatches;
+		}
+		if (mismatches) printf("  The grid disagreed with the linear search at %zu of %i points\n", mismatches, SAMPLE_POINTS);
+
+		//Time finding the button under the mouse
+		const std::string COUNT = std::to_string(buttons.size()) + " buttons)";
+		size_t next = 0;
+		runBenchmark(("getActionObjectAt (" + COUNT).c_str(), pSettings, [&](const size_t& pCount) {
+			size_t found = 0;
+			for (size_t i = 0; i < pCount; i++, next = (next + 2) % points.size()) {
+				if (canvas.getActionObjectAt(points[next], points[next + 1])) ++found;
+			}
+			doNotOptimise(found);
+		});
+		runBenchmark(("reference linear search (" + COUNT).c_str(), pSettings, [&](const size_t& pCount) {
+			size_t found = 0;
+			for (size_t i = 0; i < pCount; i++, next = (next + 2) % points.size()) {
+				if (linearFind(points[next], points[next + 1])) ++found;
+			}
+			doNotOptimise(found);
+		});
+
+		//Time finding the button after an element that isn't indexed has moved, which checks the indexed locations
+		runBenchmark(("move panel + getActionObjectAt (" + COUNT).c_str(), pSettings, [&](const size_t& pCount) {
+			size_t found = 0;
+			for (size_t i = 0; i < pCount; i++, next = (next + 2) % points.size()) {
+				background->setLocation({ -(int)(i & 1), 0, LAYOUT_WIDTH, LAYOUT_HEIGHT });
+				if (canvas.getActionObjectAt(points[next], points[next + 1])) ++found;
+			}
+			doNotOptimise(found);
+		});
+
+		//Time finding the button after one has moved, which re-indexes the grid
+		IUIBase* moved = dynamic_cast<IUIBase*>(buttons.back());
+		const UIBounds ORIGINAL = moved->getLocation();
+		runBenchmark(("move button + getActionObjectAt (" + COUNT).c_str(), pSettings, [&](const size_t& pCount) {
+			size_t found = 0;
+			for (size_t i = 0; i < pCount; i++, next = (next + 2) % points.size()) {
+				moved->setLocation({ ORIGINAL.x - (int)(i & 1), ORIGINAL.y, ORIGINAL.w, ORIGINAL.h });
+				if (canvas.getActionObjectAt(points[next], points[next + 1])) ++found;
+			}
+			doNotOptimise(found);
+		});
+
+		//Destroy the buttons
+		canvas.destroyInterface();
+	}
+
+	/*
+		runUIBenchmarks - Time the Canvas operations performed each frame
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The settings to run the benchmarks with
+	*/
+	void runUIBenchmarks(const BenchmarkSettings& pSettings) {
+		printSuite("UI");
+
+		//Time a menu sized Canvas and a stress test
+		runCanvasBenchmarks(pSettings, 8, 4);
+		runCanvasBenchmarks(pSettings, 64, 64);
+	}
+}
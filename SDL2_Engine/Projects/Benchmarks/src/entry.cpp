@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//! Include the SDL2_Engine objects needed by the suites
+#include <Globals.hpp>
+#include <Debug/Logger.hpp>
+#include <Debug/LoggerInitialiser.hpp>
+
+//! Include the SDL objects, keeping this main as the entry point
+#define SDL_MAIN_HANDLED
+#include <SDL.h>
+
+//! Include the benchmark functionality
+#include "Benchmark.hpp"
+
+using namespace SDL2_Engine;
+using namespace Benchmarks;
+
+//! Store the suites that can be run, in the order they are run
+const BenchmarkSuite SUITES[] = {
+	{ "globals", runGlobalsBenchmarks },
+	{ "mapgen", runMapGenerationBenchmarks },
+	{ "rendering", runRenderingBenchmarks },
+	{ "resources", runResourceBenchmarks },
+	{ "ui", runUIBenchmarks },
+	{ nullptr, nullptr }
+};
+
+/*
+	printUsage - Output the command line options of the benchmarks
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+*/
+void printUsage() {
+	//Output the names of the suites
+	printf("Usage: Benchmarks [options]\n"
+		"  -suite <name>         Only run a single suite (Default all):");
+	for (const BenchmarkSuite* suite = SUITES; suite->name; suite++) printf(" %s", suite->name);
+
+	//Output the remaining options
+	printf("\n"
+		"  -time <milliseconds>  The minimum time each benchmark is run for (Default 250)\n"
+		"  -font <path>          A TrueType font used to run the text rendering benchmarks\n");
+}
+
+/*
+	main - Parse the benchmark settings and run the requested suites
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	param[in] pArgCount - The number of command line arguments currently in the pArgs array
+	param[in] pArgs - An array of command line parameters passed to the program
+
+	return int - Returns the status code for the programs execution
+*/
+int main(int pArgCount, char* pArgs[]) {
+	//Create the default settings
+	BenchmarkSettings settings;
+	const char* suite = nullptr;
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+	////////------------------------------Process Command Line Arguments-------------------------////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	for (int i = 1; i < pArgCount; i++) {
+		//Get the value following the flag
+		const char* VALUE = (i + 1 < pArgCount ? pArgs[i + 1] : nullptr);
+
+		//Check for the flags with values
+		if (VALUE && !strcmp("-suite", pArgs[i])) { suite = VALUE; i++; }
+		else if (VALUE && !strcmp("-time", pArgs[i])) { settings.minMilliseconds = strtod(VALUE, nullptr); i++; }
+		else if (VALUE && !strcmp("-font", pArgs[i])) { settings.fontPath = VALUE; i++; }
+
+		//Unknown flag
+		else {
+			printUsage();
+			return 1;
+		}
+	}
+
+	//Check the suite name is known
+	if (suite) {
+		const BenchmarkSuite* found = SUITES;
+		while (found->name && strcmp(found->name, suite)) found++;
+		if (!found->name) {
+			printUsage();
+			return 1;
+		}
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+	////////--------------------------------------Run the Suites---------------------------------////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	//Create the globals needed by the suites, without a window or any devices
+	Globals::create(0);
+	if (!Globals::addInterface<Debug::Logger>(Initialisation::LoggerInitialiser())) {
+		printf("Failed to create the Logger\n");
+		Globals::destroy();
+		return 1;
+	}
+
+	//Run the requested suites
+	for (const BenchmarkSuite* current = SUITES; current->name; current++) {
+		if (!suite || !strcmp(current->name, suite)) current->run(settings);
+	}
+
+	//Destroy the globals
+	Globals::destroy();
+
+	//Shutdown the SDL subsystems started by the suites
+	SDL_Quit();
+	return 0;
+}
@@ -14,6 +14,10 @@ using namespace SDL2_Engine;
 #include <Objx_document.hpp>
 #include <Objx_reader.hpp>
 
+//! Include the math functions and limits used to step the animations
+#include <cmath>
+#include <cfloat>
+
 //! Simple/basic clamp macro
 #define CLAMP(VAL, MIN, MAX) ((VAL) < (MIN) ? (VAL) : ((VAL) > (MAX) ? (MAX) : (VAL)))
 
@@ -239,7 +243,7 @@ namespace BombSquad {
 			if (set.timer >= ani.fps) {
 				//Spend the built up time
 				float integral;
-				set.timer = modf(set.timer / ani.fps, &integral) * ani.fps;
+				set.timer = std::modf(set.timer / ani.fps, &integral) * ani.fps;
 
 				//Check if the animation loops
 				if (ani.loop) set.currentFrame = (set.currentFrame + (size_t)integral) % ani.frames.size();
@@ -3,11 +3,16 @@
 //! Include the GLM values
 #include <glm/vec2.hpp>
 
+//! Include the STL hash and fixed width types
+#include <functional>
+#include <cstdint>
+
 namespace std {
 	template<>
 	struct hash<glm::ivec2> {
 		size_t operator()(const glm::ivec2& pVal) const {
-			return (hash<int>()(pVal.x) ^ (hash<int>()(pVal.y) << 1));
+			//Pack both components into a single key so distinct coordinates never share a value before hashing
+			return hash<uint64_t>()(((uint64_t)(uint32_t)pVal.x << 32) | (uint64_t)(uint32_t)pVal.y);
 		}
 	};
 }
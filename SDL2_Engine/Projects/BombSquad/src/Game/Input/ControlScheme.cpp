@@ -43,12 +43,16 @@ namespace BombSquad {
 	/*
 		ControlScheme : Constructor - Initialise with default values
 		Created: 06/11/2017
-		Modified: 06/11/2017
+		Modified: 16/10/2026
 	*/
 	ControlScheme::ControlScheme() :
 		mGamePadID(SDL2_Engine::Input::EGamePadID::Null),
-		mPlayerID(EPlayerNumber::Unassigned)
-	{}
+		mPlayerID(EPlayerNumber::Unassigned),
+		mScripted(nullptr)
+	{
+		//Clear the action handles
+		for (size_t i = 0; i < PLAYER_ACTION_COUNT; i++) mActionHandles[i] = SDL2_Engine::Input::INVALID_AXIS_HANDLE;
+	}
 
 	/*
 		ControlScheme : setGamePadID - Set the Game Pad ID used for the control scheme
@@ -91,10 +95,30 @@ namespace BombSquad {
 		return true;
 	}
 
+	/*
+		ControlScheme : setScriptedInput - Set a ScriptedInput object to read the action values from
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pInput - A pointer to the ScriptedInput object to use (nullptr to use the Axis Input Manager)
+
+		return bool - Returns true if the input was set. Scripted input can not be set if the scheme has been bound
+	*/
+	bool ControlScheme::setScriptedInput(const ScriptedInput* pInput) {
+		//Check scheme is not in use
+		if (mPlayerID != EPlayerNumber::Unassigned) return false;
+
+		//Set the input source
+		mScripted = pInput;
+
+		//Return success
+		return true;
+	}
+
 	/*
 		ControlScheme : bindControlScheme - Bind the currently contained controls to the SDL2_Engine Axis Input Manager
 		Created: 06/11/2017
-		Modified: 06/11/2017
+		Modified: 16/10/2026
 
 		param[in] pPlayerNum - A EPlayerNumber value defining the player the control scheme will be used for
 
@@ -107,6 +131,9 @@ namespace BombSquad {
 		//Store the new player ID value
 		mPlayerID = pPlayerNum;
 
+		//Scripted schemes have nothing to register
+		if (mScripted) return true;
+
 		//Store the formatted first section
 		std::string firstSec = playerNumberToString(mPlayerID) + std::string("_");
 
@@ -125,11 +152,11 @@ namespace BombSquad {
 		//Get the Axis Input object
 		SDL2_Engine::Input::AxisInput& axis = SDL2_Engine::Globals::get<SDL2_Engine::Input::AxisInput>();
 
-		//Store the axis values in the Axis Input object
-		axis.addAxis(mActionControls[EPlayerAction::Move_Vertical]);
-		axis.addAxis(mActionControls[EPlayerAction::Move_Horizontal]);
-		axis.addAxis(mActionControls[EPlayerAction::Place_Bomb]);
-		axis.addAxis(mActionControls[EPlayerAction::Detonate_Mine]);
+		//Store the axis values in the Axis Input object, keeping the handles for polling
+		mActionHandles[(size_t)EPlayerAction::Move_Vertical]	= axis.addAxis(mActionControls[EPlayerAction::Move_Vertical]);
+		mActionHandles[(size_t)EPlayerAction::Move_Horizontal]	= axis.addAxis(mActionControls[EPlayerAction::Move_Horizontal]);
+		mActionHandles[(size_t)EPlayerAction::Place_Bomb]		= axis.addAxis(mActionControls[EPlayerAction::Place_Bomb]);
+		mActionHandles[(size_t)EPlayerAction::Detonate_Mine]	= axis.addAxis(mActionControls[EPlayerAction::Detonate_Mine]);
 
 		//Return success
 		return true;
@@ -138,12 +165,18 @@ namespace BombSquad {
 	/*
 		ControlScheme : unbindControlScheme - Unbind the currently contained controls from the SDL2_Engine Axis Input Manager
 		Created: 06/11/2017
-		Modified: 06/11/2017
+		Modified: 16/10/2026
 	*/
 	void ControlScheme::unbindControlScheme() {
 		//Check scheme is not in use
 		if (mPlayerID == EPlayerNumber::Unassigned) return;
 
+		//Check there are virtual axis to remove
+		if (mScripted) {
+			mPlayerID = EPlayerNumber::Unassigned;
+			return;
+		}
+
 		//Get the Axis Input object
 		SDL2_Engine::Input::AxisInput& axis = SDL2_Engine::Globals::get<SDL2_Engine::Input::AxisInput>();
 
@@ -155,6 +188,7 @@ namespace BombSquad {
 
 		//Clear the Action Lookups
 		mActionLookup.clear();
+		for (size_t i = 0; i < PLAYER_ACTION_COUNT; i++) mActionHandles[i] = SDL2_Engine::Input::INVALID_AXIS_HANDLE;
 
 		//Reset the player ID
 		mPlayerID = EPlayerNumber::Unassigned;
@@ -163,24 +197,36 @@ namespace BombSquad {
 	/*
 		ControlScheme : actionPressed - Check to see if the contained action has been pressed (Button behavior)
 		Created: 06/11/2017
-		Modified: 06/11/2017
+		Modified: 16/10/2026
 
 		param[in] pAction - An EPlayerAction value that defines the Input Values to poll
 
 		return bool - Returns true if the action input was changed this cycle
 	*/
-	bool ControlScheme::actionPressed(const EPlayerAction& pAction) { return SDL2_Engine::Globals::get<SDL2_Engine::Input::AxisInput>().btnPressed(mActionLookup[pAction].c_str()); }
+	bool ControlScheme::actionPressed(const EPlayerAction& pAction) {
+		//Check for scripted input
+		if (mScripted) return mScripted->pressed[(size_t)pAction];
+
+		//Poll the bound virtual axis
+		return SDL2_Engine::Globals::get<SDL2_Engine::Input::AxisInput>().btnPressed(mActionHandles[(size_t)pAction]);
+	}
 
 	/*
 		ControlScheme : actionAxis - Retrieve the axis value for the specified action (Axis behavior)
 		Created: 06/11/2017
-		Modified: 06/11/2017
+		Modified: 16/10/2026
 
 		param[in] pAction - An EPlayerAction value that defines the Input Values to poll
 
 		return const float& - Returns a constant reference to the Virtual Axis value (-1 to 1)
 	*/
-	const float& ControlScheme::actionAxis(const EPlayerAction& pAction) { return SDL2_Engine::Globals::get<SDL2_Engine::Input::AxisInput>().getAxis(mActionLookup[pAction].c_str()); }
+	const float& ControlScheme::actionAxis(const EPlayerAction& pAction) {
+		//Check for scripted input
+		if (mScripted) return mScripted->axis[(size_t)pAction];
+
+		//Poll the bound virtual axis
+		return SDL2_Engine::Globals::get<SDL2_Engine::Input::AxisInput>().getAxis(mActionHandles[(size_t)pAction]);
+	}
 
 	/*
 		ControlScheme : deathVibration - If this Control Scheme is tied to a GamePad, cause the death vibration
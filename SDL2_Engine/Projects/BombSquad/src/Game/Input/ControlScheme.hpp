@@ -14,11 +14,56 @@ namespace BombSquad {
 	//! Store the different actions that can be performed by the player
 	enum class EPlayerAction { Move_Vertical, Move_Horizontal, Place_Bomb, Detonate_Mine };
 
+	//! Store the number of actions that can be performed by the player
+	const size_t PLAYER_ACTION_COUNT = (size_t)EPlayerAction::Detonate_Mine + 1;
+
+	/*
+	 *		Name: ScriptedInput
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Store the action values for a ControlScheme that is driven by code
+	 *		instead of the SDL2_Engine Axis Input Manager (e.g. bots or tests)
+	 *
+	 *		Notes:
+	 *		The owner of the object writes the values before each game play update.
+	 *		Pressed values are reported as is, so they should only be set for the
+	 *		update that the button press should occur on
+	**/
+	struct ScriptedInput {
+		//! Store the axis values for each action (-1 to 1)
+		float axis[PLAYER_ACTION_COUNT];
+
+		//! Flag the actions that are pressed this update
+		bool pressed[PLAYER_ACTION_COUNT];
+
+		/*
+			ScriptedInput : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		inline ScriptedInput() { clear(); }
+
+		/*
+			ScriptedInput : clear - Reset all actions to their resting values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		inline void clear() {
+			for (size_t i = 0; i < PLAYER_ACTION_COUNT; i++) {
+				axis[i] = 0.f;
+				pressed[i] = false;
+			}
+		}
+	};
+
 	/*
 	 *		Name: ControlScheme
 	 *		Author: Mitchell Croft
 	 *		Created: 06/11/2017
-	 *		Modified: 06/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Store the control values used to control the player during game play
@@ -58,10 +103,26 @@ namespace BombSquad {
 		*/
 		bool addActionControl(const EPlayerAction& pAction, const SDL2_Engine::Input::VirtualAxis& pAxis);
 
+		/*
+			ControlScheme : setScriptedInput - Set a ScriptedInput object to read the action values from
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pInput - A pointer to the ScriptedInput object to use (nullptr to use the Axis Input Manager)
+
+			return bool - Returns true if the input was set. Scripted input can not be set if the scheme has been bound
+
+			NOTE:
+			Scripted schemes don't register any Virtual Axis with the Axis Input Manager, so
+			they can be used without any input devices or the Axis Input Manager existing.
+			The ScriptedInput object must outlive the use of the scheme (and any copies of it)
+		*/
+		bool setScriptedInput(const ScriptedInput* pInput);
+
 		/*
 			ControlScheme : bindControlScheme - Bind the currently contained controls to the SDL2_Engine Axis Input Manager
 			Created: 06/11/2017
-			Modified: 06/11/2017
+			Modified: 16/10/2026
 
 			param[in] pPlayerNum - A EPlayerNumber value defining the player the control scheme will be used for
 
@@ -72,7 +133,7 @@ namespace BombSquad {
 		/*
 			ControlScheme : unbindControlScheme - Unbind the currently contained controls from the SDL2_Engine Axis Input Manager
 			Created: 06/11/2017
-			Modified: 06/11/2017
+			Modified: 16/10/2026
 		*/
 		void unbindControlScheme();
 
@@ -83,7 +144,7 @@ namespace BombSquad {
 		/*
 			ControlScheme : actionPressed - Check to see if the contained action has been pressed (Button behavior)
 			Created: 06/11/2017
-			Modified: 06/11/2017
+			Modified: 16/10/2026
 
 			param[in] pAction - An EPlayerAction value that defines the Input Values to poll
 
@@ -94,7 +155,7 @@ namespace BombSquad {
 		/*
 			ControlScheme : actionAxis - Retrieve the axis value for the specified action (Axis behavior)
 			Created: 06/11/2017
-			Modified: 06/11/2017
+			Modified: 16/10/2026
 
 			param[in] pAction - An EPlayerAction value that defines the Input Values to poll
 
@@ -121,5 +182,11 @@ namespace BombSquad {
 
 		//! Store a map of the virtual axis names corresponding to the player ID and action enumeration
 		std::unordered_map<EPlayerAction, std::string> mActionLookup;
+
+		//! Store the Axis Input handles of the bound virtual axis, indexed by the action enumeration
+		SDL2_Engine::Input::vAxisHandle mActionHandles[PLAYER_ACTION_COUNT];
+
+		//! Store the scripted input values that replace the Virtual Axis (nullptr when not scripted)
+		const ScriptedInput* mScripted;
 	};
 }
\ No newline at end of file
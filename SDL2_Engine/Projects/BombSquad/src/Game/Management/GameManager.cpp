@@ -3,8 +3,18 @@
 //! Include the required SDL2_Engine objects
 #include <Globals.hpp>
 #include <Debug/Logger.hpp>
+#include <Input/InputRecorder.hpp>
 #include "../Powerups/PowerupValues.hpp"
 
+//! Include the time functions for seeding new games
+#include <time.h>
+
+//! Include the heap operations for the deadly tiles
+#include <algorithm>
+
+//! Include the clock used to profile updates
+#include <chrono>
+
 using namespace SDL2_Engine;
 
 //! Store the length of time the speed scale to apply to explosion tiles
@@ -14,16 +24,6 @@ namespace BombSquad {
 	//! Define the singleton instance
 	GameManager* GameManager::mInstance = nullptr;
 
-	/*
-		random - Get a 'random' float value in the scale of 0 - 1 (inclusive)
-		Author: Mitchell Croft
-		Created: 09/11/2017
-		Modified: 09/11/2017
-
-		return float - Returns a float value in the 0 - 1 range
-	*/
-	inline float random() { return ((float)rand() / (float)RAND_MAX); }
-
 	/*
 		sign - Get the sign of the specified value
 		Author: Mitchell Croft
@@ -39,22 +39,43 @@ namespace BombSquad {
 	template<typename T>
 	inline T sign(const T& pVal) { return (pVal < (T)0 ? (T)-1 : (T)1); }
 
+	/*
+		accumulateLap - Add the time since a marked point to a total and move the mark to the current time
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in/out] pTotal - The total to add the elapsed time to (in milliseconds)
+		param[in/out] pMark - The time point to measure from, receiving the current time
+	*/
+	inline void accumulateLap(double& pTotal, std::chrono::steady_clock::time_point& pMark) {
+		const auto NOW = std::chrono::steady_clock::now();
+		pTotal += std::chrono::duration<double, std::milli>(NOW - pMark).count();
+		pMark = NOW;
+	}
+
 	/*
 		GameManager : create - Create the singleton instance
 		Created: 10/11/2017
-		Modified: 10/11/2017
+		Modified: 16/10/2026
+
+		param[in] pHeadless - Flags if the Game Manager is used without rendering (Default false)
 
 		return bool - Returns true if the Game Manager was created successfully
 	*/
-	bool GameManager::create() {
+	bool GameManager::create(const bool& pHeadless) {
 		//Ensure that the instance hasn't been created yet
 		assert(!mInstance);
 
 		//Create the singleton instance
 		mInstance = new GameManager();
+		mInstance->mHeadless = pHeadless;
 
 		//Load the initial powerups 
-		mInstance->mBlueprints = mInstance->mPowerLoader.loadDirectory("resources/Powerups/");
+		mInstance->mBlueprints = mInstance->mPowerLoader.loadDirectory("resources/Powerups/", pHeadless);
+
+		//Use the seed of an input recording so that replayed games match
+		if (!pHeadless && Globals::interfaceExists<Input::InputRecorder>()) mInstance->mSeed = Globals::get<Input::InputRecorder>().getSeed();
 
 		//Return success
 		return true;
@@ -74,13 +95,14 @@ namespace BombSquad {
 			mInstance->mPlayers.clear();
 			
 			//Clear all active powerups
-			mInstance->mPowerups.clear();
+			mInstance->mPowerups.dispose();
 			mInstance->mBlueprints.clear();
 			mInstance->mPowerLoader.dispose();
 
 			//Clear the bombs
-			mInstance->mBombs.clear();
+			mInstance->mBombs.dispose();
 			mInstance->mDeadlyTiles.dispose();
+			mInstance->mDeadlyQueue.clear();
 
 			//Clear the Singleton instance
 			delete mInstance;
@@ -91,7 +113,7 @@ namespace BombSquad {
 	/*
 		GameManager : setPlayerControls - Set the control schemes the players will use to control their characters
 		Created: 10/11/2017
-		Modified: 10/11/2017
+		Modified: 16/10/2026
 
 		param[in] pSchemes - A standard vector of ControlScheme objects to use
 
@@ -122,7 +144,7 @@ namespace BombSquad {
 			curr.id = (EPlayerID)i;
 
 			//Setup the player animator
-			if (!curr.animator.loadAnimations("resources/Animations/playerAnimations.objx", PLAYER_ANIM_NAMES[i])) {
+			if (!mInstance->mHeadless && !curr.animator.loadAnimations("resources/Animations/playerAnimations.objx", PLAYER_ANIM_NAMES[i])) {
 				Globals::get<Debug::Logger>().logError("The Game Manager failed to load the animations for '%s' with the same name in the file 'resources/Animations/playerAnimations.objx'", PLAYER_ANIM_NAMES[i]);
 			}
 
@@ -139,7 +161,7 @@ namespace BombSquad {
 	/*
 		GameManager : setupNewMap - Reset all values for a new game
 		Created: 10/11/2017
-		Modified: 13/11/2017
+		Modified: 16/10/2026
 	*/
 	void GameManager::setupNewGame() {
 		//Clear all active powerups
@@ -148,13 +170,36 @@ namespace BombSquad {
 		//Clear the bombs
 		mInstance->mBombs.clear();
 		mInstance->mDeadlyTiles.dispose();
+		mInstance->mDeadlyQueue.clear();
+
+		//Reset the match time
+		mInstance->mMatchTime = 0.0;
+
+		//Seed the random events of the game
+		mInstance->mMatchSeed = (mInstance->mSeed ? mInstance->mSeed : (uint64_t)time(NULL));
+		mInstance->mRandom.seed(mInstance->mMatchSeed);
+
+		//Derive the map seed from the game's generator, avoiding the time based value
+		const uint64_t MAP_SEED = mInstance->mRandom.next();
+		mInstance->mGenerator.setSeed(MAP_SEED ? MAP_SEED : 1);
 
 		//Generate the new map
-		mInstance->mCurrentMap = mInstance->mGenerator.generateMap(mInstance->mMapWidth, mInstance->mMapHeight, mInstance->mPlayers.size());
+		mInstance->mCurrentMap = mInstance->mGenerator.generateMap(mInstance->mMapWidth, mInstance->mMapHeight, mInstance->mPlayers.size(), &mInstance->mGenerationReport);
+
+		//Clear the changes made to the previous map
+		mInstance->mChangedTiles.clear();
+
+		//Output the generation timings
+		const MapGenerationReport& report = mInstance->mGenerationReport;
+		if (!mInstance->mHeadless) Globals::get<Debug::Logger>().logFormatted("Generated a %zux%zu map for match seed %llu in %.2fms (%zu attempt(s) across %zu worker(s), slowest attempt %.2fms)", mInstance->mMapWidth, mInstance->mMapHeight, (unsigned long long)mInstance->mMatchSeed, report.milliseconds, report.attempts.size(), report.workers, report.slowestAttempt());
 
 		//Create the deadly tile map
 		mInstance->mDeadlyTiles.setBounds(mInstance->mCurrentMap.width(), mInstance->mCurrentMap.height());
 
+		//Setup the bomb and powerup occupancy for the map
+		mInstance->mBombs.setBounds(mInstance->mCurrentMap.width(), mInstance->mCurrentMap.height());
+		mInstance->mPowerups.setBounds(mInstance->mCurrentMap.width(), mInstance->mCurrentMap.height());
+
 		//Loop through and setup the players
 		size_t index = 0;
 		for (size_t x = 0; x < mInstance->mCurrentMap.width() && index != mInstance->mPlayers.size(); x++) {
@@ -193,11 +238,16 @@ namespace BombSquad {
 	/*
 		GameManager : update - Update the current game state values
 		Created: 10/11/2017
-		Modified: 28/11/2017
+		Modified: 16/10/2026
 
 		param[in] pDelta - The delta time for the current cycle
 	*/
 	void GameManager::update(const float& pDelta) {
+		//Start timing the update
+		const bool PROFILE = mInstance->mProfiling;
+		std::chrono::steady_clock::time_point mark;
+		if (PROFILE) mark = std::chrono::steady_clock::now();
+
 		//Count the number of alive players
 		size_t alive = 0;
 
@@ -295,36 +345,47 @@ namespace BombSquad {
 				//Ensure the game isnt over
 				if (!mInstance->mGameOver) {
 					//Check for powerup collection
-					auto powerup = mInstance->mPowerups.find(curr.position);
-					if (powerup != mInstance->mPowerups.end()) {
+					const Powerup** found = mInstance->mPowerups.find(curr.position);
+					if (found) {
+						//Get the collected powerup and the tile it was on
+						const Powerup& POWERUP = **found;
+						const coord TILE = curr.position;
+
 						//Get the actor who is effected
-						const EPowerupActor& ACTOR = powerup->second->getActor();
+						const EPowerupActor& ACTOR = POWERUP.getActor();
 
 						//Store a pointer to the actor to affect
 						Player* toEffect = nullptr;
 
 						//Find the player to affect
-						switch (ACTOR) {
-						case EPowerupActor::Self: toEffect = &curr; break;
-						case EPowerupActor::Enemy:
-							do {
-								toEffect = &mInstance->mPlayers[rand() % mInstance->mPlayers.size()];
-							} while (!toEffect || !toEffect->alive || toEffect->id == curr.id);
-							break;
-						case EPowerupActor::Random:
-							do {
-								toEffect = &mInstance->mPlayers[rand() % mInstance->mPlayers.size()];
-							} while (!toEffect || !toEffect->alive);
+						if (ACTOR == EPowerupActor::Self) toEffect = &curr;
+						else {
+							//Check if a player is a valid target
+							auto isTarget = [&](const Player& pPlayer) { return pPlayer.alive && (ACTOR == EPowerupActor::Random || pPlayer.id != curr.id); };
+
+							//Count the valid targets, as there may be none left alive
+							size_t targets = 0;
+							for (size_t p = 0; p < mInstance->mPlayers.size(); p++)
+								targets += (isTarget(mInstance->mPlayers[p]) ? 1 : 0);
+
+							//Select one of the targets
+							if (targets) {
+								size_t pick = (size_t)mInstance->mRandom.range(targets);
+								for (size_t p = 0; !toEffect; p++) {
+									if (isTarget(mInstance->mPlayers[p]) && !pick--)
+										toEffect = &mInstance->mPlayers[p];
+								}
+							}
 						}
 
 						//Get the mask for the powerup
-						const auto& MASK = powerup->second->getMask();
+						const auto& MASK = POWERUP.getMask();
 
 						//Check for detonate all flag
 						if (MASK & EPowerupEffectFlags::Detonate_All) {
 							//'Detonate' all the bombs
 							for (auto it = mInstance->mBombs.begin(); it != mInstance->mBombs.end(); ++it)
-								it->second.timer = 0.f;
+								it->value.timer = 0.f;
 						}
 
 						//Ensure there is an actor for the remaining powerups
@@ -348,7 +409,7 @@ namespace BombSquad {
 								}
 
 								//Move the target to the random coordinate
-								toEffect->position = available[rand() % available.size()];
+								toEffect->position = available[mInstance->mRandom.range(available.size())];
 							}
 
 							//Check if the powerup is a one off only
@@ -358,11 +419,11 @@ namespace BombSquad {
 									MASK == EPowerupEffectFlags::Teleport));
 
 							//Otherwise apply the powerup to the target
-							else toEffect->properties += *powerup->second;
+							else toEffect->properties += POWERUP;
 						}
 
-						//Remove the powerup from the list
-						mInstance->mPowerups.erase(powerup);
+						//Remove the powerup from the map
+						mInstance->mPowerups.erase(TILE);
 					}
 
 					//Check for bomb placement
@@ -380,16 +441,16 @@ namespace BombSquad {
 						newBomb.fuseLength = newBomb.timer = curr.properties.getFuseLength();
 
 						//Add a new bomb to the list
-						mInstance->mBombs.insert(std::pair<coord, Bomb>(curr.position, newBomb));
+						mInstance->mBombs.insert(curr.position, newBomb);
 					}
 
 					//Check for mine detonation
 					if (curr.controls.actionPressed(EPlayerAction::Detonate_Mine)) {
 						//Loop through available bombs and look for linked IDs
 						for (auto it = mInstance->mBombs.begin(); it != mInstance->mBombs.end(); ++it) {
-							if (it->second.owner == curr.id &&		//Check for ID match
-								it->second.isMine)					//Check the bomb is a mine
-								it->second.timer = 0.f;
+							if (it->value.owner == curr.id &&		//Check for ID match
+								it->value.isMine)					//Check the bomb is a mine
+								it->value.timer = 0.f;
 						}
 					}
 				}
@@ -412,29 +473,36 @@ namespace BombSquad {
 			alive += (curr.alive ? 1 : 0);
 		}
 
+		//Record the time spent on the players
+		if (PROFILE) accumulateLap(mInstance->mTimings.players, mark);
+
 		//Update the bombs
-		for (auto it = mInstance->mBombs.begin(); it != mInstance->mBombs.end();) {
+		for (size_t b = 0; b < mInstance->mBombs.size();) {
+			//Get the current bomb and its position
+			Bomb& bomb = mInstance->mBombs[b].value;
+			const coord POS = mInstance->mBombs[b].position;
+
 			//Burn fuse if bomb is not a mine
-			if (!it->second.isMine) it->second.timer -= pDelta;
+			if (!bomb.isMine) bomb.timer -= pDelta;
 
 			//Check if the bomb has 'exploded'
-			if (it->second.timer <= 0.f) {
+			if (bomb.timer <= 0.f) {
 				//Free up one of the owners bomb allocations
-				mInstance->mPlayers[(int)it->second.owner].placedBombs--;
+				mInstance->mPlayers[(int)bomb.owner].placedBombs--;
 
 				//Store an array of the directions to apply destruction
 				const coord OFFSETS[] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
 				const size_t OFFSET_COUNT = sizeof(OFFSETS) / sizeof(const coord);
 
 				//Get the blast radius
-				const int& BLST_RAD = it->second.radius;
+				const int& BLST_RAD = bomb.radius;
 
 				//Loop through the offset directions to apply blasts to
 				for (size_t off = 0; off < OFFSET_COUNT; off++) {
 					//Loop through for the radius
 					for (int i = (off ? 1 : 0); i < BLST_RAD; i++) {
 						//Get the coordinate to process
-						const coord BLST = it->first + OFFSETS[off] * i;
+						const coord BLST = POS + OFFSETS[off] * i;
 
 						//Check the coordinate is on the map
 						if (BLST.x < 0 || BLST.y < 0 ||
@@ -449,60 +517,68 @@ namespace BombSquad {
 							//Set the tile to free
 							mInstance->mCurrentMap[BLST.x][BLST.y] = ETileType::Free;
 
+							//Record the change for the renderer
+							if (!mInstance->mHeadless) mInstance->mChangedTiles.push_back(BLST);
+
 							//Check for powerup drop
-							if (mInstance->mBlueprints.size() && random() <= mInstance->mPowerupChance) 
-								mInstance->mPowerups.insert(std::pair<coord, const Powerup*>(BLST, &mInstance->mBlueprints[rand() % mInstance->mBlueprints.size()]));
+							if (mInstance->mBlueprints.size() && mInstance->mRandom.chance(mInstance->mPowerupChance)) 
+								mInstance->mPowerups.insert(BLST, &mInstance->mBlueprints[mInstance->mRandom.range(mInstance->mBlueprints.size())]);
 
 							//Stop the explosion short
 							break;
 						}
 
-						//Check for powerup
-						auto powerup = mInstance->mPowerups.find(BLST);
-						if (powerup != mInstance->mPowerups.end()) {
-							//Destroy the powerup
-							mInstance->mPowerups.erase(powerup);
-
+						//Check for powerup, destroying it
+						if (mInstance->mPowerups.erase(BLST)) {
 							//Stop the explosion short
 							break;
 						}
 
 						//Check for bomb
-						auto bomb = mInstance->mBombs.find(BLST);
-						if (bomb != mInstance->mBombs.end() && bomb != it) {
+						Bomb* other = mInstance->mBombs.find(BLST);
+						if (other && other != &bomb) {
 							//Flag the bomb for processed 'destruction'
-							bomb->second.timer = 0.f;
+							other->timer = 0.f;
 
 							//Stop the explosion short
 							break;
 						}
 
-						//Flag the tile as deadly
-						mInstance->mDeadlyTiles[BLST.x][BLST.y] = 1.f;
+						//Flag the tile as deadly until the explosion finishes
+						const double EXPIRY = mInstance->mMatchTime + 1.0 / EXPLOSION_SPEED_MULT;
+						mInstance->mDeadlyTiles[BLST.x][BLST.y] = EXPIRY;
+						mInstance->mDeadlyQueue.push_back({ EXPIRY, BLST });
+						std::push_heap(mInstance->mDeadlyQueue.begin(), mInstance->mDeadlyQueue.end(), isLaterExpiry);
 					}
 				}
 
-				//Remove the bomb from the list
-				mInstance->mBombs.erase(it++);
+				//Remove the bomb from the map, moving the last bomb to the current index
+				mInstance->mBombs.erase(POS);
 			}
 
-			//Increment the iterator
-			else ++it;
+			//Move to the next bomb
+			else ++b;
 		}
 
-		//Update the deadly tiles
-		for (size_t x = 0; x < mInstance->mDeadlyTiles.width(); x++) {
-			for (size_t y = 0; y < mInstance->mDeadlyTiles.height(); y++) {
-				//Check if the tile needs processing
-				if (mInstance->mDeadlyTiles[x][y]) {
-					//Subtract from the timer value
-					mInstance->mDeadlyTiles[x][y] -= EXPLOSION_SPEED_MULT * pDelta;
-
-					//Check for sub zero
-					if (mInstance->mDeadlyTiles[x][y] < 0.f)
-						mInstance->mDeadlyTiles[x][y] = 0.f;
-				}
-			}
+		//Record the time spent on the bombs
+		if (PROFILE) accumulateLap(mInstance->mTimings.bombs, mark);
+
+		//Advance the match time
+		mInstance->mMatchTime += pDelta;
+
+		//Clear the deadly tiles that have expired
+		std::vector<DeadlyTile>& queue = mInstance->mDeadlyQueue;
+		while (queue.size() && queue.front().expiry <= mInstance->mMatchTime) {
+			//Get the deadly time of the tile
+			const DeadlyTile& FRONT = queue.front();
+			double& expiry = mInstance->mDeadlyTiles[FRONT.position.x][FRONT.position.y];
+
+			//Clear the tile if a later explosion hasn't extended it
+			if (expiry == FRONT.expiry) expiry = 0.0;
+
+			//Remove the entry
+			std::pop_heap(queue.begin(), queue.end(), isLaterExpiry);
+			queue.pop_back();
 		}
 
 		//Check for match over
@@ -520,12 +596,36 @@ namespace BombSquad {
 			//Flag the game over
 			mInstance->mGameOver = true;
 		}
+
+		//Record the time spent on the deadly tiles
+		if (PROFILE) {
+			accumulateLap(mInstance->mTimings.deadlyTiles, mark);
+			mInstance->mTimings.updates++;
+		}
+	}
+
+	/*
+		GameManager : getDeadlyScale - Get the remaining deadly time of a tile on the current map
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pX - The x index of the tile
+		param[in] pY - The y index of the tile
+
+		return float - Returns the remaining time in a 0 - 1 scale, or 0.f if the tile isn't deadly
+	*/
+	float GameManager::getDeadlyScale(const size_t& pX, const size_t& pY) {
+		//Get the time the tile stops being deadly
+		const double& EXPIRY = mInstance->mDeadlyTiles[pX][pY];
+
+		//Scale the remaining time
+		return (EXPIRY ? (float)((EXPIRY - mInstance->mMatchTime) * EXPLOSION_SPEED_MULT) : 0.f);
 	}
 
 	/*
 		GameManager : isTileBlocked - Check to see if a specific tile is currently blocked
 		Created: 12/11/2017
-		Modified: 13/11/2017
+		Modified: 16/10/2026
 
 		param[in] pPos - A coord object containing the positions to check
 
@@ -543,17 +643,22 @@ namespace BombSquad {
 			return true;
 
 		//Check if there is a bomb at the coordinate
-		else return (mInstance->mBombs.find(pPos) != mInstance->mBombs.end());
+		else return mInstance->mBombs.contains(pPos);
 	}
 
 	/*
 		GameManager : Constructor - Initialise with default values
 		Created: 10/11/2017
-		Modified: 13/11/2017
+		Modified: 16/10/2026
 	*/
 	GameManager::GameManager() : 
 		mGameOver(true),
 		mMapWidth(0), 
-		mMapHeight(0)
+		mMapHeight(0),
+		mSeed(0),
+		mHeadless(false),
+		mProfiling(false),
+		mMatchSeed(0),
+		mMatchTime(0.0)
 	{}
 }
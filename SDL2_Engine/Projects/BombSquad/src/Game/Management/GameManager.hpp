@@ -5,13 +5,32 @@
 #include "../GameObjects/Bomb.hpp"
 #include "../Powerups/PowerupLoader.hpp"
 #include "../MapGeneration/MapGenerator.hpp"
+#include "TilePool.hpp"
+
+//! Include the random number generator used for game play
+#include <Utilities/Random.hpp>
 
 namespace BombSquad {
+	//! Store the accumulated time spent in each section of the game play update
+	struct UpdateTimings {
+		//! The number of updates that were timed
+		size_t updates = 0;
+
+		//! The time spent updating the players, their input and powerup collection (in milliseconds)
+		double players = 0.0;
+
+		//! The time spent updating the bombs and their explosions (in milliseconds)
+		double bombs = 0.0;
+
+		//! The time spent expiring deadly tiles and checking for the end of the match (in milliseconds)
+		double deadlyTiles = 0.0;
+	};
+
 	/*
 	 *		Name: GameManager
 	 *		Author: Mitchell Croft
 	 *		Created: 10/11/2017
-	 *		Modified: 28/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Manage the aspects relating to game play and its setup
@@ -24,11 +43,18 @@ namespace BombSquad {
 		/*
 			GameManager : create - Create the singleton instance
 			Created: 10/11/2017
-			Modified: 10/11/2017
+			Modified: 16/10/2026
+
+			param[in] pHeadless - Flags if the Game Manager is used without rendering (Default false)
 
 			return bool - Returns true if the Game Manager was created successfully
+
+			NOTE:
+			A headless Game Manager loads the powerup blueprints without their textures and doesn't
+			load the player animations, so it can be used without a Renderer. The Resources and
+			Math interfaces are still required to read the blueprints
 		*/
-		static bool create();
+		static bool create(const bool& pHeadless = false);
 
 		/*
 			GameManager : destroy - Deallocate memory used by Game Manager
@@ -80,6 +106,15 @@ namespace BombSquad {
 		*/
 		static void setObstacleDensity(const float& pChance) { mInstance->mGenerator.setObstacleChance(pChance); }
 
+		/*
+			GameManager : setGenerationWorkers - Set the number of threads used to generate maps
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pCount - The number of threads to use (Where 0 uses one less than the hardware supports)
+		*/
+		inline static void setGenerationWorkers(const size_t& pCount) { mInstance->mGenerator.setWorkerCount(pCount); }
+
 		/*
 			GameManager : setPowerupChance - Set the chance of a powerup being dropped when an obstacle is destroyed
 			Created: 10/11/2017
@@ -89,20 +124,51 @@ namespace BombSquad {
 		*/
 		static void setPowerupChance(const float& pChance) { mInstance->mPowerupChance = pChance; }
 
+		/*
+			GameManager : setSeed - Set the seed used to generate the map and random events of new games
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeed - The seed value to use (Where 0 uses a new seed from the time for each game)
+
+			NOTE:
+			Using the seed of a previous game (See getMatchSeed) will reproduce the map and
+			the random draws made for the same sequence of game play events
+		*/
+		static void setSeed(const uint64_t& pSeed) { mInstance->mSeed = pSeed; }
+
+		/*
+			GameManager : getMatchSeed - Get the seed that the current game was setup with
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const uint64_t& - Returns a constant reference to the internal value
+		*/
+		inline static const uint64_t& getMatchSeed() { return mInstance->mMatchSeed; }
+
+		/*
+			GameManager : setProfiling - Set if the time spent in the sections of update should be recorded
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pState - Flags if the timings should be recorded
+		*/
+		inline static void setProfiling(const bool& pState) { mInstance->mProfiling = pState; }
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////----------------------------------------Gameplay-------------------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		/*
 			GameManager : setupNewMap - Reset all values for a new game
 			Created: 10/11/2017
-			Modified: 13/11/2017
+			Modified: 16/10/2026
 		*/
 		static void setupNewGame();
 
 		/*
 			GameManager : update - Update the current game state values 
 			Created: 10/11/2017
-			Modified: 28/11/2017
+			Modified: 16/10/2026
 
 			param[in] pDelta - The delta time for the current cycle
 		*/
@@ -161,35 +227,103 @@ namespace BombSquad {
 		/*
 			GameManager : getBombs - Get the bombs currently on the map
 			Created: 10/11/2017
-			Modified: 10/11/2017
+			Modified: 16/10/2026
 
-			return const unordered_map<coord, Bomb>& - Returns a constant reference to the internal value, where the keys
-													   for the objects are their location on the current map
+			return const TilePool<Bomb>& - Returns a constant reference to the internal value, where each entry
+										   stores the location of the object on the current map
 		*/
-		inline static const std::unordered_map<coord, Bomb>& getBombs() { return mInstance->mBombs; }
+		inline static const TilePool<Bomb>& getBombs() { return mInstance->mBombs; }
 
 		/*
-			GameManager : getDeadlyTiles - Get the map of currently deadly tiles
+			GameManager : getDeadlyScale - Get the remaining deadly time of a tile on the current map
 			Created: 10/11/2017
-			Modified: 10/11/2017
+			Modified: 16/10/2026
+
+			param[in] pX - The x index of the tile
+			param[in] pY - The y index of the tile
 
-			return const Map<float>& - Returns a constant reference to the internal value
+			return float - Returns the remaining time in a 0 - 1 scale, or 0.f if the tile isn't deadly
 
 			NOTE:
-			All indexs with values != 0.f are considered deadly, where the values are in a 0 - 1 scale
+			All tiles with values != 0.f are considered deadly
 			The transition from 1 to 0 is the progress through any animation that is desired to be played
 		*/
-		inline static const Map<float>& getDeadlyTiles() { return mInstance->mDeadlyTiles; }
+		static float getDeadlyScale(const size_t& pX, const size_t& pY);
+
+		/*
+			GameManager : getChangedTiles - Get the tiles of the current map that have changed type
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const coords& - Returns a constant reference to the tiles changed since the last call to clearChangedTiles
+
+			NOTE:
+			The list is emptied when a new map is generated and isn't recorded when running headless
+		*/
+		inline static const coords& getChangedTiles() { return mInstance->mChangedTiles; }
+
+		/*
+			GameManager : clearChangedTiles - Empty the list of tiles that have changed type
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		inline static void clearChangedTiles() { mInstance->mChangedTiles.clear(); }
 
 		/*
 			GameManager : getActivePowerups - Get the powerups currently on the map
 			Created: 10/11/2017
-			Modified: 10/11/2017
+			Modified: 16/10/2026
+
+			return const TilePool<const Powerup*>& - Returns a constant reference to the internal value, where each entry
+													 stores the location of the object on the current map
+		*/
+		inline static const TilePool<const Powerup*>& getActivePowerups() { return mInstance->mPowerups; }
+
+		/*
+			GameManager : isGameOver - Check if the current match has finished
+			Created: 16/10/2026
+			Modified: 16/10/2026
 
-			return const unordered_map<coord, const Powerup*>& - Returns a constant reference to the internal value, where the keys
-																 for the objects are their location on the current map
+			return const bool& - Returns a constant reference to the internal value
 		*/
-		inline static const std::unordered_map<coord, const Powerup*>& getActivePowerups() { return mInstance->mPowerups; }
+		inline static const bool& isGameOver() { return mInstance->mGameOver; }
+
+		/*
+			GameManager : getMatchTime - Get the time that has passed in the current match
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const double& - Returns a constant reference to the internal value (in seconds)
+		*/
+		inline static const double& getMatchTime() { return mInstance->mMatchTime; }
+
+		/*
+			GameManager : getGenerationReport - Get the report of the generation of the current map
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const MapGenerationReport& - Returns a constant reference to the internal value
+		*/
+		inline static const MapGenerationReport& getGenerationReport() { return mInstance->mGenerationReport; }
+
+		/*
+			GameManager : getTimings - Get the time spent in the sections of update since the timings were reset
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const UpdateTimings& - Returns a constant reference to the internal value
+
+			NOTE:
+			Timings are only recorded while profiling is enabled (See setProfiling)
+		*/
+		inline static const UpdateTimings& getTimings() { return mInstance->mTimings; }
+
+		/*
+			GameManager : resetTimings - Clear the recorded update timings
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		inline static void resetTimings() { mInstance->mTimings = UpdateTimings(); }
 
 	private:
 		//! Store singleton values
@@ -218,6 +352,18 @@ namespace BombSquad {
 		//! Store the chance of spawning a powerup on obstacle destruction
 		float mPowerupChance;
 
+		//! Store the seed used to setup new games (0 is time based)
+		uint64_t mSeed;
+
+		//! Flag if the Game Manager is running without rendering
+		bool mHeadless;
+
+		//! Flag if the update timings should be recorded
+		bool mProfiling;
+
+		//! Store the accumulated update timings
+		UpdateTimings mTimings;
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////-----------------------------------Gameplay Objects----------------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -225,17 +371,44 @@ namespace BombSquad {
 		//! Flag if the match is over
 		bool mGameOver;
 
+		//! Store the seed the current game was setup with
+		uint64_t mMatchSeed;
+
+		//! Store the random number generator used for the random events of the current game
+		SDL2_Engine::Utilities::Random mRandom;
+
 		//! Store the map the players are currently on
 		gameMap mCurrentMap;
 
+		//! Store the tiles of the current map that have changed type
+		coords mChangedTiles;
+
+		//! Store the report from generating the current map
+		MapGenerationReport mGenerationReport;
+
 		//! Store the currently active bombs on the map
-		std::unordered_map<coord, Bomb> mBombs;
+		TilePool<Bomb> mBombs;
+
+		//! Store the time that has passed in the current game
+		double mMatchTime;
+
+		//! Store the time that each tile stops being deadly (0 for tiles that aren't deadly)
+		Map<double> mDeadlyTiles;
+
+		//! Store a deadly tile entry, ordered by the time it expires
+		struct DeadlyTile {
+			double expiry;
+			coord position;
+		};
+
+		//! Store the deadly tiles as a min-heap of expiry times
+		std::vector<DeadlyTile> mDeadlyQueue;
 
-		//! Store a map of the tiles on the map which are deadly
-		Map<float> mDeadlyTiles;
+		//! Order the deadly tile heap so the earliest expiry is at the front
+		inline static bool isLaterExpiry(const DeadlyTile& pLeft, const DeadlyTile& pRight) { return pLeft.expiry > pRight.expiry; }
 
 		//! Store the available powerups on the map
-		std::unordered_map<coord, const Powerup*> mPowerups;
+		TilePool<const Powerup*> mPowerups;
 	};
 
 	//! Create a shorthand type define
@@ -0,0 +1,224 @@
+#pragma once
+
+//! Include the STL vector for the packed objects
+#include <vector>
+
+//! Include the coordinate values
+#include "../GameObjects/GameObjectValues.hpp"
+
+//! Include the Map object for the occupancy grid
+#include "../MapGeneration/Map.hpp"
+
+namespace BombSquad {
+	/*
+	 *		Name: TilePool
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Template T - The type of object stored on the tiles
+	 *
+	 *		Purpose:
+	 *		Store at most one object per tile of the game map, allowing an object
+	 *		to be found from its tile by indexing and all objects to be iterated
+	 *		over as a contiguous array
+	 *
+	 *		Notes:
+	 *		The objects are packed into a single array, with each tile of the
+	 *		occupancy grid storing the index of its object plus one (0 for empty).
+	 *		Erasing an object moves the last object into its place, so erasing
+	 *		during iteration must revisit the current index. Pointers to the
+	 *		objects are invalidated by insert and erase.
+	 *
+	 *		Coordinates passed to the pool must be within the bounds it was given
+	**/
+	template<typename T>
+	class TilePool {
+	public:
+		//! Store an object along with the tile it occupies
+		struct Entry {
+			coord position;
+			T value;
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////---------------------------------------Construction----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			TilePool : setBounds - Setup the pool for a map with a set of dimensions
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pWidth - The width of the map
+			param[in] pHeight - The height of the map
+
+			NOTE:
+			This function removes all objects from the pool
+		*/
+		inline void setBounds(const size_t& pWidth, const size_t& pHeight) {
+			mEntries.clear();
+			mGrid.setBounds(pWidth, pHeight);
+		}
+
+		/*
+			TilePool : clear - Remove all objects from the pool
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		inline void clear() {
+			for (size_t i = 0; i < mEntries.size(); i++)
+				mGrid[mEntries[i].position.x][mEntries[i].position.y] = 0;
+			mEntries.clear();
+		}
+
+		/*
+			TilePool : dispose - Remove all objects and release the occupancy grid
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		inline void dispose() {
+			mEntries.clear();
+			mGrid.dispose();
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////------------------------------------------Lookup-------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			TilePool : find - Get the object occupying a tile
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPos - The coordinate of the tile
+
+			return T* - Returns a pointer to the object or nullptr if the tile is empty
+		*/
+		inline T* find(const coord& pPos) {
+			const size_t SLOT = mGrid[pPos.x][pPos.y];
+			return (SLOT ? &mEntries[SLOT - 1].value : nullptr);
+		}
+
+		/*
+			TilePool : find - Get the object occupying a tile
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPos - The coordinate of the tile
+
+			return const T* - Returns a constant pointer to the object or nullptr if the tile is empty
+		*/
+		inline const T* find(const coord& pPos) const {
+			const size_t SLOT = mGrid[pPos.x][pPos.y];
+			return (SLOT ? &mEntries[SLOT - 1].value : nullptr);
+		}
+
+		/*
+			TilePool : contains - Check if a tile is occupied
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPos - The coordinate of the tile
+
+			return bool - Returns true if there is an object on the tile
+		*/
+		inline bool contains(const coord& pPos) const { return mGrid[pPos.x][pPos.y] != 0; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////----------------------------------------Modifiers------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			TilePool : insert - Add an object to an empty tile
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPos - The coordinate of the tile
+			param[in] pValue - The object to store on the tile
+
+			return bool - Returns true if the object was added or false if the tile was occupied
+		*/
+		inline bool insert(const coord& pPos, const T& pValue) {
+			//Check the tile is empty
+			size_t& slot = mGrid[pPos.x][pPos.y];
+			if (slot) return false;
+
+			//Add the object
+			mEntries.push_back({ pPos, pValue });
+			slot = mEntries.size();
+			return true;
+		}
+
+		/*
+			TilePool : erase - Remove the object occupying a tile
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPos - The coordinate of the tile
+
+			return bool - Returns true if an object was removed
+		*/
+		inline bool erase(const coord& pPos) {
+			//Check there is an object to remove
+			size_t& slot = mGrid[pPos.x][pPos.y];
+			if (!slot) return false;
+
+			//Move the last object into the vacated index
+			const size_t INDEX = slot - 1;
+			slot = 0;
+			if (INDEX + 1 != mEntries.size()) {
+				mEntries[INDEX] = std::move(mEntries.back());
+				mGrid[mEntries[INDEX].position.x][mEntries[INDEX].position.y] = INDEX + 1;
+			}
+			mEntries.pop_back();
+			return true;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////----------------------------------------Iteration------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			TilePool : size - Get the number of objects in the pool
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the number of objects
+		*/
+		inline size_t size() const { return mEntries.size(); }
+
+		/*
+			TilePool : Subscript Operator - Access the packed objects by index
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pIndex - The index of the object in the range [0, size())
+
+			return Entry& - Returns a reference to the object and its tile
+		*/
+		inline Entry& operator[](const size_t& pIndex) { return mEntries[pIndex]; }
+
+		/*
+			TilePool : Const Subscript Operator - Access the packed objects by index
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pIndex - The index of the object in the range [0, size())
+
+			return const Entry& - Returns a constant reference to the object and its tile
+		*/
+		inline const Entry& operator[](const size_t& pIndex) const { return mEntries[pIndex]; }
+
+		//! Iterate over the packed objects
+		inline typename std::vector<Entry>::iterator begin() { return mEntries.begin(); }
+		inline typename std::vector<Entry>::iterator end() { return mEntries.end(); }
+		inline typename std::vector<Entry>::const_iterator begin() const { return mEntries.cbegin(); }
+		inline typename std::vector<Entry>::const_iterator end() const { return mEntries.cend(); }
+		inline typename std::vector<Entry>::const_iterator cbegin() const { return mEntries.cbegin(); }
+		inline typename std::vector<Entry>::const_iterator cend() const { return mEntries.cend(); }
+
+	private:
+		//! Store the objects in a contiguous array
+		std::vector<Entry> mEntries;
+
+		//! Store the index plus one of the object occupying each tile (0 for empty)
+		Map<size_t> mGrid;
+	};
+}
@@ -0,0 +1,193 @@
+#include "CellBoard.hpp"
+
+namespace BombSquad {
+	/*
+		countBits - Count the number of set bits in a 64 bit word
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pWord - The word to count the bits of
+
+		return size_t - Returns the number of set bits
+	*/
+	inline size_t countBits(uint64_t pWord) {
+		pWord = pWord - ((pWord >> 1) & 0x5555555555555555ULL);
+		pWord = (pWord & 0x3333333333333333ULL) + ((pWord >> 2) & 0x3333333333333333ULL);
+		pWord = (pWord + (pWord >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (size_t)((pWord * 0x0101010101010101ULL) >> 56);
+	}
+
+	/*
+		fullAdd - Add three bit planes together, 64 cells at a time
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pA - The first bit plane
+		param[in] pB - The second bit plane
+		param[in] pC - The third bit plane
+		param[out] pSum - Receives the ones bit of the sums
+		param[out] pCarry - Receives the twos bit of the sums
+	*/
+	inline void fullAdd(const uint64_t& pA, const uint64_t& pB, const uint64_t& pC, uint64_t& pSum, uint64_t& pCarry) {
+		const uint64_t HALF = pA ^ pB;
+		pSum = HALF ^ pC;
+		pCarry = (pA & pB) | (HALF & pC);
+	}
+
+	/*
+		CellBoard : setBounds - Initialise the board with a set of dimensions
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pWidth - The width of the grid
+		param[in] pHeight - The height of the grid
+
+		NOTE:
+		All cells are reset to dead
+	*/
+	void CellBoard::setBounds(const size_t& pWidth, const size_t& pHeight) {
+		//Stash the dimension values
+		mWidth = pWidth;
+		mHeight = pHeight;
+
+		//Determine the layout of the columns
+		mWords = (pHeight + 63) / 64;
+		mLastMask = (pHeight % 64 ? (1ULL << (pHeight % 64)) - 1 : ~0ULL);
+
+		//Reset the buffers
+		mCells.assign(mWidth * mWords, 0);
+		mNext.assign(mWidth * mWords, 0);
+	}
+
+	/*
+		CellBoard : load - Set the state of the board from a gameMap
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pMap - The gameMap to read the cells from
+		param[in] pAlive - The tile type that is considered alive
+	*/
+	void CellBoard::load(const gameMap& pMap, const ETileType& pAlive) {
+		//Setup the board with the same dimensions
+		setBounds(pMap.width(), pMap.height());
+
+		//Pack the alive cells
+		for (size_t x = 0; x < mWidth; x++) {
+			const ETileType* column = pMap[x];
+			uint64_t* words = mCells.data() + x * mWords;
+			for (size_t y = 0; y < mHeight; y++) {
+				if (column[y] == pAlive) words[y >> 6] |= 1ULL << (y & 63);
+			}
+		}
+	}
+
+	/*
+		CellBoard : store - Write the state of the board to a gameMap
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pMap - The gameMap to write the cells to (Must match the dimensions of the board)
+		param[in] pAlive - The tile type that alive cells are written as
+		param[in] pDead - The tile type that dead cells are written as
+	*/
+	void CellBoard::store(gameMap& pMap, const ETileType& pAlive, const ETileType& pDead) const {
+		for (size_t x = 0; x < mWidth; x++) {
+			ETileType* column = pMap[x];
+			const uint64_t* words = mCells.data() + x * mWords;
+			for (size_t y = 0; y < mHeight; y++)
+				column[y] = ((words[y >> 6] >> (y & 63)) & 1 ? pAlive : pDead);
+		}
+	}
+
+	/*
+		CellBoard : step - Apply a single step of the cellular automata rules to every cell
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pBirthRate - Dead cells with more alive neighbours than this value become alive
+		param[in] pDeathLimit - Alive cells with fewer alive neighbours than this value die
+
+		return size_t - Returns the number of cells that changed state
+	*/
+	size_t CellBoard::step(const size_t& pBirthRate, const size_t& pDeathLimit) {
+		//Store the number of modified cells
+		size_t modifyCount = 0;
+
+		//Process each column a word at a time
+		for (size_t x = 0; x < mWidth; x++) {
+			//Get the neighbouring columns, treating the outside of the grid as dead
+			const uint64_t* left = (x > 0 ? mCells.data() + (x - 1) * mWords : nullptr);
+			const uint64_t* centre = mCells.data() + x * mWords;
+			const uint64_t* right = (x + 1 < mWidth ? mCells.data() + (x + 1) * mWords : nullptr);
+			uint64_t* out = mNext.data() + x * mWords;
+
+			for (size_t w = 0; w < mWords; w++) {
+				//Build the eight neighbour planes, shifting each column by one cell in either direction
+				uint64_t planes[8];
+				size_t count = 0;
+				const uint64_t* columns[3] = { left, centre, right };
+				for (size_t c = 0; c < 3; c++) {
+					if (!columns[c]) {
+						planes[count++] = 0;
+						planes[count++] = 0;
+						if (c != 1) planes[count++] = 0;
+						continue;
+					}
+
+					//Get the words surrounding the current position
+					const uint64_t MID = columns[c][w];
+					const uint64_t PREV = (w > 0 ? columns[c][w - 1] : 0);
+					const uint64_t NEXT = (w + 1 < mWords ? columns[c][w + 1] : 0);
+
+					//Add the cells above and below, and the cell itself for the side columns
+					planes[count++] = (MID << 1) | (PREV >> 63);
+					planes[count++] = (MID >> 1) | (NEXT << 63);
+					if (c != 1) planes[count++] = MID;
+				}
+
+				//Sum the planes into a four bit count for each cell
+				uint64_t s0, c0, s1, c1, sA, cA, sB, cB;
+				fullAdd(planes[0], planes[1], planes[2], s0, c0);
+				fullAdd(planes[3], planes[4], planes[5], s1, c1);
+				const uint64_t S2 = planes[6] ^ planes[7], C2 = planes[6] & planes[7];
+				fullAdd(s0, s1, S2, sA, cA);
+				fullAdd(c0, c1, C2, sB, cB);
+				const uint64_t BITS[4] = { sA, sB ^ cA, cB ^ (sB & cA), cB & (sB & cA) };
+
+				//Find the cells with neighbour counts that trigger the rules
+				uint64_t dies = 0, births = 0;
+				for (size_t n = 0; n <= 8; n++) {
+					//Skip counts that neither rule applies to
+					const bool DIES = (n < pDeathLimit), BIRTH = (n > pBirthRate);
+					if (!DIES && !BIRTH) continue;
+
+					//Get the cells with exactly n alive neighbours
+					uint64_t match = ~0ULL;
+					for (size_t b = 0; b < 4; b++)
+						match &= ((n >> b) & 1 ? BITS[b] : ~BITS[b]);
+
+					//Apply the rules
+					if (DIES) dies |= match;
+					if (BIRTH) births |= match;
+				}
+
+				//Calculate the next state of the cells
+				const uint64_t CURR = centre[w];
+				uint64_t next = (CURR & ~dies) | (~CURR & births);
+				if (w + 1 == mWords) next &= mLastMask;
+
+				//Record the changes
+				modifyCount += countBits(next ^ CURR);
+				out[w] = next;
+			}
+		}
+
+		//Swap the buffers
+		mCells.swap(mNext);
+
+		//Return the modified count
+		return modifyCount;
+	}
+}
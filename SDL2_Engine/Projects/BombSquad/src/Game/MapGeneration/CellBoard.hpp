@@ -0,0 +1,134 @@
+#pragma once
+
+//! Include the required STL objects
+#include <vector>
+#include <cstdint>
+
+//! Include the map generation values
+#include "MapGenerationValues.hpp"
+
+namespace BombSquad {
+	/*
+	 *		Name: CellBoard
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Store the alive/dead state of a cellular automata grid as packed bits,
+	 *		allowing the rules to be applied to 64 cells at a time
+	 *
+	 *		Notes:
+	 *		Each x index of the grid is stored as a column of 64 bit words, bit n of
+	 *		word w holding the cell at y = w * 64 + n. Steps are synchronous, every
+	 *		cell is evaluated against the state of the previous step, with cells
+	 *		outside of the grid counted as dead
+	**/
+	class CellBoard {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////----------------------------------------Construction---------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			CellBoard : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		inline CellBoard() : mWidth(0), mHeight(0), mWords(0), mLastMask(0) {}
+
+		/*
+			CellBoard : setBounds - Initialise the board with a set of dimensions
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pWidth - The width of the grid
+			param[in] pHeight - The height of the grid
+
+			NOTE:
+			All cells are reset to dead
+		*/
+		void setBounds(const size_t& pWidth, const size_t& pHeight);
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////----------------------------------------Conversion-----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			CellBoard : load - Set the state of the board from a gameMap
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pMap - The gameMap to read the cells from
+			param[in] pAlive - The tile type that is considered alive
+		*/
+		void load(const gameMap& pMap, const ETileType& pAlive);
+
+		/*
+			CellBoard : store - Write the state of the board to a gameMap
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pMap - The gameMap to write the cells to (Must match the dimensions of the board)
+			param[in] pAlive - The tile type that alive cells are written as
+			param[in] pDead - The tile type that dead cells are written as
+		*/
+		void store(gameMap& pMap, const ETileType& pAlive, const ETileType& pDead) const;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------------Simulation----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			CellBoard : step - Apply a single step of the cellular automata rules to every cell
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pBirthRate - Dead cells with more alive neighbours than this value become alive
+			param[in] pDeathLimit - Alive cells with fewer alive neighbours than this value die
+
+			return size_t - Returns the number of cells that changed state
+		*/
+		size_t step(const size_t& pBirthRate, const size_t& pDeathLimit);
+
+		/*
+			CellBoard : isAlive - Check the state of a single cell
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pX - The x index of the cell
+			param[in] pY - The y index of the cell
+
+			return bool - Returns true if the cell is alive
+		*/
+		inline bool isAlive(const size_t& pX, const size_t& pY) const { return ((mCells[pX * mWords + (pY >> 6)] >> (pY & 63)) & 1) != 0; }
+
+		/*
+			CellBoard : width - Get the width of the board
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const size_t& - Returns a constant reference to the internal width value
+		*/
+		inline const size_t& width() const { return mWidth; }
+
+		/*
+			CellBoard : height - Get the height of the board
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const size_t& - Returns a constant reference to the internal height value
+		*/
+		inline const size_t& height() const { return mHeight; }
+
+	private:
+		//! Store the dimensions of the board
+		size_t mWidth, mHeight;
+
+		//! Store the number of words that make up a single column
+		size_t mWords;
+
+		//! Store the mask of the valid bits in the last word of each column
+		uint64_t mLastMask;
+
+		//! Store the current cell states and the buffer the next step is written to
+		std::vector<uint64_t> mCells, mNext;
+	};
+}
@@ -3,16 +3,25 @@
 //! Include standard memory manipulation functions
 #include <string.h>
 
+//! Include the STL algorithms for filling and moving the map
+#include <algorithm>
+#include <utility>
+
 namespace BombSquad {
 	/*
 	*		Name: Map
 	*		Author: Mitchell Croft
 	*		Created: 08/11/2017
-	*		Modified: 08/11/2017
+	*		Modified: 16/10/2026
 	*
 	*		Purpose:
 	*		Store a 2D map of data values that can be used to represent
 	*		various pieces of information
+	*
+	*		Notes:
+	*		Values are stored in a single contiguous buffer, ordered to match the
+	*		[x][y] subscript so that iterating over x and then y walks memory in
+	*		order. The value at (x, y) is located at data()[x * stride() + y]
 	**/
 	template<typename T>
 	class Map {
@@ -24,78 +33,83 @@ namespace BombSquad {
 		/*
 			Map : Constructor - Initialise with default values
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 		*/
-		inline Map() : mMap(nullptr), mWidth(0), mHeight(0) {}
+		inline Map() : mMap(nullptr), mWidth(0), mHeight(0), mCapacity(0) {}
 
 		/*
 			Map : Custom Constructor - Initialise with a set of dimensions
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pWidth - The desired width of the Map object
 			param[in] pHeight - The desired height of the Map object
 		*/
-		inline Map(const size_t& pWidth, const size_t& pHeight) : mMap(nullptr), mWidth(0), mHeight(0) { setBounds(pWidth, pHeight); }
+		inline Map(const size_t& pWidth, const size_t& pHeight) : mMap(nullptr), mWidth(0), mHeight(0), mCapacity(0) { setBounds(pWidth, pHeight); }
 
 		/*
 			Map : Copy Constructor - Copy the values of another Map object
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pCopy - The Map object to copy
 		*/
+		inline Map(const Map& pCopy) : mMap(nullptr), mWidth(0), mHeight(0), mCapacity(0) { *this = pCopy; }
 
-		inline Map(const Map& pCopy) : mMap(nullptr), mWidth(0), mHeight(0) { *this = pCopy; }
+		/*
+			Map : Move Constructor - Take ownership of the values of another Map object
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pMove - The Map object to take the values of
+		*/
+		inline Map(Map&& pMove) : mMap(nullptr), mWidth(0), mHeight(0), mCapacity(0) { *this = std::move(pMove); }
 
 		/*
 			Map : setBounds - Initialise the map with a set of dimensions
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pWidth - The desired width of the Map object
 			param[in] pHeight - The desired height of the Map object
 
 			NOTE:
-			This function resets the data on the map to the default state
+			This function resets the data on the map to the default state. The existing
+			buffer is reused if it is large enough to hold the new dimensions
 		*/
 		void setBounds(const size_t& pWidth, const size_t& pHeight) {
-			//Free previously allocated memory
-			dispose();
+			//Check if the buffer needs to grow
+			if (pWidth * pHeight > mCapacity) {
+				//Free previously allocated memory
+				dispose();
+
+				//Create the new array
+				mCapacity = pWidth * pHeight;
+				mMap = new T[mCapacity];
+			}
 
 			//Stash the dimension values
 			mWidth = pWidth;
 			mHeight = pHeight;
 
-			//Create the new array
-			mMap = new T*[mWidth];
-			for (size_t i = 0; i < mWidth; i++) {
-				//Create the array
-				mMap[i] = new T[mHeight];
-
-				//Reset the data
-				memset(mMap[i], 0, sizeof(T) * mHeight);
-			}
+			//Reset the data
+			if (mMap) memset(mMap, 0, sizeof(T) * mCapacity);
 		}
 
 		/*
 			Map : dispose - Clear allocated memory within the Map
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 		*/
 		void dispose() {
-			//Check if the map is allocated
-			if (mMap) {
-				//Loop through and delete individual rows
-				for (size_t i = 0; i < mWidth; i++) delete[] mMap[i];
-				delete[] mMap;
+			//Delete the buffer
+			delete[] mMap;
 
-				//Reset the pointer
-				mMap = nullptr;
+			//Reset the pointer
+			mMap = nullptr;
 
-				//Reset the dimensions
-				mWidth = mHeight = 0;
-			}
+			//Reset the dimensions
+			mWidth = mHeight = mCapacity = 0;
 		}
 
 		/*
@@ -126,25 +140,133 @@ namespace BombSquad {
 		*/
 		inline const size_t& height() const { return mHeight; }
 
+		/*
+			Map : size - Get the total number of values stored in the Map
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the width multiplied by the height
+		*/
+		inline size_t size() const { return mWidth * mHeight; }
+
+		/*
+			Map : stride - Get the distance between the first values of consecutive x indices
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const size_t& - Returns a constant reference to the internal height value
+		*/
+		inline const size_t& stride() const { return mHeight; }
+
+		/*
+			Map : index - Get the position of a value within the contiguous buffer
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pX - The x index of the value
+			param[in] pY - The y index of the value
+
+			return size_t - Returns the offset from the start of data()
+		*/
+		inline size_t index(const size_t& pX, const size_t& pY) const { return pX * mHeight + pY; }
+
+		/*
+			Map : data - Get the contiguous buffer of values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return T* - Returns a pointer to the first value or nullptr if the Map is empty
+		*/
+		inline T* data() { return mMap; }
+
+		/*
+			Map : data - Get the contiguous buffer of values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const T* - Returns a constant pointer to the first value or nullptr if the Map is empty
+		*/
+		inline const T* data() const { return mMap; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////--------------------------------------Modifiers--------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			Map : fill - Assign a value to every position on the Map
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pValue - The value to assign
+		*/
+		inline void fill(const T& pValue) { std::fill(mMap, mMap + size(), pValue); }
+
+		/*
+			Map : copyFrom - Copy the values of another Map object with the same dimensions
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pCopy - The Map object to copy
+
+			return bool - Returns true if the dimensions matched and the values were copied
+		*/
+		inline bool copyFrom(const Map& pCopy) {
+			if (pCopy.mWidth != mWidth || pCopy.mHeight != mHeight) return false;
+			if (mMap != pCopy.mMap) memcpy(mMap, pCopy.mMap, sizeof(T) * size());
+			return true;
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////---------------------------------------Operators-------------------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		/*
 			Map : Assignment Operator - Copy the values of another Map object
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pCopy - The Map object to copy
 
 			return Map& - Returns a reference to itself
 		*/
 		Map& operator=(const Map& pCopy) {
+			//Check for self assignment
+			if (this == &pCopy) return *this;
+
 			//Setup map with the same dimensions
 			setBounds(pCopy.mWidth, pCopy.mHeight);
 
 			//Copy the data values
-			for (size_t i = 0; i < mWidth; i++)
-				memcpy_s(mMap[i], sizeof(T) * mHeight, pCopy.mMap[i], sizeof(T) * mHeight);
+			copyFrom(pCopy);
+
+			//Return itself
+			return *this;
+		}
+
+		/*
+			Map : Move Assignment Operator - Take ownership of the values of another Map object
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pMove - The Map object to take the values of
+
+			return Map& - Returns a reference to itself
+		*/
+		Map& operator=(Map&& pMove) {
+			//Check for self assignment
+			if (this == &pMove) return *this;
+
+			//Free previously allocated memory
+			dispose();
+
+			//Take the values
+			mMap = pMove.mMap;
+			mWidth = pMove.mWidth;
+			mHeight = pMove.mHeight;
+			mCapacity = pMove.mCapacity;
+
+			//Reset the moved Map
+			pMove.mMap = nullptr;
+			pMove.mWidth = pMove.mHeight = pMove.mCapacity = 0;
 
 			//Return itself
 			return *this;
@@ -153,30 +275,33 @@ namespace BombSquad {
 		/*
 			Map : Subscript Operator - Access the internal value map values via sub-script
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pIndex - The width index of the map to retrieve
 
-			return T*& - Returns a reference to the pointer for that specified row
+			return T* - Returns a pointer to the values stored at that x index
 		*/
-		inline T*& operator[](const size_t& pIndex) { return mMap[pIndex]; }
+		inline T* operator[](const size_t& pIndex) { return mMap + pIndex * mHeight; }
 
 		/*
 			Map : Const Subscript Operator - Access the internal value map values via sub-script
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pIndex - The width index of the map to retrieve
 
-			return T*& - Returns a reference to the pointer for that specified row
+			return const T* - Returns a constant pointer to the values stored at that x index
 		*/
-		inline T*& operator[](const size_t& pIndex) const { return mMap[pIndex]; }
+		inline const T* operator[](const size_t& pIndex) const { return mMap + pIndex * mHeight; }
 
 	private:
-		//! Store a 2D map of values
-		T** mMap;
+		//! Store the contiguous buffer of values
+		T* mMap;
 
 		//! Store the dimensions of the map
 		size_t mWidth, mHeight;
+
+		//! Store the number of values the buffer can hold
+		size_t mCapacity;
 	};
 }
\ No newline at end of file
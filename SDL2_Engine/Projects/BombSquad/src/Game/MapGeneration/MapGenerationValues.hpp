@@ -28,6 +28,15 @@ namespace BombSquad {
 		Obstacle,
 	};
 
+	//! Store an enumeration of the ways the cellular automata rules can be applied
+	enum class EAutomataMode {
+		//! Cells are updated in place, with neighbour counts including cells already updated this step
+		Legacy,
+
+		//! Every cell is evaluated against the previous step on a packed CellBoard
+		Synchronous,
+	};
+
 	//! Create a type define for the coordinate value
 	typedef glm::ivec2 coord;
 	
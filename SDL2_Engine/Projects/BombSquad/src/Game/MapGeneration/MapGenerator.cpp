@@ -1,49 +1,32 @@
 #include "MapGenerator.hpp"
 
+//! Include the packed cellular automata board
+#include "CellBoard.hpp"
+
+//! Include the path finding context
+#include "PathFinder.hpp"
+
 //! Include required standard functionality
 #include <cstdlib>
 #include <algorithm>
 #include <time.h>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <climits>
+#include <cstdint>
 
 #include <glm/glm.hpp>
 
 //! Define a simple SIGN macro
 #define SIGN(X) ((X) < 0 ? -1 : 1)
 
-/*
-	random - Get a 'random' float value in the scale of 0 - 1 (inclusive)
-	Author: Mitchell Croft
-	Created: 09/11/2017
-	Modified: 09/11/2017
-
-	return float - Returns a float value in the 0 - 1 range
-*/
-inline float random() { return ((float)rand() / (float)RAND_MAX); }
-
 namespace BombSquad {
-	/*
-		manhattanDistance - Get the Manhattan distance between two points
-		Author: Mitchell Croft
-		Created: 09/11/2017
-		Modified: 09/11/2017
-
-		param[in] pFrom - The starting point of the path
-		param[in] pTo - The ending point of the path
-
-		return size_t - Returns the distance as a size_t value
-	*/
-	inline size_t manhattanDistance(const coord& pFrom, const coord& pTo) {
-		//Get the separation vector
-		const coord SEP = pTo - pFrom;
-
-		//Return the combined axis' values
-		return (abs(SEP.x) + abs(SEP.y));
-	}
-
 	/*
 		MapGenerator : Constructor - Initialise with default values
 		Created: 09/11/2017
-		Modified: 12/11/2017
+		Modified: 16/10/2026
 	*/
 	MapGenerator::MapGenerator() :
 		mBirthRate(4),
@@ -52,96 +35,227 @@ namespace BombSquad {
 		mIterations(-1),
 		mMaxIterations(25),
 		mPassageRadius(1),
-		mObstacleChance(0.25f)
+		mObstacleChance(0.25f),
+		mAutomataMode(EAutomataMode::Synchronous),
+		mSeed(0),
+		mWorkerCount(0)
 	{}
 
 	/*
 		MapGenerator : generateMap - Create a gameMap based on the current settings
 		Created: 09/11/2017
-		Modified: 16/11/2017
+		Modified: 16/10/2026
 
 		param[in] pWidth - The Width of the map to create
 		param[in] pHeight - The Height of the map to create
 		param[in] pPlayers - The number of spawn points to place on the map
+		param[out] pReport - An optional MapGenerationReport to receive the details of the attempts (Default nullptr)
 
 		return gameMap - Returns a gameMap object that has been setup for a game
+
+		NOTE:
+		Attempts are run concurrently on the worker threads, each with its own random stream derived
+		from the seed and the attempt index. The successful attempt with the lowest index is accepted,
+		so the same seed always produces the same map regardless of the number of workers
 	*/
-	gameMap MapGenerator::generateMap(const size_t& pWidth, const size_t& pHeight, const size_t& pPlayers) const {
-		//Set the randomised seed
-		srand((unsigned int)time(NULL));
-
-		//Flag if the generation process was successful
-		bool flag = false;
-
-		//Store a gameMap that can be returned
-		gameMap map;
-
-		//Start the process
-		do {
-			//Create the initial map array
-			map = createInitialMap(pWidth, pHeight);
-
-			//Apply the rules for the iterations
-			if (mIterations >= 0) {
-				//Run the iterations count
-				for (int i = 0; i < mIterations; i++)
-					simulateStep(map);
+	gameMap MapGenerator::generateMap(const size_t& pWidth, const size_t& pHeight, const size_t& pPlayers, MapGenerationReport* pReport) const {
+		//Get the time generation started
+		const auto START = std::chrono::steady_clock::now();
+
+		//Determine the seed that the attempts are derived from
+		const uint64_t SEED = (mSeed ? mSeed : (uint64_t)time(NULL));
+
+		//Determine the number of workers to use, leaving a hardware thread free for the caller
+		size_t workerCount = mWorkerCount;
+		if (!workerCount) {
+			const unsigned int HARDWARE = std::thread::hardware_concurrency();
+			workerCount = (HARDWARE > 1 ? HARDWARE - 1 : 1);
+		}
+
+		//Store the index of the next attempt to start and the lowest accepted attempt
+		std::atomic<size_t> nextAttempt(0);
+		std::atomic<size_t> accepted(SIZE_MAX);
+
+		//Store the accepted map and the attempt details, guarded by a lock
+		std::mutex resultLock;
+		gameMap result;
+		std::vector<MapAttempt> attempts;
+
+		//Define the work performed by each worker
+		auto work = [&]() {
+			//Store a map that can be reused between attempts
+			gameMap map;
+
+			//Loop while attempts could still be accepted
+			while (true) {
+				//Claim the next attempt
+				const size_t INDEX = nextAttempt++;
+
+				//Attempts after the accepted one can't be used
+				if (INDEX > accepted.load()) break;
+
+				//Get the time the attempt started
+				const auto ATTEMPT_START = std::chrono::steady_clock::now();
+
+				//Create the random stream for the attempt
+				SDL2_Engine::Utilities::Random rng(SEED, INDEX);
+
+				//Run the attempt, cancelling if an earlier attempt is accepted
+				MapAttempt attempt;
+				attempt.index = INDEX;
+				attempt.result = attemptMap(pWidth, pHeight, pPlayers, rng, [&]() { return accepted.load(std::memory_order_relaxed) < INDEX; }, map);
+				attempt.milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - ATTEMPT_START).count();
+
+				//Record the attempt
+				std::lock_guard<std::mutex> guard(resultLock);
+				if (attempt.result == EAttemptResult::Accepted && INDEX < accepted.load()) {
+					accepted = INDEX;
+					result = std::move(map);
+				}
+				attempts.push_back(attempt);
 			}
+		};
 
-			//Simulate steps until there are no chances or maximum limit reached
-			else {
-				//Store the number of cells modified last step
-				int lastModCount = UINT_MAX;
+		//Start the additional workers, with the calling thread acting as the last
+		std::vector<std::thread> workers;
+		workers.reserve(workerCount - 1);
+		for (size_t i = 1; i < workerCount; i++)
+			workers.emplace_back(work);
+		work();
+
+		//Wait for the workers to finish
+		for (size_t i = 0; i < workers.size(); i++)
+			workers[i].join();
+
+		//Fill out the report
+		if (pReport) {
+			//Order the attempts and mark successful attempts that were superseded
+			std::sort(attempts.begin(), attempts.end(), [](const MapAttempt& pLeft, const MapAttempt& pRight) { return pLeft.index < pRight.index; });
+			for (size_t i = 0; i < attempts.size(); i++) {
+				if (attempts[i].result == EAttemptResult::Accepted && attempts[i].index != accepted)
+					attempts[i].result = EAttemptResult::Cancelled;
+			}
 
-				//Store the number of smoothing iterations that have occurred
-				size_t iterCount = 0;
+			//Store the values
+			pReport->seed = SEED;
+			pReport->accepted = accepted;
+			pReport->workers = workerCount;
+			pReport->milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - START).count();
+			pReport->attempts = std::move(attempts);
+		}
 
-				//Loop until limit is reached
-				while (iterCount++ < mMaxIterations) {
-					//Perform a simulation step
-					size_t modCount = simulateStep(map);
+		//Return the generated map
+		return result;
+	}
+
+	/*
+		MapGenerator : attemptMap - Run a single attempt at generating a map
+		Created: 16/10/2026
+		Modified: 16/10/2026
 
-					//Calculate the delta value
-					int deltaMod = lastModCount - (int)modCount;
+		param[in] pWidth - The Width of the map to create
+		param[in] pHeight - The Height of the map to create
+		param[in] pPlayers - The number of spawn points to place on the map
+		param[in] pRng - The random stream used by the attempt
+		param[in] pCancelled - A callback that returns true when the attempt should be abandoned
+		param[out] pMap - Receives the generated map
 
-					//Check for loop break
-					if (deltaMod == 0) break;
+		return EAttemptResult - Returns Accepted if the map is complete, Rejected if the spawn points
+								couldn't be placed or Cancelled if the attempt was abandoned
 
-					//Store the last modified count
-					lastModCount = (int)modCount;
-				}
-			}
+		NOTE:
+		Cancellation is checked between each phase of generation
+	*/
+	EAttemptResult MapGenerator::attemptMap(const size_t& pWidth, const size_t& pHeight, const size_t& pPlayers, SDL2_Engine::Utilities::Random& pRng, const std::function<bool()>& pCancelled, gameMap& pMap) const {
+		//Create the initial map array
+		pMap = createInitialMap(pWidth, pHeight, pRng);
+		if (pCancelled()) return EAttemptResult::Cancelled;
+
+		//Apply the rules on the packed board
+		if (mAutomataMode == EAutomataMode::Synchronous) {
+			CellBoard board;
+			board.load(pMap, ETileType::Free);
+			runSimulation([&]() { return board.step(mBirthRate, mDeathLimit); });
+			board.store(pMap, ETileType::Free, ETileType::Restricted);
+		}
 
-			//Find all 'free' regions on the map
-			RegionIdentifier identifier(ETileType::Free, map);
+		//Apply the rules directly to the map
+		else runSimulation([&]() { return simulateStep(pMap); });
+		if (pCancelled()) return EAttemptResult::Cancelled;
 
-			//Link the identified regions on the map
-			linkRegions(identifier, map);
+		//Find all 'free' regions on the map
+		RegionIdentifier identifier(ETileType::Free, pMap);
 
-			//Find distanced coordinates to spawn the players at
-			flag = findPlayerSpawns(map, identifier, pPlayers);
+		//Link the identified regions on the map
+		linkRegions(identifier, pMap);
+		if (pCancelled()) return EAttemptResult::Cancelled;
 
-		//Loop while spawn points couldn't be placed
-		} while (!flag);
+		//Find distanced coordinates to spawn the players at
+		if (!findPlayerSpawns(pMap, identifier, pPlayers)) return EAttemptResult::Rejected;
+		if (pCancelled()) return EAttemptResult::Cancelled;
 
 		//Spawn the obstacles on the map
-		placeObstacles(map);
-		
-		//Return the generated map
-		return map;
+		placeObstacles(pMap, pRng);
+
+		//Return success
+		return EAttemptResult::Accepted;
+	}
+
+	/*
+		MapGenerator : runSimulation - Apply the cellular automata rules for the configured number of iterations
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		Template TStep - The type of the callback that performs a single step, in the form size_t()
+
+		param[in] pStep - The callback that applies the rules once and returns the number of modified cells
+	*/
+	template<typename TStep>
+	void MapGenerator::runSimulation(TStep pStep) const {
+		//Apply the rules for the iterations
+		if (mIterations >= 0) {
+			//Run the iterations count
+			for (int i = 0; i < mIterations; i++)
+				pStep();
+		}
+
+		//Simulate steps until there are no chances or maximum limit reached
+		else {
+			//Store the number of cells modified last step
+			int lastModCount = UINT_MAX;
+
+			//Store the number of smoothing iterations that have occurred
+			size_t iterCount = 0;
+
+			//Loop until limit is reached
+			while (iterCount++ < mMaxIterations) {
+				//Perform a simulation step
+				size_t modCount = pStep();
+
+				//Calculate the delta value
+				int deltaMod = lastModCount - (int)modCount;
+
+				//Check for loop break
+				if (deltaMod == 0) break;
+
+				//Store the last modified count
+				lastModCount = (int)modCount;
+			}
+		}
 	}
 
 	/*
 		MapGenerator : createInitialMap - Create the initial map, and populate with initial free tiles
 		Created: 09/11/2017
-		Modified: 09/11/2017
+		Modified: 16/10/2026
 
 		param[in] pWidth - The width of the map to create
 		param[in] pHeight - The height of the map to create
+		param[in] pRng - The random stream used to place the tiles
 
 		return gameMap - Returns a gameMap object populated with the starting values
 	*/
-	gameMap MapGenerator::createInitialMap(const size_t& pWidth, const size_t& pHeight) const {
+	gameMap MapGenerator::createInitialMap(const size_t& pWidth, const size_t& pHeight, SDL2_Engine::Utilities::Random& pRng) const {
 		//Create the initial empty map
 		gameMap map(pWidth, pHeight);
 
@@ -149,7 +263,7 @@ namespace BombSquad {
 		for (size_t x = 0; x < pWidth; x++) {
 			for (size_t y = 0; y < pHeight; y++) {
 				//Get the random chance
-				if (random() <= mInitialChance) map[x][y] = ETileType::Free;
+				if (pRng.chance(mInitialChance)) map[x][y] = ETileType::Free;
 			}
 		}
 
@@ -436,7 +550,7 @@ namespace BombSquad {
 	/*
 		MapGenerator : findPlayerSpawns - Find the 'ideal' position(s) within the regions to place spawn points for the player(s)
 		Created: 09/11/2017
-		Modified: 16/11/2017
+		Modified: 16/10/2026
 
 		param[in] pMap - The map to find spawn positions on
 		param[in] pIdent - A RegionIdentifer object defining the available areas
@@ -454,10 +568,13 @@ namespace BombSquad {
 		//Track the current index into available
 		size_t currIndex = 0;
 
+		//Store the search buffers shared by the regions
+		DepthScratch scratch;
+
 		//Loop through and setup from identified regions
 		for (size_t reg = 0; reg < pIdent.regions.size(); reg++) {
 			//Analyse the depth of the region
-			pIdent.regions[reg].analyseDepth();
+			pIdent.regions[reg].analyseDepth(scratch);
 
 			//Resize the available list to support the incoming coords
 			available.resize(available.size() + pIdent.regions[reg].contained.size());
@@ -476,7 +593,7 @@ namespace BombSquad {
 		}
 
 		//Remove any regions that have a depth of 0
-		available.erase(std::remove_if(available.begin(), available.end(), [&](const coord& pVal) { return (totalDepth[pVal.x][pVal.y] == 0); }));
+		available.erase(std::remove_if(available.begin(), available.end(), [&](const coord& pVal) { return (totalDepth[pVal.x][pVal.y] == 0); }), available.end());
 
 		//Check there are enough points available to support the requested players
 		if (available.size() < pPlayers) return false;
@@ -495,8 +612,18 @@ namespace BombSquad {
 		//Stash the deepest point on the map as the first spawn
 		spawnPoints[0] = available[0];
 
+		//Setup the path finder for the map
+		PathFinder finder;
+		finder.setMap(pMap, ETileType::Free);
+
+		//Store the total path length from each position to the established spawn points
+		Map<int> pathTotals(pMap.width(), pMap.height());
+
 		//Narrow down the other spawn positions
 		for (size_t player = 1; player < pPlayers; player++) {
+			//Add the path lengths from the most recently established position
+			finder.accumulateDistances(spawnPoints[player - 1], pathTotals);
+
 			//Store the furthest possible distance found
 			const coord* furthest = nullptr;
 			int furthestAvgDist = 0;
@@ -515,17 +642,8 @@ namespace BombSquad {
 				//If matching spawn coord found, skip
 				if (found) continue;
 
-				//Store the average distance
-				int avg = 0;
-
-				//Loop through the previously established positions
-				for (size_t i = 0; i < player; i++) {
-					avg += (int)findPath(spawnPoints[i], available[aval], pMap, ETileType::Free).size() +
-						(totalDepth[available[aval].x][available[aval].y]);
-				}
-
-				//Take the average
-				avg /= (int)player;
+				//Take the average of the path lengths and depth
+				const int avg = (pathTotals[available[aval].x][available[aval].y] + (int)player * totalDepth[available[aval].x][available[aval].y]) / (int)player;
 
 				//Check if the distance is further
 				if (avg > furthestAvgDist) {
@@ -535,6 +653,9 @@ namespace BombSquad {
 				}
 			}
 
+			//Check a position was found
+			if (!furthest) return false;
+
 			//Set the spawn point
 			spawnPoints[player] = *furthest;
 		}
@@ -569,135 +690,21 @@ namespace BombSquad {
 		return true;
 	}
 
-	/*
-		MapGenerator : findPath - Find a path between two coordinates on a gameMap
-		Created: 09/11/2017
-		Modified: 09/11/2017
-
-		param[in] pStart - The coordinate of the starting point for the search
-		param[in] pEnd - The coordinate of the ending point for the search
-		param[in] pMap - The gameMap object that the coordinates exist on
-		param[in] pTraversable - The Tile Type which should be considered traversable by the algorithm
-
-		return coords - Returns a collection of coordinates that make up the path between the two points
-	*/
-	coords MapGenerator::findPath(const coord& pStart, const coord& pEnd, const gameMap& pMap, const ETileType& pTraversable) const {
-		//Store a A* Node Definition
-		struct AStarNode {
-			//Store the position of a Node
-			coord pos;
-
-			//Store a pointer to the Node object that introduced the current
-			AStarNode* parent;
-
-			//Store the score values for the Node
-			size_t gScore, hScore, fScore;
-		};
-
-		//Store a grid of A* Nodes for caluclation purposes
-		Map<AStarNode> navMesh(pMap.width(), pMap.height());
-
-		//Setup the grid
-		for (size_t x = 0; x < navMesh.width(); x++) {
-			for (size_t y = 0; y < navMesh.height(); y++) {
-				//Set default values
-				navMesh[x][y] = { {x, y}, nullptr, UINT_MAX, UINT_MAX, UINT_MAX };
-			}
-		}
-
-		//Store a priority queue of unprocessed Nodes
-		std::vector<AStarNode*> unsearched;
-
-		//Setup the initial score values for the starting Node
-		navMesh[pStart.x][pStart.y].gScore = 0;
-		navMesh[pStart.x][pStart.y].hScore =
-		navMesh[pStart.x][pStart.y].fScore = manhattanDistance(pStart, pEnd);
-
-		//Add the start coordinate to the list
-		unsearched.push_back(&navMesh[pStart.x][pStart.y]);
-
-		//Store the offsets used to identify neighbours
-		const coords OFFSETS = { {0, 1}, {0, -1}, {1, 0}, {-1, 0} };
-
-		//Loop while there are coordinates to process
-		AStarNode* current = nullptr;
-		while (unsearched.size()) {
-			//Sort the queue
-			std::sort(unsearched.begin(), unsearched.end(), [](const AStarNode* pLeft, const AStarNode* pRight) {
-				return (pLeft->fScore > pRight->fScore);
-			});
-
-			//Get the next element
-			current = unsearched[0];
-			unsearched.erase(unsearched.begin());
-
-			//Check if this is the end 
-			if (current->pos == pEnd) break;
-
-			//Add neighbours to the list
-			for (size_t i = 0; i < OFFSETS.size(); i++) {
-				//Get the next coord
-				const coord OFFSET = current->pos + OFFSETS[i];
-
-				//Check the coord is in the map bounds
-				if (OFFSET.x < 0 || OFFSET.y < 0 ||
-					OFFSET.x >= (int)pMap.width() || OFFSET.y >= (int)pMap.height())
-					continue;
-
-				//Check if the coordinate is traversable terrain
-				else if (pMap[OFFSET.x][OFFSET.y] != pTraversable) continue;
-
-				//Check if the Node hasn't been searched yet
-				else if (!navMesh[OFFSET.x][OFFSET.y].parent) unsearched.push_back(&navMesh[OFFSET.x][OFFSET.y]);
-
-				//Check to see if this cell has a better score
-				if (navMesh[OFFSET.x][OFFSET.y].gScore > navMesh[current->pos.x][current->pos.y].gScore + 1) {
-					//Set the new parent
-					navMesh[OFFSET.x][OFFSET.y].parent = current;
-
-					//Save the new score values
-					navMesh[OFFSET.x][OFFSET.y].gScore = navMesh[current->pos.x][current->pos.y].gScore + 1;
-					navMesh[OFFSET.x][OFFSET.y].hScore = manhattanDistance(OFFSET, pEnd);
-					navMesh[OFFSET.x][OFFSET.y].fScore = navMesh[OFFSET.x][OFFSET.y].gScore + navMesh[OFFSET.x][OFFSET.y].hScore;
-				}
-			}
-		}
-
-		//Create the path to travel
-		coords path;
-
-		//Store the path in the array
-		if (current->pos == pEnd) {
-			while (current->parent) {
-				//Add the coordinate to the path
-				path.push_back(current->pos);
-
-				//Trace the path back
-				current = current->parent;
-			}
-
-			//Reverse the path
-			std::reverse(path.begin(), path.end());
-		}
-
-		//Return the path
-		return path;
-	}
-
 	/*
 		MapGenerator : placeObstacles - Place obstacle tiles around a gameMap
 		Created: 09/11/2017
-		Modified: 09/11/2017
+		Modified: 16/10/2026
 
 		param[in] pMap - The gameMap to place the obstacles on
+		param[in] pRng - The random stream used to place the obstacles
 	*/
-	void MapGenerator::placeObstacles(gameMap& pMap) const {
+	void MapGenerator::placeObstacles(gameMap& pMap, SDL2_Engine::Utilities::Random& pRng) const {
 		//Loop through the map and randomly place obstacles on the free coords
 		for (size_t x = 0; x < pMap.width(); x++) {
 			for (size_t y = 0; y < pMap.height(); y++) {
 				//Check if the coord is free
 				if (pMap[x][y] == ETileType::Free &&
-					random() <= mObstacleChance)
+					pRng.chance(mObstacleChance))
 					pMap[x][y] = ETileType::Obstacle;
 			}
 		}
@@ -3,12 +3,91 @@
 //! Include the RegionIdentifier object
 #include "RegionIdentifier.hpp"
 
+//! Include the random number generator used by generation attempts
+#include <Utilities/Random.hpp>
+
+//! Include the STL function wrapper
+#include <functional>
+
 namespace BombSquad {
+	//! Store an enumeration of the outcomes of a single map generation attempt
+	enum class EAttemptResult {
+		//! The attempt produced the map that was returned
+		Accepted,
+
+		//! The attempt failed to place the spawn points
+		Rejected,
+
+		//! The attempt was stopped or discarded because an earlier attempt was accepted
+		Cancelled,
+	};
+
+	/*
+	 *		Name: MapAttempt
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Store the details of a single attempt made while generating a map
+	**/
+	struct MapAttempt {
+		//! The index of the attempt, used as the stream of its random generator
+		size_t index;
+
+		//! The outcome of the attempt
+		EAttemptResult result;
+
+		//! The time the attempt took to complete (in milliseconds)
+		float milliseconds;
+	};
+
+	/*
+	 *		Name: MapGenerationReport
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Describe how a map was generated, allowing the latency of generation
+	 *		to be monitored
+	**/
+	struct MapGenerationReport {
+		//! The seed the attempts were derived from
+		uint64_t seed = 0;
+
+		//! The index of the accepted attempt
+		size_t accepted = 0;
+
+		//! The number of worker threads used
+		size_t workers = 0;
+
+		//! The total time taken to generate the map (in milliseconds)
+		float milliseconds = 0.f;
+
+		//! The attempts that were started, ordered by index
+		std::vector<MapAttempt> attempts;
+
+		/*
+			MapGenerationReport : slowestAttempt - Get the time taken by the slowest attempt
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return float - Returns the longest attempt time in milliseconds
+		*/
+		inline float slowestAttempt() const {
+			float slowest = 0.f;
+			for (size_t i = 0; i < attempts.size(); i++)
+				if (attempts[i].milliseconds > slowest) slowest = attempts[i].milliseconds;
+			return slowest;
+		}
+	};
+
 	/*
 	 *		Name: MapGenerator 
 	 *		Author: Mitchell Croft
 	 *		Created: 09/11/2017
-	 *		Modified: 16/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Generate a gameMap object representing a possible area of play for
@@ -32,15 +111,21 @@ namespace BombSquad {
 		/*
 			MapGenerator : generateMap - Create a gameMap based on the current settings
 			Created: 09/11/2017
-			Modified: 16/11/2017
+			Modified: 16/10/2026
 
 			param[in] pWidth - The Width of the map to create
 			param[in] pHeight - The Height of the map to create
 			param[in] pPlayers - The number of spawn points to place on the map
+			param[out] pReport - An optional MapGenerationReport to receive the details of the attempts (Default nullptr)
 
 			return gameMap - Returns a gameMap object that has been setup for a game
+
+			NOTE:
+			Attempts are run concurrently on the worker threads, each with its own random stream derived
+			from the seed and the attempt index. The successful attempt with the lowest index is accepted,
+			so the same seed always produces the same map regardless of the number of workers
 		*/
-		gameMap generateMap(const size_t& pWidth, const size_t& pHeight, const size_t& pPlayers) const;
+		gameMap generateMap(const size_t& pWidth, const size_t& pHeight, const size_t& pPlayers, MapGenerationReport* pReport = nullptr) const;
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////---------------------------------------Getters/Setters-------------------------------////////
@@ -175,6 +260,78 @@ namespace BombSquad {
 		*/
 		inline void setObstacleChance(const float& pChance) { mObstacleChance = pChance; }
 
+		/*
+			MapGenerator : getAutomataMode - Get the way the cellular automata rules are applied
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const EAutomataMode& - Returns a constant reference to the internal value
+		*/
+		inline const EAutomataMode& getAutomataMode() const { return mAutomataMode; }
+
+		/*
+			MapGenerator : setAutomataMode - Set the way the cellular automata rules are applied
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pMode - The new mode
+
+			NOTE:
+			Legacy only preserves the in place, order dependent application of the rules. Maps are
+			drawn from a Random stream per attempt, so a seed does not reproduce the maps of versions using rand()
+		*/
+		inline void setAutomataMode(const EAutomataMode& pMode) { mAutomataMode = pMode; }
+
+		/*
+			MapGenerator : getSeed - Get the seed used to generate maps
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const uint64_t& - Returns a constant reference to the internal value
+		*/
+		inline const uint64_t& getSeed() const { return mSeed; }
+
+		/*
+			MapGenerator : setSeed - Set the seed used to generate maps
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeed - The new seed value (Where 0 uses a new seed from the time for each map)
+		*/
+		inline void setSeed(const uint64_t& pSeed) { mSeed = pSeed; }
+
+		/*
+			MapGenerator : getWorkerCount - Get the number of threads used to run generation attempts
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const size_t& - Returns a constant reference to the internal value
+		*/
+		inline const size_t& getWorkerCount() const { return mWorkerCount; }
+
+		/*
+			MapGenerator : setWorkerCount - Set the number of threads used to run generation attempts
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pCount - The new number of threads (Where 0 uses one less than the hardware supports)
+		*/
+		inline void setWorkerCount(const size_t& pCount) { mWorkerCount = pCount; }
+
+		/*
+			MapGenerator : simulateStep - Perform a single application of the cellular automata rules to a gameMap
+			Created: 09/11/2017
+			Modified: 16/10/2026
+
+			param[in] pMap - The gameMap object to apply the rules to
+			
+			return size_t - Returns the number of tiles that where modified during the application
+
+			NOTE:
+			This is the step applied by the Legacy automata mode, which updates the map in place
+		*/
+		size_t simulateStep(gameMap& pMap) const;
+
 	private:
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////-------------------------------------------Values------------------------------------////////
@@ -195,17 +352,30 @@ namespace BombSquad {
 		//! Store the chance of a free position having an obstacle spawned to obstruct a path
 		float mObstacleChance;
 
+		//! Store the way the cellular automata rules are applied
+		EAutomataMode mAutomataMode;
+
+		//! Store the seed used to generate maps (0 is time based)
+		uint64_t mSeed;
+
+		//! Store the number of threads used to run generation attempts (0 is automatic)
+		size_t mWorkerCount;
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////-------------------------------------Generation Delegates----------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		//! Run a single attempt at generating a map, checking for cancellation between each phase
+		EAttemptResult attemptMap(const size_t& pWidth, const size_t& pHeight, const size_t& pPlayers, SDL2_Engine::Utilities::Random& pRng, const std::function<bool()>& pCancelled, gameMap& pMap) const;
+
 		//! Create the initial map, and populate with initial free tiles
-		gameMap createInitialMap(const size_t& pWidth, const size_t& pHeight) const;
+		gameMap createInitialMap(const size_t& pWidth, const size_t& pHeight, SDL2_Engine::Utilities::Random& pRng) const;
 
 		//! Find the number of neighboring coordinates which can be considered 'alive'
 		size_t countAliveNeighbours(const coord& pCoord, const gameMap& pMap) const;
 
-		//! Perform a single application of the cellular automata rules to a gameMap
-		size_t simulateStep(gameMap& pMap) const;
+		//! Apply the cellular automata rules for the configured number of iterations
+		template<typename TStep>
+		void runSimulation(TStep pStep) const;
 
 		//! Links regions identified by a RegionIdentifier object
 		void linkRegions(RegionIdentifier& pIdent, gameMap& pMap) const;
@@ -219,10 +389,7 @@ namespace BombSquad {
 		//! Find the 'ideal' position(s) within the regions to place spawn points for the player(s)
 		bool findPlayerSpawns(gameMap& pMap, RegionIdentifier& pIdent, const size_t& pPlayers) const;
 
-		//! Find a path between two coordinates on a gameMap
-		coords findPath(const coord& pStart, const coord& pEnd, const gameMap& pMap, const ETileType& pTraversable) const;
-
 		//! Place obstacle tiles around a gameMap
-		void placeObstacles(gameMap& pMap) const;
+		void placeObstacles(gameMap& pMap, SDL2_Engine::Utilities::Random& pRng) const;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,343 @@
+#include "PathFinder.hpp"
+
+//! Include required standard functionality
+#include <cstdlib>
+#include <algorithm>
+
+namespace BombSquad {
+	/*
+		manhattanDistance - Get the Manhattan distance between two points
+		Author: Mitchell Croft
+		Created: 09/11/2017
+		Modified: 16/10/2026
+
+		param[in] pFrom - The starting point of the path
+		param[in] pTo - The ending point of the path
+
+		return unsigned int - Returns the distance as an unsigned int value
+	*/
+	inline unsigned int manhattanDistance(const coord& pFrom, const coord& pTo) {
+		//Get the separation vector
+		const coord SEP = pTo - pFrom;
+
+		//Return the combined axis' values
+		return (unsigned int)(abs(SEP.x) + abs(SEP.y));
+	}
+
+	/*
+		PathFinder : Constructor - Initialise with default values
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	PathFinder::PathFinder() : mMap(nullptr), mTraversable(ETileType::Free), mGeneration(0) {}
+
+	/*
+		PathFinder : setMap - Set the gameMap that paths will be found on
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pMap - The gameMap object that the coordinates exist on
+		param[in] pTraversable - The Tile Type which should be considered traversable by the algorithm
+	*/
+	void PathFinder::setMap(const gameMap& pMap, const ETileType& pTraversable) {
+		//Store the map values
+		mMap = &pMap;
+		mTraversable = pTraversable;
+
+		//Size the buffers to the map, reusing previously allocated memory
+		const size_t SIZE = pMap.size();
+		mRegions.assign(SIZE, -1);
+		if (mNodes.size() != SIZE) {
+			mNodes.assign(SIZE, Node());
+			mGeneration = 0;
+		}
+		mHeap.reserve(SIZE);
+
+		//Store the offsets used to identify neighbours
+		const coord OFFSETS[] = { {0, 1}, {0, -1}, {1, 0}, {-1, 0} };
+		const size_t OFFSET_SIZE = sizeof(OFFSETS) / sizeof(const coord);
+
+		//Label the connected areas of traversable tiles, using the heap as the flood fill stack
+		int regionID = 0;
+		for (int x = 0; x < (int)pMap.width(); x++) {
+			for (int y = 0; y < (int)pMap.height(); y++) {
+				//Check the coordinate starts a new area
+				const size_t START = pMap.index(x, y);
+				if (mRegions[START] != -1 || pMap.data()[START] != pTraversable) continue;
+
+				//Flood the area
+				mRegions[START] = regionID;
+				mHeap.clear();
+				mHeap.push_back((int)START);
+				while (mHeap.size()) {
+					//Get the next coordinate
+					const int INDEX = mHeap.back();
+					mHeap.pop_back();
+					const coord POS((int)(INDEX / pMap.stride()), (int)(INDEX % pMap.stride()));
+
+					//Add the unlabelled neighbours
+					for (size_t i = 0; i < OFFSET_SIZE; i++) {
+						const coord OFFSET = POS + OFFSETS[i];
+						if (OFFSET.x < 0 || OFFSET.y < 0 ||
+							OFFSET.x >= (int)pMap.width() || OFFSET.y >= (int)pMap.height())
+							continue;
+
+						const size_t NEXT = pMap.index(OFFSET.x, OFFSET.y);
+						if (mRegions[NEXT] != -1 || pMap.data()[NEXT] != pTraversable) continue;
+						mRegions[NEXT] = regionID;
+						mHeap.push_back((int)NEXT);
+					}
+				}
+
+				//Move to the next area
+				++regionID;
+			}
+		}
+		mHeap.clear();
+	}
+
+	/*
+		PathFinder : isConnected - Check if a path could exist between two coordinates
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pStart - The coordinate of the starting point
+		param[in] pEnd - The coordinate of the ending point
+
+		return bool - Returns true if the coordinates are in the same connected area
+	*/
+	bool PathFinder::isConnected(const coord& pStart, const coord& pEnd) const {
+		//A path to itself always exists
+		if (pStart == pEnd) return true;
+
+		//The end must be traversable
+		const int END = getRegionID(pEnd);
+		if (END == -1) return false;
+
+		//A non-traversable start can step onto any neighbouring area, so only rule out a traversable start
+		const int START = getRegionID(pStart);
+		return (START == -1 || START == END);
+	}
+
+	/*
+		PathFinder : findPath - Find the shortest path between two coordinates
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pStart - The coordinate of the starting point for the search
+		param[in] pEnd - The coordinate of the ending point for the search
+		param[out] pPath - Receives the coordinates of the path, excluding the start and including the end
+
+		return bool - Returns true if a path was found
+	*/
+	bool PathFinder::findPath(const coord& pStart, const coord& pEnd, coords& pPath) {
+		//Clear the previous path
+		pPath.clear();
+
+		//Check the coordinates can be connected
+		if (!isConnected(pStart, pEnd)) return false;
+		else if (pStart == pEnd) return true;
+
+		//Start a new search
+		nextGeneration();
+
+		//Store the offsets used to identify neighbours
+		const coord OFFSETS[] = { {0, 1}, {0, -1}, {1, 0}, {-1, 0} };
+		const size_t OFFSET_SIZE = sizeof(OFFSETS) / sizeof(const coord);
+
+		//Open the starting node
+		const int START = (int)mMap->index(pStart.x, pStart.y);
+		const int END = (int)mMap->index(pEnd.x, pEnd.y);
+		Node& first = mNodes[START];
+		first.gScore = 0;
+		first.fScore = manhattanDistance(pStart, pEnd);
+		first.parent = -1;
+		first.stamp = mGeneration;
+		first.heapIndex = 0;
+		mHeap.clear();
+		mHeap.push_back(START);
+
+		//Loop while there are nodes to process
+		while (mHeap.size()) {
+			//Take the best node from the heap
+			const int CURRENT = mHeap[0];
+			mHeap[0] = mHeap.back();
+			mNodes[mHeap[0]].heapIndex = 0;
+			mHeap.pop_back();
+			if (mHeap.size()) siftDown(0);
+			mNodes[CURRENT].heapIndex = -1;
+
+			//Check if this is the end
+			if (CURRENT == END) break;
+
+			//Get the position of the node
+			const coord POS((int)(CURRENT / mMap->stride()), (int)(CURRENT % mMap->stride()));
+			const unsigned int G_SCORE = mNodes[CURRENT].gScore + 1;
+
+			//Process the neighbours
+			for (size_t i = 0; i < OFFSET_SIZE; i++) {
+				//Get the next coord
+				const coord OFFSET = POS + OFFSETS[i];
+
+				//Check the coord is in the map bounds
+				if (OFFSET.x < 0 || OFFSET.y < 0 ||
+					OFFSET.x >= (int)mMap->width() || OFFSET.y >= (int)mMap->height())
+					continue;
+
+				//Check if the coordinate is traversable terrain
+				const int NEXT = (int)mMap->index(OFFSET.x, OFFSET.y);
+				if (mRegions[NEXT] == -1) continue;
+
+				//Open the node if it hasn't been reached this search
+				Node& node = mNodes[NEXT];
+				if (node.stamp != mGeneration) {
+					node.stamp = mGeneration;
+					node.gScore = G_SCORE;
+					node.fScore = G_SCORE + manhattanDistance(OFFSET, pEnd);
+					node.parent = CURRENT;
+					node.heapIndex = (int)mHeap.size();
+					mHeap.push_back(NEXT);
+					siftUp(node.heapIndex);
+				}
+
+				//Lower the score of a node that is still open
+				else if (node.heapIndex != -1 && G_SCORE < node.gScore) {
+					node.fScore -= node.gScore - G_SCORE;
+					node.gScore = G_SCORE;
+					node.parent = CURRENT;
+					siftUp(node.heapIndex);
+				}
+			}
+		}
+
+		//Check if the end was reached
+		if (mNodes[END].stamp != mGeneration || mNodes[END].heapIndex != -1) return false;
+
+		//Trace the path back
+		for (int index = END; index != START; index = mNodes[index].parent)
+			pPath.push_back(coord((int)(index / mMap->stride()), (int)(index % mMap->stride())));
+
+		//Reverse the path
+		std::reverse(pPath.begin(), pPath.end());
+		return true;
+	}
+
+	/*
+		PathFinder : accumulateDistances - Add the shortest path length from a coordinate to every reachable coordinate
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSource - The coordinate to measure the path lengths from
+		param[in/out] pTotals - The Map (matching the dimensions of the gameMap) to add the path lengths to
+
+		NOTE:
+		Coordinates that can't be reached from the source are left unchanged, matching
+		the empty path returned by findPath
+	*/
+	void PathFinder::accumulateDistances(const coord& pSource, Map<int>& pTotals) {
+		//Start a new search
+		nextGeneration();
+
+		//Store the offsets used to identify neighbours
+		const coord OFFSETS[] = { {0, 1}, {0, -1}, {1, 0}, {-1, 0} };
+		const size_t OFFSET_SIZE = sizeof(OFFSETS) / sizeof(const coord);
+
+		//Flood outwards from the source, using the heap buffer as the queue
+		const int SOURCE = (int)mMap->index(pSource.x, pSource.y);
+		mNodes[SOURCE].stamp = mGeneration;
+		mNodes[SOURCE].gScore = 0;
+		mHeap.clear();
+		mHeap.push_back(SOURCE);
+		for (size_t head = 0; head < mHeap.size(); head++) {
+			//Get the next coordinate
+			const int CURRENT = mHeap[head];
+			const coord POS((int)(CURRENT / mMap->stride()), (int)(CURRENT % mMap->stride()));
+			const unsigned int G_SCORE = mNodes[CURRENT].gScore + 1;
+
+			//Process the neighbours
+			for (size_t i = 0; i < OFFSET_SIZE; i++) {
+				//Get the next coord
+				const coord OFFSET = POS + OFFSETS[i];
+
+				//Check the coord is in the map bounds
+				if (OFFSET.x < 0 || OFFSET.y < 0 ||
+					OFFSET.x >= (int)mMap->width() || OFFSET.y >= (int)mMap->height())
+					continue;
+
+				//Check if the coordinate is traversable and hasn't been reached
+				const int NEXT = (int)mMap->index(OFFSET.x, OFFSET.y);
+				if (mRegions[NEXT] == -1 || mNodes[NEXT].stamp == mGeneration) continue;
+
+				//Record the distance
+				mNodes[NEXT].stamp = mGeneration;
+				mNodes[NEXT].gScore = G_SCORE;
+				pTotals.data()[NEXT] += (int)G_SCORE;
+				mHeap.push_back(NEXT);
+			}
+		}
+		mHeap.clear();
+	}
+
+	/*
+		PathFinder : nextGeneration - Advance the search generation, resetting the stamps if it wraps around
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	void PathFinder::nextGeneration() {
+		if (++mGeneration == 0) {
+			for (size_t i = 0; i < mNodes.size(); i++) mNodes[i].stamp = 0;
+			mGeneration = 1;
+		}
+	}
+
+	/*
+		PathFinder : siftUp - Move a heap entry towards the root until the heap is ordered
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPos - The position in the heap of the entry to move
+	*/
+	void PathFinder::siftUp(size_t pPos) {
+		const int INDEX = mHeap[pPos];
+		while (pPos > 0) {
+			//Check if the parent should come first
+			const size_t PARENT = (pPos - 1) / 2;
+			if (!isBefore(INDEX, mHeap[PARENT])) break;
+
+			//Move the parent down
+			mHeap[pPos] = mHeap[PARENT];
+			mNodes[mHeap[pPos]].heapIndex = (int)pPos;
+			pPos = PARENT;
+		}
+		mHeap[pPos] = INDEX;
+		mNodes[INDEX].heapIndex = (int)pPos;
+	}
+
+	/*
+		PathFinder : siftDown - Move a heap entry towards the leaves until the heap is ordered
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPos - The position in the heap of the entry to move
+	*/
+	void PathFinder::siftDown(size_t pPos) {
+		const int INDEX = mHeap[pPos];
+		const size_t SIZE = mHeap.size();
+		while (true) {
+			//Find the child that should come first
+			size_t child = pPos * 2 + 1;
+			if (child >= SIZE) break;
+			if (child + 1 < SIZE && isBefore(mHeap[child + 1], mHeap[child])) ++child;
+
+			//Check if the entry should come first
+			if (!isBefore(mHeap[child], INDEX)) break;
+
+			//Move the child up
+			mHeap[pPos] = mHeap[child];
+			mNodes[mHeap[pPos]].heapIndex = (int)pPos;
+			pPos = child;
+		}
+		mHeap[pPos] = INDEX;
+		mNodes[INDEX].heapIndex = (int)pPos;
+	}
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+//! Include the map generation values
+#include "MapGenerationValues.hpp"
+
+namespace BombSquad {
+	/*
+	 *		Name: PathFinder
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Find paths between coordinates on a gameMap using A*, retaining the
+	 *		search buffers between searches so that repeated queries against the
+	 *		same map don't allocate
+	 *
+	 *		Notes:
+	 *		The open list is an indexed binary heap, allowing the score of a queued
+	 *		node to be lowered in place. Node state is stamped with a search
+	 *		generation so buffers don't need to be cleared between searches.
+	 *
+	 *		The connected areas of traversable tiles are labelled when the map is
+	 *		set, allowing searches between disconnected coordinates to fail without
+	 *		being run. The gameMap must not be modified while it is set.
+	 *
+	 *		Where many path lengths from the same coordinate are needed, a single
+	 *		breadth first flood from accumulateDistances replaces the searches
+	**/
+	class PathFinder {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////----------------------------------------Construction---------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			PathFinder : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		PathFinder();
+
+		/*
+			PathFinder : setMap - Set the gameMap that paths will be found on
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pMap - The gameMap object that the coordinates exist on
+			param[in] pTraversable - The Tile Type which should be considered traversable by the algorithm
+		*/
+		void setMap(const gameMap& pMap, const ETileType& pTraversable);
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------------Searching-----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			PathFinder : getRegionID - Get the identifier of the connected area a coordinate is in
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPos - The coordinate to check
+
+			return int - Returns the identifier of the area or -1 if the coordinate isn't traversable
+		*/
+		inline int getRegionID(const coord& pPos) const { return mRegions[mMap->index(pPos.x, pPos.y)]; }
+
+		/*
+			PathFinder : isConnected - Check if a path could exist between two coordinates
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStart - The coordinate of the starting point
+			param[in] pEnd - The coordinate of the ending point
+
+			return bool - Returns true if the coordinates are in the same connected area
+		*/
+		bool isConnected(const coord& pStart, const coord& pEnd) const;
+
+		/*
+			PathFinder : findPath - Find the shortest path between two coordinates
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStart - The coordinate of the starting point for the search
+			param[in] pEnd - The coordinate of the ending point for the search
+			param[out] pPath - Receives the coordinates of the path, excluding the start and including the end
+
+			return bool - Returns true if a path was found
+		*/
+		bool findPath(const coord& pStart, const coord& pEnd, coords& pPath);
+
+		/*
+			PathFinder : accumulateDistances - Add the shortest path length from a coordinate to every reachable coordinate
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSource - The coordinate to measure the path lengths from
+			param[in/out] pTotals - The Map (matching the dimensions of the gameMap) to add the path lengths to
+
+			NOTE:
+			Coordinates that can't be reached from the source are left unchanged, matching
+			the empty path returned by findPath
+		*/
+		void accumulateDistances(const coord& pSource, Map<int>& pTotals);
+
+	private:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-------------------------------------------Values------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		//! Store the A* values for a single coordinate
+		struct Node {
+			//! Store the cost of the best known path to the node
+			unsigned int gScore;
+
+			//! Store the estimated total cost of a path through the node
+			unsigned int fScore;
+
+			//! Store the index of the node that introduced the current
+			int parent;
+
+			//! Store the position of the node in the open heap (-1 when closed)
+			int heapIndex;
+
+			//! Store the search generation the node was last opened in
+			unsigned int stamp;
+		};
+
+		//! Store the map being searched and the tile type that can be traversed
+		const gameMap* mMap;
+		ETileType mTraversable;
+
+		//! Store the connected area identifiers of each coordinate
+		std::vector<int> mRegions;
+
+		//! Store the A* values of each coordinate
+		std::vector<Node> mNodes;
+
+		//! Store the open list as a binary heap of node indices
+		std::vector<int> mHeap;
+
+		//! Store the current search generation
+		unsigned int mGeneration;
+
+		//! Advance the search generation, resetting the stamps if it wraps around
+		void nextGeneration();
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////--------------------------------------------Heap-------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		//! Check if the node at one index should be processed before another
+		inline bool isBefore(const int& pLeft, const int& pRight) const {
+			const Node& LEFT = mNodes[pLeft], &RIGHT = mNodes[pRight];
+			return (LEFT.fScore < RIGHT.fScore || (LEFT.fScore == RIGHT.fScore && LEFT.gScore > RIGHT.gScore));
+		}
+
+		//! Move a heap entry towards the root until the heap is ordered
+		void siftUp(size_t pPos);
+
+		//! Move a heap entry towards the leaves until the heap is ordered
+		void siftDown(size_t pPos);
+	};
+}
@@ -1,8 +1,5 @@
 #include "Region.hpp"
 
-//! Include the required STL objects
-#include <queue>
-
 namespace BombSquad {
 	/*
 		Region : Constructor - Initialise with default values
@@ -74,107 +71,85 @@ namespace BombSquad {
 	/*
 		Region : analyseDepth - Flood search each coordinate to find the distance from a coordinate not contained in the region
 		Created: 08/11/2017
-		Modified: 08/11/2017
-	*/
-	void Region::analyseDepth() {
-		//Create a temporary coordinate element that tracks position and parent object data
-		struct CoordTrace {
-			//! Store the position
-			coord pos;
+		Modified: 16/10/2026
 
-			//! Store the parent of the coordinate
-			CoordTrace* parent = nullptr;
-		};
+		param[in] pScratch - The buffers to use while searching
 
+		NOTE:
+		The depths are found with a single breadth first search seeded from the edges of the region.
+		Coordinates on the bounds of the map have a depth of 0, and coordinates touching (including
+		diagonally) a coordinate outside of the region have a depth of 1
+	*/
+	void Region::analyseDepth(DepthScratch& pScratch) {
 		//Setup the depth map
 		distanceFromExternal.setBounds(locationMap.width(), locationMap.height());
 
+		//Get the dimensions of the map
+		const int WIDTH = (int)locationMap.width(), HEIGHT = (int)locationMap.height();
+
 		//Store the offsets used to find neighbors
 		const coord OFFSETS[] = { {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {-1, 1}, {1, 1}, {1, -1} };
 		const size_t OFFSET_SIZE = sizeof(OFFSETS) / sizeof(const coord);
 
-		//Loop through all coordinates to find their depth
-		for (size_t i = 0; i < contained.size(); i++) {
-			//Store a reference to the current coordinate being processed
-			const coord COORD = contained[i];
-
-			//Create a hit map for searched coordinates
-			hitMap searched(locationMap.width(), locationMap.height());
-
-			//Store a queue of coordinates to process
-			std::queue<CoordTrace*> unsearched;
+		//Clear the frontiers
+		pScratch.current.clear();
+		pScratch.next.clear();
 
-			//Create a CoordTrace Grid
-			Map<CoordTrace> traceGrid(locationMap.width(), locationMap.height());
+		//Flag all of the contained coordinates as unsearched
+		for (size_t i = 0; i < contained.size(); i++)
+			distanceFromExternal[contained[i].x][contained[i].y] = -1;
 
-			//Set the position of the initial coord
-			traceGrid[COORD.x][COORD.y].pos = COORD;
-
-			//Add the current coordinate to the queue
-			unsearched.push(&traceGrid[COORD.x][COORD.y]);
-
-			//Flag the current as searched
-			searched[COORD.x][COORD.y] = 1;
-
-			//Flag if the search has gone out of bounds
-			bool outOfBounds = false;
+		//Find the coordinates to start the search from
+		for (size_t i = 0; i < contained.size(); i++) {
+			//Get a reference to the current coordinate value
+			const coord& COORD = contained[i];
 
-			//Loop through and process trace coords
-			CoordTrace* current = nullptr;
-			while (unsearched.size()) {
-				//Get the next item
-				current = unsearched.front();
-				unsearched.pop();
+			//Check if the coord is on the bounds of the map
+			if (COORD.x == 0 || COORD.y == 0 || COORD.x == WIDTH - 1 || COORD.y == HEIGHT - 1) {
+				distanceFromExternal[COORD.x][COORD.y] = 0;
+				pScratch.current.push_back(COORD);
+				continue;
+			}
 
-				//Check to see if this location is outside of the region
-				if (!locationMap[current->pos.x][current->pos.y])
+			//Check if the coordinate neighbours a non-contained coordinate
+			for (size_t j = 0; j < OFFSET_SIZE; j++) {
+				const coord OFFSET = COORD + OFFSETS[j];
+				if (!locationMap[OFFSET.x][OFFSET.y]) {
+					pScratch.next.push_back(COORD);
 					break;
+				}
+			}
+		}
 
-				//Add neighboring cells to the unsearched list
+		//Expand the search one depth at a time
+		short depth = 0;
+		do {
+			//Add the unsearched neighbours of the current depth to the next
+			for (size_t i = 0; i < pScratch.current.size(); i++) {
 				for (size_t j = 0; j < OFFSET_SIZE; j++) {
 					//Get the offset position
-					const coord OFFSET = current->pos + OFFSETS[j];
+					const coord OFFSET = pScratch.current[i] + OFFSETS[j];
 
 					//Check the coordinate is in bounds
-					if (OFFSET.x < 0 || OFFSET.y < 0 ||
-						OFFSET.x >= (int)searched.width() || OFFSET.y >= (int)searched.height()) {
-						outOfBounds = true;
-						break;
-					}
-
-					//Check if the coordinate has been searched
-					else if (!searched[OFFSET.x][OFFSET.y]) {
-						//Setup the Grid Node
-						traceGrid[OFFSET.x][OFFSET.y].pos = OFFSET;
-						traceGrid[OFFSET.x][OFFSET.y].parent = current;
+					if (OFFSET.x < 0 || OFFSET.y < 0 || OFFSET.x >= WIDTH || OFFSET.y >= HEIGHT) continue;
 
-						//Add the offset into the unsearched queue
-						unsearched.push(&traceGrid[OFFSET.x][OFFSET.y]);
-
-						//Flag the offset in the searched map
-						searched[OFFSET.x][OFFSET.y] = 1;
-					}
+					//Check the coordinate is contained and hasn't been searched
+					else if (locationMap[OFFSET.x][OFFSET.y] && distanceFromExternal[OFFSET.x][OFFSET.y] == -1)
+						pScratch.next.push_back(OFFSET);
 				}
-
-				//If search went out of bounds, break
-				if (outOfBounds) break;
 			}
 
-			//Check to see if an outer-region was found
-			if (current) {
-				//Reset the depth value
-				distanceFromExternal[COORD.x][COORD.y] = -1;
-
-				//Trace the path back
-				while (current) {
-					//Increase the distance
-					distanceFromExternal[COORD.x][COORD.y]++;
-
-					//Move up the chain
-					current = current->parent;
-				}
+			//Assign the depth to the newly reached coordinates
+			++depth;
+			pScratch.current.clear();
+			for (size_t i = 0; i < pScratch.next.size(); i++) {
+				const coord& COORD = pScratch.next[i];
+				if (distanceFromExternal[COORD.x][COORD.y] != -1) continue;
+				distanceFromExternal[COORD.x][COORD.y] = depth;
+				pScratch.current.push_back(COORD);
 			}
-		}
+			pScratch.next.clear();
+		} while (pScratch.current.size());
 	}
 
 	/*
@@ -4,11 +4,29 @@
 #include "MapGenerationValues.hpp"
 
 namespace BombSquad {
+	/*
+	 *		Name: DepthScratch
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Store the frontier buffers used while analysing the depth of a Region,
+	 *		allowing their memory to be reused when analysing multiple Regions
+	**/
+	struct DepthScratch {
+		//! Store the coordinates at the depth being expanded
+		coords current;
+
+		//! Store the coordinates discovered for the following depth
+		coords next;
+	};
+
 	/*
 	 *		Name: Region
 	 *		Author: Mitchell Croft
 	 *		Created: 08/11/2017
-	 *		Modified: 12/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Monitor a collection of coordinates as a Region on a gameMap object
@@ -60,9 +78,19 @@ namespace BombSquad {
 			Region : analyseDepth - Flood search each coordinate to find the distance from a coordinate not 
 									contained in the region
 			Created: 08/11/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
+
+			param[in] pScratch - The buffers to use while searching
+		*/
+		void analyseDepth(DepthScratch& pScratch);
+
+		/*
+			Region : analyseDepth - Flood search each coordinate to find the distance from a coordinate not 
+									contained in the region
+			Created: 16/10/2026
+			Modified: 16/10/2026
 		*/
-		void analyseDepth();
+		inline void analyseDepth() { DepthScratch scratch; analyseDepth(scratch); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////-----------------------------------------Management----------------------------------////////
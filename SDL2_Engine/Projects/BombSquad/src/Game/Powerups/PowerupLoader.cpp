@@ -3,6 +3,7 @@
 //! Include objects used to navigate directories
 #include <dirent.h>
 #include <queue>
+#include <algorithm>
 
 //! Include the required SDL2_Engine objects
 #include <Globals.hpp>
@@ -54,27 +55,64 @@ namespace BombSquad {
 		else						return EPowerupActor::Null;
 	}
 
+	/*
+		normalisePath - Convert a path to lower case with '/' separators so that it can be compared
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPath - The path to convert
+
+		return std::string - Returns the normalised path
+	*/
+	std::string normalisePath(std::string pPath) {
+		for (size_t i = 0; i < pPath.length(); i++)
+			pPath[i] = (pPath[i] == '\\' ? '/' : (char)tolower(pPath[i]));
+		return pPath;
+	}
+
 	/*
 		PowerupLoader : loadDirectory - Load all Objx files in a directory as Powerups
 		Created: 10/11/2017
-		Modified: 13/11/2017
+		Modified: 16/10/2026
 
 		param[in] pDir - the directory to start loading powerups from
+		param[in] pHeadless - Flags if the powerup textures should be skipped (Default false)
 
 		const vector<Powerup> - Returns a constant vector populated with the powerup blueprints
 	*/
-	const std::vector<Powerup> PowerupLoader::loadDirectory(const char* pDir) {
+	const std::vector<Powerup> PowerupLoader::loadDirectory(const char* pDir, const bool& pHeadless /* = false*/) {
 		//Get the required SDL2_Engine objects
 		const Debug::Logger& LOG = Globals::get<Debug::Logger>();
 		Resources& res = Globals::get<Resources>();
 		const Math& MATH = Globals::get<Math>();
-		Rendering::Renderer rend = Globals::get<Rendering::Renderer>();
+
+		//Get the renderer the powerup textures are created with
+		SDL_Renderer* renderer = (pHeadless ? nullptr : Globals::get<Rendering::Renderer>().getRenderer());
 
 		//Create a vector of the files found to process
 		std::vector<std::string> toLoad;
 
-		//Find all objx files
-		{
+		//Find all objx files in the mounted archive, without touching the file system
+		const ResourceArchive& ARCHIVE = res.getArchive();
+		if (ARCHIVE.isOpen()) {
+			//Get the directory in the form to compare against the entries
+			const std::string DIR_PREFIX = normalisePath(pDir);
+			const std::string EXT = ".objx";
+
+			//Check the path of each entry
+			for (size_t i = 0; i < ARCHIVE.getEntryCount(); i++) {
+				const std::string NAME = normalisePath(ARCHIVE.getEntryName(i));
+				if (!NAME.compare(0, DIR_PREFIX.length(), DIR_PREFIX) && NAME.length() > EXT.length() && !NAME.compare(NAME.length() - EXT.length(), EXT.length(), EXT))
+					toLoad.push_back(ARCHIVE.getEntryName(i));
+			}
+
+			//Load the files in a consistent order, as the entries are ordered by hash
+			std::sort(toLoad.begin(), toLoad.end());
+		}
+
+		//Otherwise search the directory for objx files
+		else {
 			//Create a queue to hold the directories to search
 			std::queue<std::string> toSearch;
 
@@ -113,7 +151,7 @@ namespace BombSquad {
 
 						//Stash directories in the search queue
 						else if (dir->d_type == DT_DIR) {
-							toSearch.push(CURR_DIR + elementName + '\\');
+							toSearch.push(CURR_DIR + elementName + '/');
 							continue;
 						}
 
@@ -161,12 +199,13 @@ namespace BombSquad {
 			amask = 0xff000000;
 		}
 
-		{
+		//Create the powerup frames, unless the textures are skipped
+		if (!pHeadless) {
 			//Store an array or colour values to apply to filter the powerup frame
 			const Rendering::Colour FILTER_COL[] = { Utilities::Endian::reverseBytes(Rendering::Colour::Black), Utilities::Endian::reverseBytes(Rendering::Colour::Green), Utilities::Endian::reverseBytes(Rendering::Colour::Red), Utilities::Endian::reverseBytes(Rendering::Colour::Yellow) };
 			
 			//Load the basic spritesheet
-			SDL_Surface* sprites = IMG_Load("resources/Textures/Spritesheet.png");
+			SDL_Surface* sprites = IMG_Load_RW(res.openFile("resources/Textures/Spritesheet.png"), 1);
 
 			//Check the spritesheet was loaded
 			if (!sprites) {
@@ -295,12 +334,12 @@ namespace BombSquad {
 				newObj.setName(pNode.hasProperty("name") ? pNode["name"].readVal<xstring>() : pName);
 
 				//Create the powerups sprite texture
-				{
+				if (!pHeadless) {
 					//Store the deduced filepath
 					const std::string REL_PATH = deductLocation(toLoad[i], pNode["spriteSheet"].readVal<xstring>());
 
 					//Load the specified sprite sheet
-					SDL_Surface* spritesheet = IMG_Load(REL_PATH.c_str());
+					SDL_Surface* spritesheet = IMG_Load_RW(res.openFile(REL_PATH.c_str()), 1);
 
 					//Check the surface was loaded correctly
 					if (!spritesheet) {
@@ -373,7 +412,7 @@ namespace BombSquad {
 					}
 
 					//Create a texture from the surface
-					SDL_Texture* tex = SDL_CreateTextureFromSurface(rend.getRenderer(), toSurface);
+					SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, toSurface);
 
 					//Check the texture was created successfully
 					if (!tex) {
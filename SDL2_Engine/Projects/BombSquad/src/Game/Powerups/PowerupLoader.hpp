@@ -1,7 +1,8 @@
 #pragma once
 
-//! Include the STL map to store loaded textures in
+//! Include the STL containers to store loaded textures and powerups in
 #include <unordered_map>
+#include <vector>
 
 //! Include the powerup values
 #include "Powerup.hpp"
@@ -14,7 +15,7 @@ namespace BombSquad {
 	 *		Name: PowerupLoader
 	 *		Author: Mitchell Croft
 	 *		Created: 10/11/2017
-	 *		Modified: 11/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Recursively load all Objx files within a directory, treating them as
@@ -46,13 +47,19 @@ namespace BombSquad {
 		/*
 			PowerupLoader : loadDirectory - Load all Objx files in a directory as Powerups
 			Created: 10/11/2017
-			Modified: 13/11/2017
+			Modified: 16/10/2026
 
 			param[in] pDir - the directory to start loading powerups from
+			param[in] pHeadless - Flags if the powerup textures should be skipped (Default false)
 
 			const vector<Powerup> - Returns a constant vector populated with the powerup blueprints
+
+			NOTE:
+			When a Resource Archive is mounted the entries packed under pDir are loaded instead of
+			searching the directory. Headless loading doesn't read the spritesheets or create any
+			textures, so it can be used without a Renderer
 		*/
-		const std::vector<Powerup> loadDirectory(const char* pDir);
+		const std::vector<Powerup> loadDirectory(const char* pDir, const bool& pHeadless = false);
 
 		/*
 			PowerupLoader : getTexture - Retrieve a specific texture based on it's ID
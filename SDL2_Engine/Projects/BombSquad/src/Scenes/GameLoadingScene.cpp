@@ -6,6 +6,7 @@
 
 #include <Resources/Resources.hpp>
 #include <Resources/ResourceTypes/LocalResourceFont.hpp>
+#include <Resources/ResourceTypes/LocalResourceTexture.hpp>
 
 #include <Rendering/Renderer.hpp>
 
@@ -36,7 +37,7 @@ namespace BombSquad {
 	/*
 		GameLoadingScene : createScene - Load the values required for the Scene to operate
 		Created: 12/11/2017
-		Modified: 13/11/2017
+		Modified: 16/10/2026
 
 		return bool - Returns true if the Scene was initialised successfully
 	*/
@@ -44,12 +45,19 @@ namespace BombSquad {
 		//Clear the previous UI elements
 		Globals::get<UI::Canvas>().clearCanvas();
 
+		//Get the Resources object
+		Resources& res = Globals::get<Resources>();
+
 		//Load the font
-		mMsgFont = Globals::get<Resources>().loadResource<Font>("resources/Fonts/Ebrima.ttf", 36);
+		mMsgFont = res.loadResource<Font>("resources/Fonts/Ebrima.ttf", 36);
 
 		//Check the font loaded correctly
 		if (mMsgFont->status() != EResourceLoadStatus::Loaded) return false;
 
+		//Begin loading the Game Scene textures, these are retained until the Game Scene takes them
+		mBackgroundLoad = res.loadResourceAsync<Texture>("resources/Textures/GameBackground.png");
+		mSpritesheetLoad = res.loadResourceAsync<Texture>("resources/Textures/Spritesheet.png");
+
 		//Default not completed
 		mLoadedFlag.store(false);
 
@@ -82,11 +90,11 @@ namespace BombSquad {
 	/*
 		GameLoadingScene : update - Check for loading completion
 		Created: 12/11/2017
-		Modified: 13/11/2017
+		Modified: 16/10/2026
 	*/
 	void GameLoadingScene::update() {
-		//Check if the thread has finished
-		if (mLoadedFlag.load()) {
+		//Check if the thread and the texture loads have finished
+		if (mLoadedFlag.load() && mBackgroundLoad->ready() && mSpritesheetLoad->ready()) {
 			//Shutdown the current scene
 			shutdown();
 
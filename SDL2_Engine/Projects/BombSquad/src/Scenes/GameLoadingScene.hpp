@@ -13,7 +13,7 @@ namespace BombSquad {
 	 *		Name: GameLoadingScene
 	 *		Author: Mitchell Croft
 	 *		Created: 12/11/2017
-	 *		Modified: 13/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Provide a visual indication of the behind the scenes process
@@ -30,7 +30,7 @@ namespace BombSquad {
 		/*
 			GameLoadingScene : createScene - Load the values required for the Scene to operate
 			Created: 12/11/2017
-			Modified: 13/11/2017
+			Modified: 16/10/2026
 
 			return bool - Returns true if the Scene was initialised successfully
 		*/
@@ -46,7 +46,7 @@ namespace BombSquad {
 		/*
 			GameLoadingScene : update - Check for loading completion
 			Created: 12/11/2017
-			Modified: 13/11/2017
+			Modified: 16/10/2026
 		*/
 		void update() override;
 
@@ -64,6 +64,10 @@ namespace BombSquad {
 		//! Store the font used to display the loading message
 		SDL2_Engine::LocalResource<SDL2_Engine::Font> mMsgFont;
 
+		//! Store the textures used by the Game Scene, loaded in the background while the map is generated
+		SDL2_Engine::AsyncResource<SDL2_Engine::Texture> mBackgroundLoad;
+		SDL2_Engine::AsyncResource<SDL2_Engine::Texture> mSpritesheetLoad;
+
 		//! Store the thread being used to load the map
 		std::thread mWorker;
 
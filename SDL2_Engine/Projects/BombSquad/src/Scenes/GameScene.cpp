@@ -19,6 +19,9 @@ using namespace SDL2_Engine::Rendering;
 //! Include the basic SDL objects
 #include <SDL.h>
 
+//! Include the STL algorithms used to clamp the tile ranges
+#include <algorithm>
+
 //! Include the required BombSquad objects
 #include "../Game/Management/GameManager.hpp"
 
@@ -31,6 +34,15 @@ using namespace SDL2_Engine::Rendering;
 //! Define the number of frames in the animated bomb
 #define BOMB_FRAMES 6U
 
+//! Define the area in which the game should be rendered
+#define GAME_AREA_X 46
+#define GAME_AREA_Y 58
+#define GAME_AREA_W 1196
+#define GAME_AREA_H 612
+
+//! Define the number of tiles along each side of the tile layer chunks
+#define TILE_CHUNK_SIZE 4
+
 namespace BombSquad {
 	/*
 		GameScene : Constructor - Initialise with default values
@@ -45,7 +57,7 @@ namespace BombSquad {
 	/*
 		GameScene : createScene - Load the values required for the Scene to operate
 		Created: 12/11/2017
-		Modified: 12/11/2017
+		Modified: 16/10/2026
 
 		return bool - Returns true if the Scene was initialised successfully
 	*/
@@ -65,16 +77,27 @@ namespace BombSquad {
 		//Check the texture loaded correctly
 		if (mSpritesheet->status() != EResourceLoadStatus::Loaded) return false;
 
-		//Return success
-		return true;
+		//Get the current map
+		const gameMap& MAP = GM::getMap();
+
+		//Calculate the tile sizes
+		mTileSize = { GAME_AREA_W / (int)MAP.width(), GAME_AREA_H / (int)MAP.height() };
+
+		//Create the cached tile layer, redrawn in chunks of tiles as obstacles are destroyed
+		return mTileLayer.create(mTileSize.x * (int)MAP.width(), mTileSize.y * (int)MAP.height(),
+								 [this](const SDL_Rect& pArea, const SDL_Point& pOffset) { drawTiles(pArea, pOffset); },
+								 mTileSize.x * TILE_CHUNK_SIZE, mTileSize.y * TILE_CHUNK_SIZE);
 	}
 
 	/*
 		GameScene : destroyScene - Destroy the values used to setup the Scene
 		Created: 12/11/2017
-		Modified: 12/11/2017
+		Modified: 16/10/2026
 	*/
 	void GameScene::destroyScene() {
+		//Free the tile layer
+		mTileLayer.destroy();
+
 		//Check if the Game Manager should be destroyed
 		if (mDestroyGM) GM::destroy();
 	}
@@ -122,7 +145,7 @@ namespace BombSquad {
 	/*
 		GameScene : render - Render the Scene to the Window
 		Created: 12/11/2017
-		Modified: 12/11/2017
+		Modified: 16/10/2026
 	*/
 	void GameScene::render() {
 		//Get the renderer object
@@ -132,36 +155,32 @@ namespace BombSquad {
 		rend.drawTexture(mBackground->texture, { 0, 0, 1280, 720 });
 
 		//Define the area in which the game should be rendered
-		const SDL_Rect GAME_AREA = { 46, 58, 1196, 612 };
+		const SDL_Rect GAME_AREA = { GAME_AREA_X, GAME_AREA_Y, GAME_AREA_W, GAME_AREA_H };
 
 		//Get the current map state
 		const gameMap& MAP = GM::getMap();
 
-		//Get the explosive map
-		const Map<float>& DEADLY = GM::getDeadlyTiles();
+		//Get the tile sizes
+		const coord& DIM = mTileSize;
 
-		//Calculate the tile sizes 
-		const coord DIM = { GAME_AREA.w / MAP.width(), GAME_AREA.h / MAP.height() };
+		//Flag the tiles that have changed to be redrawn
+		for (const coord& TILE : GM::getChangedTiles())
+			mTileLayer.markDirty({ DIM.x * TILE.x, DIM.y * TILE.y, DIM.x, DIM.y });
+		GM::clearChangedTiles();
 
-		//Iterate through the map
+		//Render the cached walls and obstacles
+		mTileLayer.draw({ GAME_AREA.x, GAME_AREA.y });
+
+		//Iterate through the map for deadly tiles
 		for (size_t x = 0; x < MAP.width(); x++) {
 			for (size_t y = 0; y < MAP.height(); y++) {
-				//Get the tile value
-				const int TILE = (int)MAP[x][y];
-
-				//Check if it is render-able
-				if (TILE >= 0) {
-					//Create the horribly hard coded source rectangle
-					SDL_Rect src = { TILE * 32, 32, 32, 32 };
-
-					//Render the tile
-					rend.drawTexture(mSpritesheet->texture, { GAME_AREA.x + DIM.x * (int)x, GAME_AREA.y + DIM.y * (int)y, DIM.x, DIM.y }, &src);
-				}
+				//Walls and obstacles are in the tile layer
+				if ((int)MAP[x][y] >= 0) continue;
 
 				//Check if the tile is deadly
-				else if (DEADLY[x][y]) {
+				if (const float DEADLY = GM::getDeadlyScale(x, y)) {
 					//Get the frame number
-					int frame = (int)floor((1.f - DEADLY[x][y]) / (1.f / EXPLOSION_FRAMES));
+					int frame = (int)floor((1.f - DEADLY) / (1.f / EXPLOSION_FRAMES));
 
 					//Create another horribly hard coded source rectangle
 					SDL_Rect src = { 64 + frame * 32, 32, 32, 32 };
@@ -181,19 +200,19 @@ namespace BombSquad {
 			SDL_Rect src;
 
 			//Check if bomb is a mine
-			if (it->second.isMine) src = { 192, 0, 32, 32 };
+			if (it->value.isMine) src = { 192, 0, 32, 32 };
 
 			//Calculate bomb frames
 			else {
 				//Get the frame number
-				int frame = (int)floor((it->second.timer / it->second.fuseLength) / (1.f / BOMB_FRAMES));
+				int frame = (int)floor((it->value.timer / it->value.fuseLength) / (1.f / BOMB_FRAMES));
 
 				//Get another horribly hard coded area
 				src = { frame * 32, 0, 32, 32 };
 			}
 
 			//Render the bomb
-			rend.drawTexture(mSpritesheet->texture, { GAME_AREA.x + DIM.x * it->first.x, GAME_AREA.y + DIM.y * it->first.y, DIM.x, DIM.y }, &src);
+			rend.drawTexture(mSpritesheet->texture, { GAME_AREA.x + DIM.x * it->position.x, GAME_AREA.y + DIM.y * it->position.y, DIM.x, DIM.y }, &src);
 		}
 
 		//Get the Powerup Loader
@@ -204,7 +223,7 @@ namespace BombSquad {
 
 		//Loop through and render the powerups
 		for (auto it = POWERUPS.cbegin(); it != POWERUPS.cend(); ++it) 
-			rend.drawTexture(PUL.getTexture(it->second->getTextureID()), { GAME_AREA.x + DIM.x * it->first.x, GAME_AREA.y + DIM.y * it->first.y, DIM.x, DIM.y });
+			rend.drawTexture(PUL.getTexture(it->value->getTextureID()), { GAME_AREA.x + DIM.x * it->position.x, GAME_AREA.y + DIM.y * it->position.y, DIM.x, DIM.y });
 
 		//Get the current players
 		const auto& PLAYERS = GM::getPlayers();
@@ -221,16 +240,55 @@ namespace BombSquad {
 			};
 
 			//Get the frame
-			SDL_Rect src = *(SDL_Rect*)&ANI.getFrame(EAnimationSet::Body);
+			AniFrame frame = ANI.getFrame(EAnimationSet::Body);
+			SDL_Rect src = { frame.x, frame.y, frame.w, frame.h };
 
 			//Render the frames
 			rend.drawTexture(ANI.getSpriteSheet(EAnimationSet::Body)->texture, drawPos, &src);
 
 			//Get the other frame
-			src = *(SDL_Rect*)&ANI.getFrame(EAnimationSet::Head);
+			frame = ANI.getFrame(EAnimationSet::Head);
+			src = { frame.x, frame.y, frame.w, frame.h };
 
 			//Render the frames
 			rend.drawTexture(ANI.getSpriteSheet(EAnimationSet::Head)->texture, drawPos, &src);
 		}
 	}
+
+	/*
+		GameScene : drawTiles - Draw the static map tiles overlapping an area of the tile layer
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pArea - The area of the tile layer being drawn
+		param[in] pOffset - The offset to apply to the tile layer positions
+	*/
+	void GameScene::drawTiles(const SDL_Rect& pArea, const SDL_Point& pOffset) {
+		//Get the renderer object
+		Renderer& rend = Globals::get<Renderer>();
+
+		//Get the current map state
+		const gameMap& MAP = GM::getMap();
+
+		//Get the range of tiles overlapping the area
+		const size_t LEFT = (size_t)(pArea.x / mTileSize.x), RIGHT = std::min((size_t)((pArea.x + pArea.w - 1) / mTileSize.x), MAP.width() - 1);
+		const size_t TOP = (size_t)(pArea.y / mTileSize.y), BOTTOM = std::min((size_t)((pArea.y + pArea.h - 1) / mTileSize.y), MAP.height() - 1);
+
+		//Iterate through the tiles
+		for (size_t x = LEFT; x <= RIGHT; x++) {
+			for (size_t y = TOP; y <= BOTTOM; y++) {
+				//Get the tile value
+				const int TILE = (int)MAP[x][y];
+
+				//Check if it is render-able
+				if (TILE < 0) continue;
+
+				//Create the horribly hard coded source rectangle
+				SDL_Rect src = { TILE * 32, 32, 32, 32 };
+
+				//Render the tile
+				rend.drawTexture(mSpritesheet->texture, { pOffset.x + mTileSize.x * (int)x, pOffset.y + mTileSize.y * (int)y, mTileSize.x, mTileSize.y }, &src);
+			}
+		}
+	}
 }
@@ -3,13 +3,17 @@
 //! Include the SDL2_Engine objects required to run the scene
 #include <Scenes/ISceneBase.hpp>
 #include <Resources/Resources.hpp>
+#include <Rendering/RenderLayer.hpp>
+
+//! Include the BombSquad coordinate type
+#include "../Game/MapGeneration/MapGenerationValues.hpp"
 
 namespace BombSquad {
 	/*
 	 *		Name: GameScene 
 	 *		Author: Mitchell Croft
 	 *		Created: 11/11/2017
-	 *		Modified: 11/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Render the game elements to the window for the player(s) to see
@@ -26,7 +30,7 @@ namespace BombSquad {
 		/*
 			GameScene : createScene - Load the values required for the Scene to operate
 			Created: 12/11/2017
-			Modified: 12/11/2017
+			Modified: 16/10/2026
 
 			return bool - Returns true if the Scene was initialised successfully
 		*/
@@ -35,7 +39,7 @@ namespace BombSquad {
 		/*
 			GameScene : destroyScene - Destroy the values used to setup the Scene
 			Created: 12/11/2017
-			Modified: 12/11/2017
+			Modified: 16/10/2026
 		*/
 		void destroyScene() override;
 
@@ -49,11 +53,21 @@ namespace BombSquad {
 		/*
 			GameScene : render - Render the Scene to the Window
 			Created: 12/11/2017
-			Modified: 12/11/2017
+			Modified: 16/10/2026
 		*/
 		void render() override;
 
 	private:
+		/*
+			GameScene : drawTiles - Draw the static map tiles overlapping an area of the tile layer
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pArea - The area of the tile layer being drawn
+			param[in] pOffset - The offset to apply to the tile layer positions
+		*/
+		void drawTiles(const SDL_Rect& pArea, const SDL_Point& pOffset);
+
 		//! Flag if the Game Manager should be destroyed with the scene
 		bool mDestroyGM;
 
@@ -65,5 +79,11 @@ namespace BombSquad {
 
 		//! Store the spritesheet used for the game
 		SDL2_Engine::LocalResource<SDL2_Engine::Texture> mSpritesheet;
+
+		//! Store the size of a map tile on screen
+		coord mTileSize;
+
+		//! Store the cached obstacle and wall tiles
+		SDL2_Engine::Rendering::RenderLayer mTileLayer;
 	};
 }
\ No newline at end of file
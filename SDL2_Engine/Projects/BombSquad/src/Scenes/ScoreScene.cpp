@@ -191,7 +191,7 @@ namespace BombSquad {
 	/*
 		ScoreScene : render - Render the Scene to the Window
 		Created: 13/11/2017
-		Modified: 13/11/2017
+		Modified: 16/10/2026
 	*/
 	void ScoreScene::render() {
 		//Get the Window dimensions
@@ -224,13 +224,15 @@ namespace BombSquad {
 			const Player& CURR = mPlayers[i];
 
 			//Get the first frame
-			SDL_Rect source = *(SDL_Rect*)&CURR.animator.getFrame(EAnimationSet::Body);
+			AniFrame frame = CURR.animator.getFrame(EAnimationSet::Body);
+			SDL_Rect source = { frame.x, frame.y, frame.w, frame.h };
 
 			//Render the frame
 			rend.drawTexture(CURR.animator.getSpriteSheet(EAnimationSet::Body)->texture, PLAY_ICO, &source);
 
 			//Get the second frame
-			source = *(SDL_Rect*)&CURR.animator.getFrame(EAnimationSet::Head);
+			frame = CURR.animator.getFrame(EAnimationSet::Head);
+			source = { frame.x, frame.y, frame.w, frame.h };
 
 			//Render the frame
 			rend.drawTexture(CURR.animator.getSpriteSheet(EAnimationSet::Head)->texture, PLAY_ICO, &source);
@@ -1,8 +1,11 @@
 #include <iostream>
 
+//! Include the time functions for seeding recordings
+#include <time.h>
+
 //! Include the basic SDL2_Engine initialisation values
 #include <Initialisation/Initialisation.hpp>
-#include <Rendering/BasicSceneRenderer.hpp>
+#include <Rendering/BatchedSceneRenderer.hpp>
 #include <Input/VirtualAxis.hpp>
 
 using namespace SDL2_Engine::Initialisation;
@@ -17,9 +20,6 @@ using namespace SDL2_Engine::Input;
 #include "Scenes/ExternalMenu.hpp"
 #include "Scenes/PlayerSetupScene.hpp"
 
-//! Allow seeding of random
-#include <time.h>
-
 //! Use a vector to store Virtual Axis
 #include <vector>
 
@@ -75,7 +75,7 @@ void setupExternalUI(SDL2_Engine::UI::UIElements::IUIAction* pObj, const SDL2_En
 	main - Initialise the application and create startup values
 	Author: Mitchell Croft
 	Created: 02/11/2017
-	Modified: 02/11/2017
+	Modified: 16/10/2026
 
 	param[in] pArgCount - The number of command line arguments currently in the pArgs array
 	param[in] pArgs - An array of command line parameters passed to the program
@@ -83,9 +83,6 @@ void setupExternalUI(SDL2_Engine::UI::UIElements::IUIAction* pObj, const SDL2_En
 	return int - Returns the status code for the programs execution
 */
 int main(int pArgCount, char* pArgs[]) {
-	//Seed the random
-	srand(unsigned int(time(NULL)));
-
 	//Create the initialisation object
 	SDL2_Engine_Initialiser setup;
 
@@ -107,6 +104,19 @@ int main(int pArgCount, char* pArgs[]) {
 	//Force the window to restricted size
 	setup.windowValues.properties = SDL2_Engine::EWindowProperties::Style_Fixed;
 
+	//Limit the frame rate to reduce CPU usage
+	setup.loopValues.targetFrameRate = 60;
+
+	//Write log messages from a background thread so the game loop isn't stalled by output
+	setup.loggerValues.mode = SDL2_Engine::Debug::ELogMode::Asynchronous;
+
+	//Read the resources from the packed archive when it has been built
+#ifdef BOMBSQUAD_RESOURCE_ARCHIVE
+	setup.resourceArchive = BOMBSQUAD_RESOURCE_ARCHIVE;
+#else
+	setup.resourceArchive = "resources.pak";
+#endif
+
 	/////////////////////////////////////////////////////////////////////////////////////////////////////
 	////////-----------------------------Process Command Line Arguments--------------------------////////
 	/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -115,14 +125,31 @@ int main(int pArgCount, char* pArgs[]) {
 		//Check if flag is output flag
 		if (!strcmp("-log", pArgs[i])) 
 			setup.loggerValues.storeLog = true;
+
+		//Check if the loose resource files should be used instead of the archive
+		else if (!strcmp("-loose", pArgs[i]))
+			setup.resourceArchive = nullptr;
+
+		//Check if the input should be recorded to a file
+		else if (!strcmp("-record", pArgs[i]) && i + 1 < pArgCount) {
+			setup.recorderValues.mode = EInputRecordMode::Record;
+			setup.recorderValues.path = pArgs[++i];
+			setup.recorderValues.seed = (uint64_t)time(NULL);
+		}
+
+		//Check if the input should be replayed from a file
+		else if (!strcmp("-replay", pArgs[i]) && i + 1 < pArgCount) {
+			setup.recorderValues.mode = EInputRecordMode::Replay;
+			setup.recorderValues.path = pArgs[++i];
+		}
 	}
 
 	/////////////////////////////////////////////////////////////////////////////////////////////////////
 	////////------------------------------------Initialise Renderer------------------------------////////
 	/////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	//Provide a Basic Scene Renderer for operation
-	setup.rendererValues.sceneRenderer = new SDL2_Engine::Rendering::BasicSceneRenderer();
+	//Provide a Batched Scene Renderer for operation
+	setup.rendererValues.sceneRenderer = new SDL2_Engine::Rendering::BatchedSceneRenderer();
 
 	//Create the Scene Manger Initialiser
 	SceneManagerInitialiser sceneSetup(new BombSquad::SplashScene());
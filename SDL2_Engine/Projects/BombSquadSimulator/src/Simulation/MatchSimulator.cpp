@@ -0,0 +1,153 @@
+#include "MatchSimulator.hpp"
+
+//! Include the clock used to time the simulation
+#include <chrono>
+
+//! Include the SDL2_Engine objects used to report the blueprints
+#include <Globals.hpp>
+#include <Debug/Logger.hpp>
+using namespace SDL2_Engine;
+
+namespace BombSquad {
+	/*
+		mixDigest - Combine a value into a running FNV-1a hash
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in/out] pDigest - The hash to combine the value into
+		param[in] pValue - The value to combine
+	*/
+	inline void mixDigest(uint64_t& pDigest, const uint64_t& pValue) {
+		for (size_t i = 0; i < sizeof(uint64_t); i++) {
+			pDigest ^= (pValue >> (i * 8)) & 0xFF;
+			pDigest *= 0x100000001b3ULL;
+		}
+	}
+
+	/*
+		elapsedMilliseconds - Get the time that has passed since a time point
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pStart - The time point to measure from
+
+		return double - Returns the elapsed time in milliseconds
+	*/
+	inline double elapsedMilliseconds(const std::chrono::steady_clock::time_point& pStart) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - pStart).count(); }
+
+	/*
+		runSimulation - Simulate a number of matches using a headless Game Manager
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The SimulationSettings object describing the matches to run
+		param[out] pReport - Receives the results of the simulation
+
+		return bool - Returns true if the simulation was run
+	*/
+	bool runSimulation(const SimulationSettings& pSettings, SimulationReport& pReport) {
+		//Check the settings are usable
+		if (!pSettings.seed || !pSettings.players || pSettings.players > 4 || pSettings.timestep <= 0.f) return false;
+
+		//Create the Game Manager without rendering
+		if (!GM::create(true)) return false;
+
+		//Check there are powerups to drop
+		if (GM::getBlueprints().empty()) Globals::get<Debug::Logger>().logWarning("No powerup blueprints were loaded from 'resources/Powerups/', the matches are simulated without powerups");
+
+		//Setup the match values
+		GM::setMapDimensions(pSettings.mapWidth, pSettings.mapHeight);
+		GM::setObstacleDensity(pSettings.obstacleDensity);
+		GM::setPowerupChance(pSettings.powerupChance);
+		GM::setGenerationWorkers(pSettings.generationWorkers);
+		GM::setProfiling(pSettings.profile);
+
+		//Create the bots, which mustn't move once their controls are created
+		std::vector<SimulationBot> bots(pSettings.players);
+		std::vector<ControlScheme> controls(pSettings.players);
+		for (size_t i = 0; i < bots.size(); i++) {
+			bots[i].setup(i, pSettings.botMode, pSettings.script);
+			controls[i] = bots[i].createControls();
+		}
+
+		//Give the players to the Game Manager
+		GM::setPlayerControls(controls);
+
+		//Reset the report
+		pReport = SimulationReport();
+		pReport.digest = 0xcbf29ce484222325ULL;
+
+		//Get the number of updates before a match is abandoned
+		const size_t TICK_LIMIT = (size_t)(pSettings.timeLimit / pSettings.timestep);
+
+		//Run the matches
+		for (size_t m = 0; m < pSettings.matches; m++) {
+			//Setup the match from its seed
+			GM::setSeed(pSettings.seed + m);
+			GM::setupNewGame();
+
+			//Record the generation timings
+			const double GENERATION = GM::getGenerationReport().milliseconds;
+			pReport.generationMilliseconds += GENERATION;
+			if (GENERATION > pReport.slowestGeneration) pReport.slowestGeneration = GENERATION;
+
+			//Reset the bots
+			for (size_t i = 0; i < bots.size(); i++)
+				bots[i].reset(GM::getMatchSeed());
+
+			//Run the match
+			size_t ticks = 0;
+			const auto MATCH_START = std::chrono::steady_clock::now();
+			for (; ticks < TICK_LIMIT && !GM::isGameOver(); ticks++) {
+				//Generate the bot input
+				if (pSettings.profile) {
+					const auto BOT_START = std::chrono::steady_clock::now();
+					for (size_t i = 0; i < bots.size(); i++) bots[i].update();
+					pReport.botMilliseconds += elapsedMilliseconds(BOT_START);
+				} else for (size_t i = 0; i < bots.size(); i++) bots[i].update();
+
+				//Update the game
+				GM::update(pSettings.timestep);
+			}
+			pReport.updateMilliseconds += elapsedMilliseconds(MATCH_START);
+			pReport.ticks += ticks;
+
+			//Record the outcome
+			const std::vector<Player>& PLAYERS = GM::getPlayers();
+			if (!GM::isGameOver()) pReport.timeouts++;
+			else {
+				size_t alive = 0, winner = 0;
+				for (size_t i = 0; i < PLAYERS.size(); i++) {
+					if (PLAYERS[i].alive) {
+						alive++;
+						winner = i;
+					}
+				}
+				if (alive) pReport.wins[winner]++;
+				else pReport.draws++;
+			}
+
+			//Combine the final state into the digest
+			mixDigest(pReport.digest, ticks);
+			for (size_t i = 0; i < PLAYERS.size(); i++) {
+				mixDigest(pReport.digest, PLAYERS[i].alive);
+				mixDigest(pReport.digest, (uint64_t)PLAYERS[i].position.x);
+				mixDigest(pReport.digest, (uint64_t)PLAYERS[i].position.y);
+			}
+			pReport.matches++;
+		}
+
+		//Remove the bot time from the update time
+		pReport.updateMilliseconds -= pReport.botMilliseconds;
+
+		//Store the update timings
+		pReport.timings = GM::getTimings();
+
+		//Destroy the Game Manager
+		GM::destroy();
+		return true;
+	}
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+//! Include the simulation bots
+#include "SimulationBot.hpp"
+
+//! Include the Game Manager timing values
+#include <Game/Management/GameManager.hpp>
+
+namespace BombSquad {
+	//! Store the values used to setup a simulation
+	struct SimulationSettings {
+		//! The number of matches to simulate
+		size_t matches = 1000;
+
+		//! The dimensions of the maps to generate
+		size_t mapWidth = 25, mapHeight = 15;
+
+		//! The number of players in each match (1 - 4)
+		size_t players = 4;
+
+		//! The seed of the first match, with each following match using the next value (Must not be 0)
+		uint64_t seed = 1;
+
+		//! The fixed time step of each update (in seconds)
+		float timestep = 1.f / 60.f;
+
+		//! The time after which an unfinished match is abandoned (in seconds)
+		float timeLimit = 300.f;
+
+		//! The 0 - 1 scale chance of obstacles and powerups being spawned
+		float obstacleDensity = .35f, powerupChance = .35f;
+
+		//! The number of threads used to generate each map (0 uses one less than the hardware supports)
+		size_t generationWorkers = 0;
+
+		//! The mode used by the bots to generate their input
+		EBotMode botMode = EBotMode::Random;
+
+		//! The steps followed by bots using the Scripted mode
+		std::vector<ScriptStep> script;
+
+		//! Flags if the time spent in the sections of the Game Manager update is recorded
+		bool profile = true;
+	};
+
+	//! Store the results of a simulation
+	struct SimulationReport {
+		//! The number of matches that were simulated
+		size_t matches = 0;
+
+		//! The total number of Game Manager updates
+		size_t ticks = 0;
+
+		//! The number of matches won by each player
+		size_t wins[4] = { 0, 0, 0, 0 };
+
+		//! The number of matches that ended with no players alive
+		size_t draws = 0;
+
+		//! The number of matches that reached the time limit
+		size_t timeouts = 0;
+
+		//! The total time spent generating maps and the longest single generation (in milliseconds)
+		double generationMilliseconds = 0.0, slowestGeneration = 0.0;
+
+		//! The total time spent generating bot input (in milliseconds)
+		double botMilliseconds = 0.0;
+
+		//! The total time spent in Game Manager updates (in milliseconds)
+		double updateMilliseconds = 0.0;
+
+		//! The time spent in the sections of the Game Manager updates
+		UpdateTimings timings;
+
+		//! A hash of the outcome of every match, matching between runs with the same settings
+		uint64_t digest = 0;
+
+		/*
+			SimulationReport : ticksPerSecond - Get the rate that Game Manager updates were processed at
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return double - Returns the number of updates processed per second of update time
+		*/
+		inline double ticksPerSecond() const { return (updateMilliseconds > 0.0 ? ticks / (updateMilliseconds / 1000.0) : 0.0); }
+	};
+
+	/*
+		runSimulation - Simulate a number of matches using a headless Game Manager
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSettings - The SimulationSettings object describing the matches to run
+		param[out] pReport - Receives the results of the simulation
+
+		return bool - Returns true if the simulation was run
+
+		NOTE:
+		The Game Manager must not exist when this function is called. A headless instance is
+		created for the simulation and destroyed before returning. The powerup blueprints are
+		loaded through the Resources Manager in the Globals
+	*/
+	extern bool runSimulation(const SimulationSettings& pSettings, SimulationReport& pReport);
+}
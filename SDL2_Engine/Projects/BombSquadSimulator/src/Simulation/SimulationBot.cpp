@@ -0,0 +1,174 @@
+#include "SimulationBot.hpp"
+
+//! Include the Game Manager to read the state of the match
+#include <Game/Management/GameManager.hpp>
+
+//! Store the chance of a random bot changing direction when it reaches a tile
+#define TURN_CHANCE .25f
+
+//! Store the chance of a random bot placing a bomb when it reaches a tile
+#define BOMB_CHANCE .1f
+
+//! Store the chance of a random bot detonating its mines when it reaches a tile
+#define DETONATE_CHANCE .05f
+
+namespace BombSquad {
+	/*
+		isUnsafe - Check if a tile can't be moved onto by a bot
+		Author: Mitchell Croft
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPos - The coordinate of the tile to check
+
+		return bool - Returns true if the tile is blocked or deadly
+	*/
+	inline bool isUnsafe(const coord& pPos) { return GM::isTileBlocked(pPos) || GM::getDeadlyScale(pPos.x, pPos.y) != 0.f; }
+
+	/*
+		SimulationBot : Constructor - Initialise with default values
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	SimulationBot::SimulationBot() :
+		mIndex(0),
+		mMode(EBotMode::Idle),
+		mStep(0),
+		mStepProgress(0),
+		mDirection(0, 0)
+	{}
+
+	/*
+		SimulationBot : setup - Set the player the bot controls and how it generates input
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pIndex - The index of the player within the Game Manager's player list
+		param[in] pMode - The EBotMode value defining how input is generated
+		param[in] pScript - The steps to loop through when the mode is Scripted
+	*/
+	void SimulationBot::setup(const size_t& pIndex, const EBotMode& pMode, const std::vector<ScriptStep>& pScript) {
+		mIndex = pIndex;
+		mMode = pMode;
+		mScript = pScript;
+	}
+
+	/*
+		SimulationBot : createControls - Create a ControlScheme that reads the input of the bot
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return ControlScheme - Returns an unbound ControlScheme object
+	*/
+	ControlScheme SimulationBot::createControls() const {
+		ControlScheme scheme;
+		scheme.setScriptedInput(&mInput);
+		return scheme;
+	}
+
+	/*
+		SimulationBot : reset - Prepare the bot for the start of a new match
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pMatchSeed - The seed of the match that is starting
+	*/
+	void SimulationBot::reset(const uint64_t& pMatchSeed) {
+		//Give each bot its own stream, separate to the Game Manager's
+		mRandom.seed(pMatchSeed, mIndex + 1);
+
+		//Restart the script
+		mStep = mStepProgress = 0;
+
+		//Clear the input
+		mDirection = coord(0, 0);
+		mInput.clear();
+	}
+
+	/*
+		SimulationBot : update - Write the input for the next Game Manager update
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	void SimulationBot::update() {
+		//Clear the previous input
+		mInput.clear();
+
+		//Check the player is still in the match
+		if (!GM::getPlayers()[mIndex].alive) return;
+
+		//Generate the input
+		switch (mMode) {
+		case EBotMode::Random: updateRandom(); break;
+		case EBotMode::Scripted: updateScripted(); break;
+		default: break;
+		}
+	}
+
+	/*
+		SimulationBot : updateRandom - Generate random input for the player
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	void SimulationBot::updateRandom() {
+		//Get the player being controlled
+		const Player& PLAYER = GM::getPlayers()[mIndex];
+
+		//Only make decisions once a tile has been reached
+		if (PLAYER.moveProg.x || PLAYER.moveProg.y) return;
+
+		//Check if a new direction is needed
+		if ((!mDirection.x && !mDirection.y) || isUnsafe(PLAYER.position + mDirection) || mRandom.chance(TURN_CHANCE)) {
+			//Store the directions that can be travelled in
+			const coord DIRECTIONS[] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+			coord options[4];
+			size_t count = 0;
+
+			//Collect the safe directions
+			for (size_t i = 0; i < 4; i++) {
+				if (!isUnsafe(PLAYER.position + DIRECTIONS[i]))
+					options[count++] = DIRECTIONS[i];
+			}
+
+			//Wait if there is nowhere safe to move to
+			mDirection = (count ? options[mRandom.range(count)] : coord(0, 0));
+		}
+
+		//Set the movement
+		mInput.axis[(size_t)EPlayerAction::Move_Vertical] = (float)mDirection.y;
+		mInput.axis[(size_t)EPlayerAction::Move_Horizontal] = (float)mDirection.x;
+
+		//Set the actions
+		mInput.pressed[(size_t)EPlayerAction::Place_Bomb] = mRandom.chance(BOMB_CHANCE);
+		mInput.pressed[(size_t)EPlayerAction::Detonate_Mine] = mRandom.chance(DETONATE_CHANCE);
+	}
+
+	/*
+		SimulationBot : updateScripted - Generate scripted input for the player
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	void SimulationBot::updateScripted() {
+		//Check there is a script to follow
+		if (mScript.empty()) return;
+
+		//Get the current step
+		const ScriptStep& STEP = mScript[mStep];
+
+		//Set the movement
+		mInput.axis[(size_t)EPlayerAction::Move_Vertical] = STEP.vertical;
+		mInput.axis[(size_t)EPlayerAction::Move_Horizontal] = STEP.horizontal;
+
+		//Press the actions at the start of the step
+		if (!mStepProgress) {
+			mInput.pressed[(size_t)EPlayerAction::Place_Bomb] = STEP.placeBomb;
+			mInput.pressed[(size_t)EPlayerAction::Detonate_Mine] = STEP.detonateMines;
+		}
+
+		//Advance through the script
+		if (++mStepProgress >= STEP.updates) {
+			mStepProgress = 0;
+			mStep = (mStep + 1) % mScript.size();
+		}
+	}
+}
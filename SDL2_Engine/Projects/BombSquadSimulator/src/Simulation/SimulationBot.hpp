@@ -0,0 +1,126 @@
+#pragma once
+
+//! Include the BombSquad player values
+#include <Game/Input/ControlScheme.hpp>
+#include <Game/GameObjects/GameObjectValues.hpp>
+
+//! Include the random number generator used by the bots
+#include <Utilities/Random.hpp>
+
+//! Include the required STL objects
+#include <vector>
+
+namespace BombSquad {
+	//! Store the different ways a simulation bot can generate its input
+	enum class EBotMode { Idle, Random, Scripted };
+
+	//! Store a single step of a looping input script
+	struct ScriptStep {
+		//! The number of updates the step is held for
+		size_t updates;
+
+		//! The movement axis values to hold (-1 to 1)
+		float vertical, horizontal;
+
+		//! Flags if a bomb is placed or mines detonated on the first update of the step
+		bool placeBomb, detonateMines;
+	};
+
+	/*
+	 *		Name: SimulationBot
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Generate the input for a single player of a simulated match, writing
+	 *		it to the ScriptedInput that the player's ControlScheme reads from
+	 *
+	 *		Notes:
+	 *		Random bots wander between free tiles, avoiding deadly tiles, and place
+	 *		bombs and detonate mines by chance. Scripted bots loop through a list of
+	 *		ScriptSteps. All choices are drawn from a generator seeded per match, so
+	 *		a match replays identically from the same seeds.
+	 *
+	 *		The bot must not be moved after its ControlScheme has been created
+	**/
+	class SimulationBot {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////---------------------------------------Construction----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			SimulationBot : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		SimulationBot();
+
+		/*
+			SimulationBot : setup - Set the player the bot controls and how it generates input
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pIndex - The index of the player within the Game Manager's player list
+			param[in] pMode - The EBotMode value defining how input is generated
+			param[in] pScript - The steps to loop through when the mode is Scripted
+		*/
+		void setup(const size_t& pIndex, const EBotMode& pMode, const std::vector<ScriptStep>& pScript);
+
+		/*
+			SimulationBot : createControls - Create a ControlScheme that reads the input of the bot
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return ControlScheme - Returns an unbound ControlScheme object
+		*/
+		ControlScheme createControls() const;
+
+		/*
+			SimulationBot : reset - Prepare the bot for the start of a new match
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pMatchSeed - The seed of the match that is starting
+		*/
+		void reset(const uint64_t& pMatchSeed);
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////------------------------------------------Update-------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		/*
+			SimulationBot : update - Write the input for the next Game Manager update
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void update();
+
+	private:
+		//! Store the index of the player being controlled
+		size_t mIndex;
+
+		//! Store the mode of input generation
+		EBotMode mMode;
+
+		//! Store the steps of the input script
+		std::vector<ScriptStep> mScript;
+
+		//! Store the current step of the script and the updates it has been held for
+		size_t mStep, mStepProgress;
+
+		//! Store the generator for the random choices
+		SDL2_Engine::Utilities::Random mRandom;
+
+		//! Store the direction the random bot is currently travelling in
+		coord mDirection;
+
+		//! Store the input values read by the ControlScheme
+		ScriptedInput mInput;
+
+		//! Generate random input for the player
+		void updateRandom();
+
+		//! Generate scripted input for the player
+		void updateScripted();
+	};
+}
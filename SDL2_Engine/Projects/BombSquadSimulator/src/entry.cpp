@@ -0,0 +1,175 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//! Include the SDL2_Engine objects used by the game play code
+#include <Globals.hpp>
+#include <Debug/Logger.hpp>
+#include <Debug/LoggerInitialiser.hpp>
+#include <Math.hpp>
+#include <Resources/Resources.hpp>
+
+//! Include the simulation functionality
+#include "Simulation/MatchSimulator.hpp"
+
+using namespace SDL2_Engine;
+using namespace BombSquad;
+
+/*
+	printUsage - Output the command line options of the simulator
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+*/
+void printUsage() {
+	printf("Usage: BombSquadSimulator [options]\n"
+		"  -matches <count>      The number of matches to simulate (Default 1000)\n"
+		"  -width <tiles>        The width of the generated maps (Default 25)\n"
+		"  -height <tiles>       The height of the generated maps (Default 15)\n"
+		"  -players <count>      The number of players in each match, 1 - 4 (Default 4)\n"
+		"  -seed <value>         The seed of the first match, must not be 0 (Default 1)\n"
+		"  -timestep <seconds>   The fixed time step of each update (Default 0.0166)\n"
+		"  -limit <seconds>      The time after which a match is abandoned (Default 300)\n"
+		"  -obstacles <chance>   The 0 - 1 chance of obstacles spawning (Default 0.35)\n"
+		"  -powerups <chance>    The 0 - 1 chance of powerups dropping (Default 0.35)\n"
+		"  -workers <count>      The number of map generation threads, 0 for automatic (Default 0)\n"
+		"  -bots <mode>          The bot input mode: idle, random or scripted (Default random)\n"
+		"  -noprofile            Don't record the time spent in each section of the update\n"
+		"  -loose                Read the powerups from the loose resource files instead of the archive\n"
+		"  -log                  Output log messages to a file\n");
+}
+
+/*
+	main - Parse the simulation settings, run the matches and output the results
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	param[in] pArgCount - The number of command line arguments currently in the pArgs array
+	param[in] pArgs - An array of command line parameters passed to the program
+
+	return int - Returns the status code for the programs execution
+*/
+int main(int pArgCount, char* pArgs[]) {
+	//Create the default settings
+	SimulationSettings settings;
+	Initialisation::LoggerInitialiser loggerValues;
+
+	//Read the powerups from the packed archive when it has been built
+#ifdef BOMBSQUAD_RESOURCE_ARCHIVE
+	const char* archive = BOMBSQUAD_RESOURCE_ARCHIVE;
+#else
+	const char* archive = "resources.pak";
+#endif
+
+	//Store a script that walks a loop, placing a bomb and detonating mines along the way
+	settings.script = {
+		{ 20,  0.f,  1.f, true,  false },
+		{ 20,  1.f,  0.f, false, false },
+		{ 20,  0.f, -1.f, true,  false },
+		{ 20, -1.f,  0.f, false, true  }
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+	////////------------------------------Process Command Line Arguments-------------------------////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	for (int i = 1; i < pArgCount; i++) {
+		//Get the value following the flag
+		const char* VALUE = (i + 1 < pArgCount ? pArgs[i + 1] : nullptr);
+
+		//Check for the flags without values
+		if (!strcmp("-log", pArgs[i])) loggerValues.storeLog = true;
+		else if (!strcmp("-noprofile", pArgs[i])) settings.profile = false;
+		else if (!strcmp("-loose", pArgs[i])) archive = nullptr;
+
+		//Check for the flags with values
+		else if (VALUE && !strcmp("-matches", pArgs[i])) { settings.matches = strtoull(VALUE, nullptr, 10); i++; }
+		else if (VALUE && !strcmp("-width", pArgs[i])) { settings.mapWidth = strtoull(VALUE, nullptr, 10); i++; }
+		else if (VALUE && !strcmp("-height", pArgs[i])) { settings.mapHeight = strtoull(VALUE, nullptr, 10); i++; }
+		else if (VALUE && !strcmp("-players", pArgs[i])) { settings.players = strtoull(VALUE, nullptr, 10); i++; }
+		else if (VALUE && !strcmp("-seed", pArgs[i])) { settings.seed = strtoull(VALUE, nullptr, 10); i++; }
+		else if (VALUE && !strcmp("-timestep", pArgs[i])) { settings.timestep = strtof(VALUE, nullptr); i++; }
+		else if (VALUE && !strcmp("-limit", pArgs[i])) { settings.timeLimit = strtof(VALUE, nullptr); i++; }
+		else if (VALUE && !strcmp("-obstacles", pArgs[i])) { settings.obstacleDensity = strtof(VALUE, nullptr); i++; }
+		else if (VALUE && !strcmp("-powerups", pArgs[i])) { settings.powerupChance = strtof(VALUE, nullptr); i++; }
+		else if (VALUE && !strcmp("-workers", pArgs[i])) { settings.generationWorkers = strtoull(VALUE, nullptr, 10); i++; }
+		else if (VALUE && !strcmp("-bots", pArgs[i])) {
+			if (!strcmp("idle", VALUE)) settings.botMode = EBotMode::Idle;
+			else if (!strcmp("random", VALUE)) settings.botMode = EBotMode::Random;
+			else if (!strcmp("scripted", VALUE)) settings.botMode = EBotMode::Scripted;
+			else {
+				printUsage();
+				return 1;
+			}
+			i++;
+		}
+
+		//Unknown flag
+		else {
+			printUsage();
+			return 1;
+		}
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+	////////------------------------------------Run the Simulation-------------------------------////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	//Create the globals needed by the game play code, without a window or any devices
+	Globals::create(0);
+	if (!Globals::addInterface<Debug::Logger>(loggerValues)) {
+		printf("Failed to create the Logger\n");
+		Globals::destroy();
+		return 1;
+	}
+
+	//Create the Resources Manager the powerups are read through, without a Renderer
+	Resources* resources = (Globals::addInterface<Math>() ? Globals::addInterface<Resources>(nullptr) : nullptr);
+	if (!resources) {
+		printf("Failed to create the Resources Manager\n");
+		Globals::destroy();
+		return 1;
+	}
+
+	//Use the archive when it can be read, otherwise the loose files are loaded
+	if (archive) resources->mountArchive(archive);
+
+	//Run the matches
+	SimulationReport report;
+	const bool SUCCESS = runSimulation(settings, report);
+
+	//Destroy the globals
+	Globals::destroy();
+
+	//Check the simulation ran
+	if (!SUCCESS) {
+		printf("The simulation settings are invalid\n");
+		printUsage();
+		return 1;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+	////////------------------------------------Output the Results-------------------------------////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	printf("Simulated %zu match(es) on %zux%zu maps with %zu player(s) from seed %llu\n", report.matches, settings.mapWidth, settings.mapHeight, settings.players, (unsigned long long)settings.seed);
+	printf("  Outcomes:   ");
+	for (size_t i = 0; i < settings.players; i++) printf("P%zu %zu, ", i + 1, report.wins[i]);
+	printf("draws %zu, timeouts %zu\n", report.draws, report.timeouts);
+	printf("  Digest:     %016llx\n", (unsigned long long)report.digest);
+	printf("  Updates:    %zu in %.2fms (%.0f ticks per second, %.2f simulated seconds per match)\n", report.ticks, report.updateMilliseconds, report.ticksPerSecond(), (report.matches ? report.ticks * settings.timestep / report.matches : 0.f));
+	printf("  Generation: %.2fms total, %.3fms average, %.3fms slowest\n", report.generationMilliseconds, (report.matches ? report.generationMilliseconds / report.matches : 0.0), report.slowestGeneration);
+
+	//Output the section timings
+	if (settings.profile && report.timings.updates) {
+		const double PER_UPDATE = 1000000.0 / report.timings.updates;
+		printf("  Sections (total ms / average ns per update):\n");
+		printf("    Bots          %10.2f / %8.1f\n", report.botMilliseconds, report.botMilliseconds * PER_UPDATE);
+		printf("    Players       %10.2f / %8.1f\n", report.timings.players, report.timings.players * PER_UPDATE);
+		printf("    Bombs         %10.2f / %8.1f\n", report.timings.bombs, report.timings.bombs * PER_UPDATE);
+		printf("    Deadly Tiles  %10.2f / %8.1f\n", report.timings.deadlyTiles, report.timings.deadlyTiles * PER_UPDATE);
+	}
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <string.h>
+
+//! Include the SDL2_Engine objects used to write the archive
+#include <Globals.hpp>
+#include <Debug/Logger.hpp>
+#include <Debug/LoggerInitialiser.hpp>
+#include <Resources/ResourceArchive.hpp>
+
+//! Include the SDL objects, keeping this main as the entry point
+#define SDL_MAIN_HANDLED
+#include <SDL.h>
+
+using namespace SDL2_Engine;
+
+/*
+	printUsage - Output the command line options of the packer
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+*/
+void printUsage() {
+	printf("Usage: ResourcePacker <directory> <archive> [options]\n"
+		"  -prefix <path>        The path the game uses to reach the directory, added to each entry (Default none)\n");
+}
+
+/*
+	main - Pack a directory of resources into a Resource Archive
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	param[in] pArgCount - The number of command line arguments currently in the pArgs array
+	param[in] pArgs - An array of command line parameters passed to the program
+
+	return int - Returns the status code for the programs execution
+*/
+int main(int pArgCount, char* pArgs[]) {
+	//Check the required arguments were supplied
+	if (pArgCount < 3) {
+		printUsage();
+		return 1;
+	}
+
+	//Process the optional arguments
+	const char* prefix = nullptr;
+	for (int i = 3; i < pArgCount; i++) {
+		if (i + 1 < pArgCount && !strcmp("-prefix", pArgs[i])) prefix = pArgs[++i];
+		else {
+			printUsage();
+			return 1;
+		}
+	}
+
+	//Create the Logger used to report errors
+	Globals::create(0);
+	if (!Globals::addInterface<Debug::Logger>(Initialisation::LoggerInitialiser())) {
+		printf("Failed to create the Logger\n");
+		Globals::destroy();
+		return 1;
+	}
+
+	//Pack the directory
+	const bool PACKED = ResourceArchive::pack(pArgs[1], pArgs[2], prefix);
+
+	//Report the contents of the archive
+	if (PACKED) {
+		ResourceArchive archive;
+		if (archive.open(pArgs[2])) printf("Packed %zu files from '%s' into '%s'\n", archive.getEntryCount(), pArgs[1], pArgs[2]);
+	}
+
+	//Destroy the globals
+	Globals::destroy();
+	SDL_Quit();
+	return (PACKED ? 0 : 1);
+}
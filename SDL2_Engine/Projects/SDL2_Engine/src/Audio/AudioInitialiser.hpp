@@ -8,7 +8,7 @@
 namespace SDL2_Engine {
 	namespace Initialisation {
 		//! Export the required Bitmask implementation
-		template class SDL2_LIB_INC Utilities::Bitmask<ESupportedCodecs>;
+		SDL2_LIB_TEMPLATE(Utilities::Bitmask<ESupportedCodecs>);
 
 		/*
 		 *		Name: AudioInitialiser
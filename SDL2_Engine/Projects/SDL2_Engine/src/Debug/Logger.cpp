@@ -1,27 +1,297 @@
 #include "Logger.hpp"
 
-//! Include the required headers to construct and output log messages
+//! Include the bounds checked runtime functions on all platforms
+#include "../Utilities/Portability.hpp"
+
+//! Include the console API used to colour the standard output
+#ifdef _WIN32
 #include <windows.h>
+#endif
+
+//! Include the required headers to construct and output log messages
 #include <stdio.h>
 #include <fstream>
 #include <mutex>
 #include <iomanip>
 #include <ctime>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <string>
 
 #include "LoggerInitialiser.hpp"
 
 //! Define a maximum size for the logger output messages
 #define SDL2_ENGINE_LOG_MSG_MAX_LEN 1024U
 
+//! Define the longest time the background writer waits before checking the queue (in milliseconds)
+#define SDL2_ENGINE_LOG_WRITER_INTERVAL 10
+
 namespace SDL2_Engine {
 	namespace Debug {
 		//! Prototype the timestamp retrieval function
-		void getTimeStamp(char pBuffer[64]);
+		void getTimeStamp(const std::time_t& pTime, char pBuffer[64]);
+
+		/*
+		 *		Name: LogRecord
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store a single message waiting in the asynchronous queue
+		**/
+		struct LogRecord {
+			//! Store the position in the queue this record is ready for (Vyukov sequence)
+			std::atomic<size_t> sequence;
+
+			//! Store the color of the message
+			DebugColor color;
+
+			//! Store the time the message was logged
+			std::time_t time;
+
+			//! Store the text of the message
+			char message[SDL2_ENGINE_LOG_MSG_MAX_LEN];
+		};
+
+		/*
+		 *		Name: LoggerInternalData
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Manage the asynchronous queue and the background writer thread
+		 *
+		 *		Notes:
+		 *		The queue is a bounded multiple producer ring buffer. Producers claim
+		 *		a slot with a single compare and swap, write into it and publish it
+		 *		by advancing its sequence. The writer thread is the only consumer
+		**/
+		struct Logger::LoggerInternalData {
+			//! Store the delivery mode and the overflow behaviour
+			ELogMode mode;
+			ELogOverflow overflow;
+
+			//! Prevent console and file output from multiple threads clashing
+			std::mutex outputLock;
+
+			//! Store the ring of records and the mask used to wrap positions
+			LogRecord* records = nullptr;
+			size_t mask = 0;
+
+			//! Store the next position to be claimed by a producer
+			std::atomic<size_t> enqueuePos;
+
+			//! Store the next position to be written by the consumer, along with a copy for producers to read
+			size_t dequeuePos = 0;
+			std::atomic<size_t> consumed;
+
+			//! Store the number of messages dropped, and the number the writer has reported
+			std::atomic<size_t> dropped;
+			size_t reportedDrops = 0;
+
+			//! Store the background writer thread and its controls
+			std::thread writer;
+			std::atomic<bool> running;
+			std::mutex wakeLock;
+			std::condition_variable wake;
+
+			//! Store the log file kept open by the writer, along with the location it was opened at
+			FILE* file = nullptr;
+			filepath fileLocation;
+
+			//! Flag if the log file failed to open at the stored location
+			bool fileFailed = false;
+
+			//! Store the text of the current batch bound for the log file
+			std::string batch;
+
+			/*
+				LoggerInternalData : claim - Claim a record in the queue to write a message into
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[out] pPos - Receives the position of the claimed record
+
+				return LogRecord* - Returns the claimed record or nullptr if the message should be dropped
+			*/
+			LogRecord* claim(size_t& pPos) {
+				size_t pos = enqueuePos.load(std::memory_order_relaxed);
+				while (true) {
+					//Check the state of the record at the position
+					LogRecord& record = records[pos & mask];
+					const size_t SEQ = record.sequence.load(std::memory_order_acquire);
+					const ptrdiff_t DIFF = (ptrdiff_t)SEQ - (ptrdiff_t)pos;
+
+					//Record is free, attempt to claim it
+					if (!DIFF) {
+						if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+							pPos = pos;
+							return &record;
+						}
+					}
+
+					//Queue is full
+					else if (DIFF < 0) {
+						//Discard the message
+						if (overflow == ELogOverflow::Drop || !running.load()) {
+							dropped.fetch_add(1, std::memory_order_relaxed);
+							return nullptr;
+						}
+
+						//Wake the writer and wait for it to make room
+						wake.notify_one();
+						std::this_thread::yield();
+						pos = enqueuePos.load(std::memory_order_relaxed);
+					}
+
+					//Another producer claimed the position
+					else pos = enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			/*
+				LoggerInternalData : publish - Mark a claimed record as ready to be written
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRecord - The record that was claimed
+				param[in] pPos - The position the record was claimed at
+			*/
+			inline void publish(LogRecord* pRecord, const size_t& pPos) {
+				pRecord->sequence.store(pPos + 1, std::memory_order_release);
+
+				//Wake the writer early if the queue is becoming full
+				if (pPos - consumed.load(std::memory_order_relaxed) >= (mask + 1) / 2) wake.notify_one();
+			}
+
+			/*
+				LoggerInternalData : writerLoop - Write queued messages in batches until the Logger is destroyed
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pLogger - The Logger that owns the queue
+			*/
+			void writerLoop(const Logger* pLogger) {
+				while (true) {
+					//Write everything that is waiting
+					const bool STOPPING = !running.load();
+					drain(pLogger);
+
+					//Exit once the final messages have been written
+					if (STOPPING) break;
+
+					//Wait for more messages
+					std::unique_lock<std::mutex> guard(wakeLock);
+					wake.wait_for(guard, std::chrono::milliseconds(SDL2_ENGINE_LOG_WRITER_INTERVAL));
+				}
+
+				//Close the log file
+				if (file) {
+					fclose(file);
+					file = nullptr;
+				}
+			}
+
+			/*
+				LoggerInternalData : drain - Write all of the published records to the output locations
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pLogger - The Logger that owns the queue
+			*/
+			void drain(const Logger* pLogger) {
+				//Lock the output locations for the batch
+				std::lock_guard<std::mutex> guard(outputLock);
+				char time[64];
+				batch.clear();
+
+				//Report messages that were dropped since the last batch
+				const size_t DROPPED = dropped.load(std::memory_order_relaxed);
+				if (DROPPED != reportedDrops) {
+					char buffer[128];
+					snprintf(buffer, sizeof(buffer), "WARNING: Logger dropped %zu message(s) as the queue was full", DROPPED - reportedDrops);
+					getTimeStamp(std::time(nullptr), time);
+					pLogger->outputToSTDOutput(DebugColor::YELLOW, time, buffer);
+					appendToBatch(pLogger, time, buffer);
+					reportedDrops = DROPPED;
+				}
+
+				//Process the published records in order
+				while (true) {
+					LogRecord& record = records[dequeuePos & mask];
+					if (record.sequence.load(std::memory_order_acquire) != dequeuePos + 1) break;
+
+					//Output the message
+					getTimeStamp(record.time, time);
+					pLogger->outputToSTDOutput(record.color, time, record.message);
+					appendToBatch(pLogger, time, record.message);
+
+					//Release the record for the next lap of the ring
+					record.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+					consumed.store(++dequeuePos, std::memory_order_relaxed);
+				}
+
+				//Write the batch to the log file
+				if (batch.size() && openFile(pLogger)) {
+					fwrite(batch.data(), sizeof(char), batch.size(), file);
+					fflush(file);
+				}
+			}
+
+			/*
+				LoggerInternalData : appendToBatch - Add a message to the text bound for the log file
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pLogger - The Logger that owns the queue
+				param[in] pTime - The timestamp for when the message was logged
+				param[in] pMessage - The text of the message
+			*/
+			inline void appendToBatch(const Logger* pLogger, const char* pTime, const char* pMessage) {
+				if (!pLogger->mLogOutput) return;
+				batch += pTime;
+				batch += pMessage;
+				batch += "\n\n";
+			}
+
+			/*
+				LoggerInternalData : openFile - Ensure the log file is open at the current output location
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pLogger - The Logger that owns the queue
+
+				return bool - Returns true if the log file is open
+			*/
+			bool openFile(const Logger* pLogger) {
+				//Check if the location has changed
+				if (fileLocation == pLogger->mLogLocation && (file || fileFailed)) return !fileFailed;
+
+				//Close the previous file
+				if (file) fclose(file);
+
+				//Open the file at the new location
+				fileLocation = pLogger->mLogLocation;
+				file = fopen((fileLocation + "Logger.log").c_str(), "a");
+
+				//Report the failure once and stop writing to the location
+				fileFailed = (file == nullptr);
+				if (fileFailed) {
+					char time[64];
+					getTimeStamp(std::time(nullptr), time);
+					pLogger->outputToSTDOutput(DebugColor::RED, time, "ERROR: Logger failed to open the log file at the specified location");
+				}
+				return (file != nullptr);
+			}
+		};
 
 		/*
 			Logger : logFormatted - Log a formatted string to the defined output locations
 			Created: 20/07/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			param[in] pFormat - A c-string that contains the text and formatting data to be output
 			param[in] ... - The additional arguments to be inserted into the formatted string
@@ -30,116 +300,123 @@ namespace SDL2_Engine {
 			See http://www.cplusplus.com/reference/cstdio/printf/ for formatting options
 		*/
 		void Logger::logFormatted(const char* pFormat, ...) const {
-			//Create a buffer to hold the compiled string
-			char buffer[SDL2_ENGINE_LOG_MSG_MAX_LEN] = { '\0' };
-
 			//Create a parameter list
 			va_list args;
 			va_start(args, pFormat);
 
-			//Format the string into the buffer
-			vsprintf_s(buffer, pFormat, args);
+			//Send the message to be outputted
+			outputFormatted(DebugColor::WHITE, "", pFormat, args);
 
 			//End the argument list
 			va_end(args);
-
-			//Send the message to be outputted
-			outputMessage(DebugColor::WHITE, buffer);
 		}
 
 		/*
 			Logger : logFormatted - Log a formatted string to the defined output locations in a specific color
 			Created: 20/07/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			param[in] pColor - The color to output the text in (Only applies to the standard output window)
 			param[in] pFormat - A c-string that contains the text and formatting data to be output
 			param[in] ... - The additional arguments to be inserted into the formatted string
 		*/
 		void Logger::logFormatted(const DebugColor& pColor, const char* pFormat, ...) const {
-			//Create a buffer to hold the compiled string
-			char buffer[SDL2_ENGINE_LOG_MSG_MAX_LEN] = { '\0' };
-
 			//Create a parameter list
 			va_list args;
 			va_start(args, pFormat);
 
-			//Format the string into the buffer
-			vsprintf_s(buffer, pFormat, args);
+			//Send the message to be outputted
+			outputFormatted(pColor, "", pFormat, args);
 
 			//End the argument list
 			va_end(args);
-
-			//Send the message to be outputted
-			outputMessage(pColor, buffer);
 		}
 
 		/*
 			Logger : logWarning - Log a formatted warning string to the defined output locations
 			Created: 20/07/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			param[in] pFormat - A c-string that contains the text and formatting data to be output
 			param[in] ... - The additional arguments to be inserted into the formatted string
 		*/
 		void Logger::logWarning(const char* pFormat, ...) const {
-			//Create a buffer to hold the compiled string
-			char buffer[SDL2_ENGINE_LOG_MSG_MAX_LEN] = { "WARNING: " };
-
-			//Get the length of the starting elements
-			const size_t LENGTH = strlen(buffer);
-
 			//Create a parameter list
 			va_list args;
 			va_start(args, pFormat);
 
-			//Format the string into the buffer
-			vsprintf_s(buffer + LENGTH, SDL2_ENGINE_LOG_MSG_MAX_LEN - LENGTH, pFormat, args);
+			//Send the message to be outputted
+			outputFormatted(DebugColor::YELLOW, "WARNING: ", pFormat, args);
 
 			//End the argument list
 			va_end(args);
-
-			//Send the message to be outputted
-			outputMessage(DebugColor::YELLOW, buffer);
 		}
 
 		/*
 			Logger : logError - Log a formatted error string to the defined output locations
 			Created: 20/07/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			param[in] pFormat - A c-string that contains the text and formatting data to be output
 			param[in] ... - The additional arguments to be inserted into the formatted string
 		*/
 		void Logger::logError(const char* pFormat, ...) const {
-			//Create a buffer to hold the compiled string
-			char buffer[SDL2_ENGINE_LOG_MSG_MAX_LEN] = { "ERROR: " };
-
-			//Get the length of the starting elements
-			const size_t LENGTH = strlen(buffer);
-
 			//Create a parameter list
 			va_list args;
 			va_start(args, pFormat);
 
-			//Format the string into the buffer
-			vsprintf_s(buffer + LENGTH, SDL2_ENGINE_LOG_MSG_MAX_LEN - LENGTH, pFormat, args);
+			//Send the message to be outputted
+			outputFormatted(DebugColor::RED, "ERROR: ", pFormat, args);
 
 			//End the argument list
 			va_end(args);
+		}
 
-			//Send the message to be outputted
-			outputMessage(DebugColor::RED, buffer);
+		/*
+			Logger : getMode - Get the way messages are delivered to the output locations
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return ELogMode - Returns the mode the Logger was created with
+		*/
+		ELogMode Logger::getMode() const { return (mData ? mData->mode : ELogMode::Immediate); }
+
+		/*
+			Logger : getDroppedCount - Get the number of messages discarded because the queue was full
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the total number of dropped messages
+		*/
+		size_t Logger::getDroppedCount() const { return (mData ? mData->dropped.load(std::memory_order_relaxed) : 0); }
+
+		/*
+			Logger : flush - Wait until all queued messages have been written
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			NOTE:
+			Only messages that were queued before the call are guaranteed to be written
+		*/
+		void Logger::flush() const {
+			if (mData && mData->running.load()) mData->drain(this);
 		}
 
 		/*
 			Logger : setOutputLocation - Set the folder location where the log file will be created
 			Created: 20/07/2017
-			Modified: 13/10/2017
+			Modified: 16/10/2026
 
 			param[in] pLocation - A string indicating the file location to store the file
 		*/
 		void Logger::setOutputLocation(const char* pLocation) {
+			//Write the messages queued for the previous location
+			flush();
+
+			//Prevent the writer reading the location while it changes
+			std::unique_lock<std::mutex> guard;
+			if (mData) guard = std::unique_lock<std::mutex>(mData->outputLock);
+
 			//Save the new location
 			mLogLocation = pLocation;
 
@@ -153,33 +430,152 @@ namespace SDL2_Engine {
 		/*
 			Logger : Constructor - Initialise with default values
 			Created: 20/07/2017
-			Modified: 13/10/2017
+			Modified: 16/10/2026
 
 			param[in] pSetup - Defines how the Logger should be setup
 		*/
 		Logger::Logger(const Initialisation::LoggerInitialiser& pSetup) : 
 			mLogOutput(pSetup.storeLog), 
-			mLogLocation(pSetup.logLocation)
-		{}
+			mLogLocation(pSetup.logLocation),
+			mData(nullptr)
+		{
+			//Create the internal data
+			mData = new LoggerInternalData();
+
+			//Store the delivery settings
+			mData->mode = pSetup.mode;
+			mData->overflow = pSetup.overflow;
+			mData->enqueuePos = 0;
+			mData->consumed = 0;
+			mData->dropped = 0;
+			mData->running = false;
+
+			//Round the queue capacity up to a power of two
+			size_t capacity = 2;
+			while (capacity < pSetup.queueCapacity) capacity <<= 1;
+			mData->mask = capacity - 1;
+		}
+
+		/*
+			Logger : createInterface - Start the background writer if running asynchronously
+			Created: 20/07/2017
+			Modified: 16/10/2026
+
+			return bool - Returns true if the Logger was created successfully
+		*/
+		bool Logger::createInterface() {
+			//Immediate output requires no setup
+			if (mData->mode != ELogMode::Asynchronous) return true;
+
+			//Create the queue records
+			const size_t CAPACITY = mData->mask + 1;
+			mData->records = new LogRecord[CAPACITY];
+			for (size_t i = 0; i < CAPACITY; i++)
+				mData->records[i].sequence.store(i, std::memory_order_relaxed);
+
+			//Start the writer thread
+			mData->running = true;
+			mData->writer = std::thread(&LoggerInternalData::writerLoop, mData, this);
+			return true;
+		}
+
+		/*
+			Logger : destroyInterface - Write any queued messages and deallocate the memory used by the logger values
+			Created: 20/07/2017
+			Modified: 16/10/2026
+		*/
+		void Logger::destroyInterface() {
+			//Stop the writer once the remaining messages have been written
+			if (mData->writer.joinable()) {
+				{
+					std::lock_guard<std::mutex> guard(mData->wakeLock);
+					mData->running = false;
+				}
+				mData->wake.notify_one();
+				mData->writer.join();
+			}
+
+			//Delete the internal data
+			delete[] mData->records;
+			delete mData;
+			mData = nullptr;
+		}
+
+		/*
+			Logger : outputFormatted - Format a message and relay it to the destinations
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pColor - The color value that is to be used when outputting to the standard out
+			param[in] pPrefix - A c-string to place before the formatted text
+			param[in] pFormat - A c-string that contains the text and formatting data to be output
+			param[in] pArgs - The additional arguments to be inserted into the formatted string
+		*/
+		void Logger::outputFormatted(const DebugColor& pColor, const char* pPrefix, const char* pFormat, va_list pArgs) const {
+			//Get the length of the starting elements
+			const size_t LENGTH = strlen(pPrefix);
+
+			//Format directly into a queue record when running asynchronously
+			if (mData && mData->running.load()) {
+				size_t pos;
+				LogRecord* record = mData->claim(pos);
+				if (!record) return;
+
+				//Fill the record
+				record->color = pColor;
+				record->time = std::time(nullptr);
+				memcpy(record->message, pPrefix, LENGTH);
+				vsnprintf(record->message + LENGTH, SDL2_ENGINE_LOG_MSG_MAX_LEN - LENGTH, pFormat, pArgs);
+
+				//Hand the record to the writer
+				mData->publish(record, pos);
+				return;
+			}
+
+			//Create a buffer to hold the compiled string
+			char buffer[SDL2_ENGINE_LOG_MSG_MAX_LEN];
+			memcpy(buffer, pPrefix, LENGTH);
+
+			//Format the string into the buffer
+			vsnprintf(buffer + LENGTH, SDL2_ENGINE_LOG_MSG_MAX_LEN - LENGTH, pFormat, pArgs);
+
+			//Send the message to be outputted
+			outputMessage(pColor, buffer);
+		}
 
 		/*
 			Logger : outputMessage - Uniform messaging function used to relay the text to the destinations
 			Created: 20/07/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			param[in] pDebugColor - The color value that is to be used when outputting to the standard out
 			param[in] pMessage - The text to be output to the locations
 		*/
 		void Logger::outputMessage(const DebugColor& pColor, const char* pMessage) const {
-			//Keep a mutex to prevent multiple threads clashing over write access
-			static std::mutex lock;
+			//Copy the message into a queue record when running asynchronously
+			if (mData && mData->running.load()) {
+				size_t pos;
+				LogRecord* record = mData->claim(pos);
+				if (!record) return;
+
+				//Fill the record
+				record->color = pColor;
+				record->time = std::time(nullptr);
+				strncpy(record->message, pMessage, SDL2_ENGINE_LOG_MSG_MAX_LEN - 1);
+				record->message[SDL2_ENGINE_LOG_MSG_MAX_LEN - 1] = '\0';
+
+				//Hand the record to the writer
+				mData->publish(record, pos);
+				return;
+			}
 
 			//Generate the timestamp
 			char buffer[64];
-			getTimeStamp(buffer);
+			getTimeStamp(std::time(nullptr), buffer);
 
-			//Create a lock guard to control the mutex
-			std::lock_guard<std::mutex> guard(lock);
+			//Create a lock guard to prevent multiple threads clashing over write access
+			std::unique_lock<std::mutex> guard;
+			if (mData) guard = std::unique_lock<std::mutex>(mData->outputLock);
 
 			//Output the text to the specified destinations
 			if (mLogOutput) outputToFile(buffer, pMessage);
@@ -189,13 +585,17 @@ namespace SDL2_Engine {
 		/*
 			Logger : outputToSTDOutput - Output the message to the standard output
 			Created: 20/07/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			param[in] pColor - The color to output the message in
 			param[in] pTime - The timestamp for when the event occurred
 			param[in] pMessage - The text to be output to the output
+
+			NOTE:
+			Outside of Windows the console attribute is converted to ANSI escape codes
 		*/
 		void Logger::outputToSTDOutput(const DebugColor& pColor, const char* pTime, const char* pMessage) const {
+		#ifdef _WIN32
 			//Get a handle to the standard output
 			HANDLE hnd = GetStdHandle(STD_OUTPUT_HANDLE);
 
@@ -207,6 +607,21 @@ namespace SDL2_Engine {
 
 			//Reset the output color
 			SetConsoleTextAttribute(hnd, DebugColor::WHITE);
+		#else
+			//Console attributes store blue, green and red in the low bits while ANSI orders them red, green, blue
+			auto toANSI = [](const ubyte& pBits) -> int { return ((pBits & 4) >> 2) | (pBits & 2) | ((pBits & 1) << 2); };
+
+			//Split the attribute into the foreground and background nibbles
+			const ubyte FORE = pColor & 0x0F;
+			const ubyte BACK = (pColor >> 4) & 0x0F;
+
+			//Set the output color, with the intensity bit selecting the bright variants
+			if (BACK) printf("\x1b[%d;%dm", ((FORE & 8) ? 90 : 30) + toANSI(FORE), ((BACK & 8) ? 100 : 40) + toANSI(BACK));
+			else printf("\x1b[%dm", ((FORE & 8) ? 90 : 30) + toANSI(FORE));
+
+			//Output the message and reset the output color
+			printf("%s%s\x1b[0m\n\n", pTime, pMessage);
+		#endif
 		}
 		
 		/*
@@ -232,20 +647,18 @@ namespace SDL2_Engine {
 		}
 
 		/*
-			getTimeStamp - Get the current timestamp as a string and store it in a buffer
+			getTimeStamp - Get a timestamp as a string and store it in a buffer
 			Author: Mitchell Croft
 			Created: 20/07/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
-			param[in/out] pBuffer - The string buffer to store the current timestamp
+			param[in] pTime - The time value to convert
+			param[in/out] pBuffer - The string buffer to store the timestamp
 		*/
-		void getTimeStamp(char pBuffer[64]) {
-			//Get the current time
-			std::time_t gTime = std::time(nullptr);
-
+		void getTimeStamp(const std::time_t& pTime, char pBuffer[64]) {
 			//Get the local time
 			std::tm lTime;
-			localtime_s(&lTime, &gTime);
+			localtime_s(&lTime, &pTime);
 
 			//Place the time in the buffer
 			strftime(pBuffer, 64, "%c\n", &lTime);
@@ -3,6 +3,12 @@
 //! Allow for string streams in order to construct the log messages
 #include <sstream>
 
+//! Allow for variable argument lists to be passed between the formatting functions
+#include <cstdarg>
+
+//! Allow the logging state to be read by the writer thread
+#include <atomic>
+
 //! Include the required SDL2_Engine objects
 #include "../__LibraryManagement.hpp"
 #include "../Utilities/IGlobal.hpp"
@@ -19,11 +25,17 @@ namespace SDL2_Engine {
 		 *		Name: Logger
 		 *		Author: Mitchell Croft
 		 *		Created: 20/07/2017
-		 *		Modified: 13/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Allow for the logging of text to the output window and/or
 		 *		an external log file
+		 *
+		 *		Notes:
+		 *		In the Asynchronous mode messages are formatted directly into a slot of a
+		 *		lock-free ring buffer and written in batches by a background thread that
+		 *		keeps the log file open. All queued messages are written before the Logger
+		 *		is destroyed
 		**/
 		class SDL2_LIB_INC Logger : public Utilities::IGlobal {
 		public:
@@ -53,7 +65,7 @@ namespace SDL2_Engine {
 			/*
 				Logger : logFormatted - Log a formatted string to the defined output locations
 				Created: 20/07/2017
-				Modified: 05/10/2017
+				Modified: 16/10/2026
 
 				param[in] pFormat - A c-string that contains the text and formatting data to be output
 				param[in] ... - The additional arguments to be inserted into the formatted string
@@ -66,7 +78,7 @@ namespace SDL2_Engine {
 			/*
 				Logger : logFormatted - Log a formatted string to the defined output locations in a specific color
 				Created: 20/07/2017
-				Modified: 05/10/2017
+				Modified: 16/10/2026
 
 				param[in] pColor - The color to output the text in (Only applies to the standard output window)
 				param[in] pFormat - A c-string that contains the text and formatting data to be output
@@ -77,7 +89,7 @@ namespace SDL2_Engine {
 			/*
 				Logger : logWarning - Log a formatted warning string to the defined output locations
 				Created: 20/07/2017
-				Modified: 05/10/2017
+				Modified: 16/10/2026
 
 				param[in] pFormat - A c-string that contains the text and formatting data to be output
 				param[in] ... - The additional arguments to be inserted into the formatted string
@@ -87,7 +99,7 @@ namespace SDL2_Engine {
 			/*
 				Logger : logError - Log a formatted error string to the defined output locations
 				Created: 20/07/2017
-				Modified: 05/10/2017
+				Modified: 16/10/2026
 
 				param[in] pFormat - A c-string that contains the text and formatting data to be output
 				param[in] ... - The additional arguments to be inserted into the formatted string
@@ -101,16 +113,16 @@ namespace SDL2_Engine {
 			/*
 				Logger : isLoggingOutput - Get the current logging state of the Logger
 				Created: 20/07/2017
-				Modified: 20/07/2017
+				Modified: 16/10/2026
 
-				return const bool& - Returns true if the Logger is logging to an external file
+				return bool - Returns true if the Logger is logging to an external file
 			*/
-			inline const bool& isLoggingOutput() const noexcept { return mLogOutput; }
+			inline bool isLoggingOutput() const noexcept { return mLogOutput; }
 
 			/*
 				Logger : setLoggingOutput - Set whether the the Logger will output to an external file
 				Created: 20/07/2017
-				Modified: 20/07/2017
+				Modified: 16/10/2026
 
 				param[in] pState - A boolean value indicating the new logging state
 			*/
@@ -128,12 +140,37 @@ namespace SDL2_Engine {
 			/*
 				Logger : setOutputLocation - Set the folder location where the log file will be created
 				Created: 20/07/2017
-				Modified: 13/10/2017
+				Modified: 16/10/2026
 
 				param[in] pLocation - A string indicating the file location to store the file
 			*/
 			void setOutputLocation(const char* pLocation);
 
+			/*
+				Logger : getMode - Get the way messages are delivered to the output locations
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return ELogMode - Returns the mode the Logger was created with
+			*/
+			ELogMode getMode() const;
+
+			/*
+				Logger : getDroppedCount - Get the number of messages discarded because the queue was full
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the total number of dropped messages
+			*/
+			size_t getDroppedCount() const;
+
+			/*
+				Logger : flush - Wait until all queued messages have been written
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void flush() const;
+
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////--------------------------------Construction/Destruction-----------------------------////////
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,27 +178,27 @@ namespace SDL2_Engine {
 			/*
 				Logger : Constructor - Initialise with default values
 				Created: 20/07/2017
-				Modified: 13/10/2017
+				Modified: 16/10/2026
 
 				param[in] pSetup - Defines how the Logger should be setup
 			*/
 			Logger(const Initialisation::LoggerInitialiser& pSetup);
 
 			/*
-				Logger : createInterface - Empty function
+				Logger : createInterface - Start the background writer if running asynchronously
 				Created: 20/07/2017
-				Modified: 06/10/2017
+				Modified: 16/10/2026
 
 				return bool - Returns true if the Logger was created successfully
 			*/
-			inline bool createInterface() override { return true; }
+			bool createInterface() override;
 
 			/*
-				Logger : destroyInterface - Deallocate the memory used by the logger values
+				Logger : destroyInterface - Write any queued messages and deallocate the memory used by the logger values
 				Created: 20/07/2017
-				Modified: 13/10/2017
+				Modified: 16/10/2026
 			*/
-			inline void destroyInterface() override {}
+			void destroyInterface() override;
 
 			/*
 				Logger : update - Empty function, required to instantiate instances
@@ -175,16 +212,32 @@ namespace SDL2_Engine {
 			////////-------------------------------------Behavior Values---------------------------------////////
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			
-			//! Flag if the output should be sent to a file
-			bool mLogOutput;
+			//! Flag if the output should be sent to a file (Read by the writer thread)
+			std::atomic<bool> mLogOutput;
 
 			//! Store the location to output the log file
 			filepath mLogLocation;
+
+			//! Define the internal protected elements for the Logger
+			struct LoggerInternalData;
+			LoggerInternalData* mData;
+
+			/*
+				Logger : outputFormatted - Format a message and relay it to the destinations
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pColor - The color value that is to be used when outputting to the standard out
+				param[in] pPrefix - A c-string to place before the formatted text
+				param[in] pFormat - A c-string that contains the text and formatting data to be output
+				param[in] pArgs - The additional arguments to be inserted into the formatted string
+			*/
+			void outputFormatted(const DebugColor& pColor, const char* pPrefix, const char* pFormat, va_list pArgs) const;
 			
 			/*
 				Logger : outputMessage - Uniform messaging function used to relay the text to the destinations
 				Created: 20/07/2017
-				Modified: 05/10/2017
+				Modified: 16/10/2026
 
 				param[in] pDebugColor - The color value that is to be used when outputting to the standard out
 				param[in] pMessage - The text to be output to the locations
@@ -5,11 +5,14 @@ namespace SDL2_Engine {
 		/*
 			LoggerInitialiser : Constructor - Initialise with default values
 			Created: 06/10/2017
-			Modified: 12/10/2017
+			Modified: 16/10/2026
 		*/
 		LoggerInitialiser::LoggerInitialiser() :
 			storeLog(false),
-			logLocation("./")
+			logLocation("./"),
+			mode(Debug::ELogMode::Immediate),
+			queueCapacity(1024),
+			overflow(Debug::ELogOverflow::Drop)
 		{}
 	}
 }
@@ -10,7 +10,7 @@ namespace SDL2_Engine {
 		 *		Name: LoggerInitialiser
 		 *		Author: Mitchell Croft
 		 *		Created: 06/10/2017
-		 *		Modified: 13/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Store initialisation values for the Logger object
@@ -22,10 +22,19 @@ namespace SDL2_Engine {
 			//! Store the location to output the log file to (Default "./")
 			Debug::filepath logLocation;
 
+			//! Flag how messages are delivered to the output locations (Default Immediate)
+			Debug::ELogMode mode;
+
+			//! The number of messages the asynchronous queue can hold, rounded up to a power of two (Default 1024)
+			size_t queueCapacity;
+
+			//! Flag how the asynchronous queue behaves when it is full (Default Drop)
+			Debug::ELogOverflow overflow;
+
 			/*
 				LoggerInitialiser : Constructor - Initialise with default values
 				Created: 06/10/2017
-				Modified: 12/10/2017
+				Modified: 16/10/2026
 			*/
 			LoggerInitialiser();
 		};
@@ -9,9 +9,27 @@
 namespace SDL2_Engine {
 	namespace Debug {
 		//! Export the required FString implementation
-		template class SDL2_LIB_INC Utilities::FString<FILENAME_MAX>;
+		SDL2_LIB_TEMPLATE(Utilities::FString<FILENAME_MAX>);
 
 		//Create a basic type define for a filepath
 		typedef Utilities::FString<FILENAME_MAX> filepath;
+
+		//! Flag the ways that the Logger can deliver messages to their destinations
+		enum class ELogMode {
+			//! Messages are written by the calling thread before the log function returns
+			Immediate,
+
+			//! Messages are queued and written in batches by a background thread
+			Asynchronous
+		};
+
+		//! Flag how the asynchronous Logger behaves when its queue is full
+		enum class ELogOverflow {
+			//! New messages are discarded and counted, the count is reported once there is room
+			Drop,
+
+			//! The calling thread waits until the background thread makes room
+			Block
+		};
 	}
 }
\ No newline at end of file
@@ -9,6 +9,11 @@
 //! Include the required standard objects
 #include <unordered_map>
 #include <vector>
+#include <mutex>
+#include <stdexcept>
+
+//! Define the maximum number of interface types that can be assigned slots
+#define GLOBALS_MAX_SLOTS 64
 
 namespace SDL2_Engine {
 
@@ -19,40 +24,62 @@ namespace SDL2_Engine {
 	 *		Name: GlobalsInternalData
 	 *		Author: Mitchell Croft
 	 *		Created: 04/10/2017
-	 *		Modified: 02/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Store internal standard library objects
 	**/
 	struct Globals::GlobalsInternalData {
-		//! Store the map of the separate Global interfaces
-		std::unordered_map<Utilities::typeID, Utilities::IGlobal*> interfaces;
+		//! Store the separate Global interfaces indexed by slot
+		Utilities::IGlobal* slots[GLOBALS_MAX_SLOTS] = {};
 
 		//! Store the order in which to update the Global interfaces
-		std::vector<Utilities::typeID> updateOrder;
+		std::vector<Utilities::IGlobal*> updateOrder;
 
 		//! Store the Application Version ID
 		Utilities::VersionDescriptor versionID;
 	};
 
+	/*
+	 *		Name: GlobalsSlotRegistry
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *		
+	 *		Purpose:
+	 *		Store the slots assigned to interface types for the lifetime of the
+	 *		application, so the slots cached by each module remain valid if the
+	 *		Globals singleton is destroyed and created again
+	**/
+	struct GlobalsSlotRegistry {
+		//! Store the slot assigned to each type ID
+		std::unordered_map<Utilities::typeID, size_t> slots;
+
+		//! Prevent simultaneous assignment from multiple threads
+		std::mutex lock;
+
+		//! Retrieve the registry object
+		static GlobalsSlotRegistry& get() { static GlobalsSlotRegistry registry; return registry; }
+	};
+
 	/*
 		Globals : Constructor - Initialise with default values
 		Created: 19/07/2017
-		Modified: 04/10/2017
+		Modified: 16/10/2026
 	*/
-	Globals::Globals() : mData(nullptr) {}
+	Globals::Globals() : mData(nullptr), mSlots(nullptr) {}
 
 	/*
 		Globals : introduceInterface - Setup a new interface object for addition into the Globals map
 		Created: 19/07/2017
-		Modified: 11/10/2017
+		Modified: 16/10/2026
 
 		param[in] pInter - A pointer to the new interface object to setup
-		param[in] pID - The ID of the original type of the interface
+		param[in] pSlot - The slot assigned to the original type of the interface
 
 		return IGlobal* - Returns a pointer if the interface was created successfully or nullptr if it failed
 	*/
-	Utilities::IGlobal* Globals::introduceInterface(Utilities::IGlobal* pInter, const Utilities::typeID& pID) {
+	Utilities::IGlobal* Globals::introduceInterface(Utilities::IGlobal* pInter, const size_t& pSlot) {
 		//Attempt to setup the interface
 		if (!pInter->createInterface()) {
 			//Destroy the interface
@@ -66,39 +93,41 @@ namespace SDL2_Engine {
 		}
 
 		//Add the interface to the management values
-		mData->interfaces[pID] = pInter;
-		mData->updateOrder.push_back(pID);
+		mData->slots[pSlot] = pInter;
+		mData->updateOrder.push_back(pInter);
 
 		//Return success
 		return pInter;
 	}
 
 	/*
-		Globals : interfaceExists - Check to see if a specified interface exists
-		Created: 04/10/2017
-		Modified: 11/10/2017
-
-		param[in] pID - The ID of the interface to search for
-
-		return bool - Returns true if an Interface with the specified ID exists in the Manager
-	*/
-	bool Globals::interfaceExists(const Utilities::typeID& pID) const { return (mData->interfaces.find(pID) != mData->interfaces.end()); }
+		Globals : reserveSlot - Retrieve the slot assigned to the type with the specified ID
+		Created: 16/10/2026
+		Modified: 16/10/2026
 
-	/*
-		Globals : retrieve - Retrieve a pointer to the specified interface
-		Created: 04/10/2017
-		Modified: 11/10/2017
+		param[in] pID - The ID of the type to retrieve the slot of
 
-		param[in] pID - The ID of the interface to search for
+		return size_t - Returns the slot index assigned to the type
 
-		return IGlobal* - Returns a IGlobal interface pointer to the specified interface
+		NOTE:
+		This is called once per type by each module, with the result cached by Globals::slotOf
 	*/
-	Utilities::IGlobal* Globals::retrieve(const Utilities::typeID& pID) const {
-		//Look for the interface
-		auto iter = mData->interfaces.find(pID);
-
-		//Return the pointer
-		return (iter != mData->interfaces.end() ? iter->second : nullptr);
+	size_t Globals::reserveSlot(const Utilities::typeID& pID) {
+		//Get the registry
+		GlobalsSlotRegistry& registry = GlobalsSlotRegistry::get();
+		std::lock_guard<std::mutex> guard(registry.lock);
+
+		//Check for an existing slot
+		auto found = registry.slots.find(pID);
+		if (found != registry.slots.end()) return found->second;
+
+		//Check there is space for another slot
+		if (registry.slots.size() == GLOBALS_MAX_SLOTS) throw new std::runtime_error("Globals has run out of interface slots. Increase GLOBALS_MAX_SLOTS to add more interface types");
+
+		//Assign the next slot
+		const size_t slot = registry.slots.size();
+		registry.slots[pID] = slot;
+		return slot;
 	}
 
 	/*
@@ -115,7 +144,7 @@ namespace SDL2_Engine {
 	/*
 		Globals : create - Create the Globals singleton
 		Created: 19/07/2017
-		Modified: 02/11/2017
+		Modified: 16/10/2026
 
 		param[in] pID - A starting Version Descriptor ID
 	*/
@@ -128,6 +157,7 @@ namespace SDL2_Engine {
 
 		//Create the data container
 		mInstance->mData = new GlobalsInternalData();
+		mInstance->mSlots = mInstance->mData->slots;
 
 		//Store the application version
 		mInstance->mData->versionID = pID;
@@ -136,18 +166,18 @@ namespace SDL2_Engine {
 	/*
 		Globals : update - Updates all internal IGlobal interface objects
 		Created: 19/07/2017
-		Modified: 04/10/2017
+		Modified: 16/10/2026
 	*/
 	void Globals::update() {
 		//Loop through the different interfaces and call their update functions
-		for (size_t i = 0, length = mInstance->mData->updateOrder.size(); i < length; i++)
-			mInstance->mData->interfaces[mInstance->mData->updateOrder[i]]->update();
+		for (Utilities::IGlobal* inter : mInstance->mData->updateOrder)
+			inter->update();
 	}
 
 	/*
 		Globals : destroy - Destroy all internal IGlobal interface objects in the reverse order of creation
 		Created: 19/07/2017
-		Modified: 04/10/2017
+		Modified: 16/10/2026
 	*/
 	void Globals::destroy() {
 		//Check the singleton instance has been created
@@ -157,7 +187,7 @@ namespace SDL2_Engine {
 				//Reverse through the interfaces and destroy them
 				for (int i = (int)mInstance->mData->updateOrder.size() - 1; i >= 0; i--) {
 					//Get the interface
-					auto inter = mInstance->mData->interfaces[mInstance->mData->updateOrder[i]];
+					auto inter = mInstance->mData->updateOrder[i];
 
 					//Run the destroy function
 					inter->destroyInterface();
@@ -168,6 +198,7 @@ namespace SDL2_Engine {
 
 				//Delete the data object
 				delete mInstance->mData;
+				mInstance->mSlots = nullptr;
 			}
 
 			//Delete the singleton instance
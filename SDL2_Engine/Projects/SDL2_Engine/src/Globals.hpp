@@ -4,6 +4,9 @@
 #include "__LibraryManagement.hpp"
 #include "Utilities/TypeID.hpp"
 
+//! Include the type trait checks used to validate template types
+#include <type_traits>
+
 namespace SDL2_Engine {
 	//! Prototype the Utilities values
 	namespace Utilities { class IGlobal; struct VersionDescriptor; }
@@ -12,10 +15,15 @@ namespace SDL2_Engine {
 	 *		Name: Globals
 	 *		Author: Mitchell Croft
 	 *		Created: 19/07/2017
-	 *		Modified: 02/11/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Manage a number of Global Interface objects from a single location.
+	 *
+	 *		Notes:
+	 *		Each interface type is assigned a slot index the first time it is used,
+	 *		which each module caches so that retrieving an interface is a single
+	 *		array index rather than a hash map lookup
 	**/
 	class SDL2_LIB_INC Globals {
 	public:
@@ -26,7 +34,7 @@ namespace SDL2_Engine {
 		/*
 			Globals : addInterface - Add a new interface object to the Globals singleton
 			Created: 19/07/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 
 			Template T - The type of Interface based object to be added to the Globals object
 			Template TArgs - Parameter pack of initialisation types
@@ -40,21 +48,21 @@ namespace SDL2_Engine {
 			//Assert template types of the IGlobal interface
 			static_assert(std::is_base_of<Utilities::IGlobal, T>::value, "Interfaces added to the Globals singleton object are required to inherit from the abstract IGlobal object");
 
-			//Get the ID of the type
-			const auto id = Utilities::typeToID<T>();
+			//Get the slot of the type
+			const size_t slot = slotOf<T>();
 
 			//Check if the interface already exists
-			if (mInstance->interfaceExists(id))
-				return false;
+			if (mInstance->mSlots[slot])
+				return nullptr;
 
 			//Add the interface to the Globals object
-			return (T*)mInstance->introduceInterface(new T(pArgs...), id);
+			return (T*)mInstance->introduceInterface(new T(pArgs...), slot);
 		}
 
 		/*
 			Globals : get - Get an interface of the specified type from the Globals manager
 			Created: 19/07/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 
 			Template T - The type of Interface to retrieve from the Globals object
 
@@ -69,7 +77,8 @@ namespace SDL2_Engine {
 			static_assert(std::is_base_of<Utilities::IGlobal, T>::value, "Interfaces retrieved from the Globals singleton object are required to inherit from the abstract IGlobal object");
 
 			//Return the Interface
-			return *(T*)mInstance->retrieve(Utilities::typeToID<T>()); 
+			const size_t slot = slotOf<T>();
+			return *(T*)mInstance->mSlots[slot]; 
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,7 +88,7 @@ namespace SDL2_Engine {
 		/*
 			Globals : interfaceExists - Check to see if an interface of a specific type exists
 			Created: 04/10/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 
 			Template T - The type of interface to check for
 
@@ -90,8 +99,9 @@ namespace SDL2_Engine {
 			//Assert template types of the IGlobal interface
 			static_assert(std::is_base_of<Utilities::IGlobal, T>::value, "Interfaces retrieved from the Globals singleton object are required to inherit from the abstract IGlobal object");
 
-			//Convert type to ID
-			return mInstance->interfaceExists(Utilities::typeToID<T>());
+			//Check the slot of the type
+			const size_t slot = slotOf<T>();
+			return (mInstance->mSlots[slot] != nullptr);
 		}
 
 		/*
@@ -119,14 +129,14 @@ namespace SDL2_Engine {
 		/*
 			Globals : update - Updates all internal IGlobal interface objects
 			Created: 19/07/2017
-			Modified: 04/10/2017
+			Modified: 16/10/2026
 		*/
 		static void update();
 
 		/*
 			Globals : destroy - Destroy all internal IGlobal interface objects in the reverse order of creation
 			Created: 19/07/2017
-			Modified: 04/10/2017
+			Modified: 16/10/2026
 		*/
 		static void destroy();
 
@@ -150,17 +160,24 @@ namespace SDL2_Engine {
 		struct GlobalsInternalData;
 		GlobalsInternalData* mData;
 
+		//! Store the interfaces indexed by slot (nullptr for slots without an interface)
+		Utilities::IGlobal** mSlots;
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////----------------------------------Management Functions-------------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 
 		//! Setup an interface object for inclusion in the Globals object
-		Utilities::IGlobal* introduceInterface(Utilities::IGlobal* pInter, const Utilities::typeID& pID);
+		Utilities::IGlobal* introduceInterface(Utilities::IGlobal* pInter, const size_t& pSlot);
 
-		//! Check if an interface with a specified ID exists in the current manager
-		bool interfaceExists(const Utilities::typeID& pID) const;
+		//! Retrieve the slot assigned to the type with the specified ID, assigning a new one if required
+		static size_t reserveSlot(const Utilities::typeID& pID);
 
-		//! Retrieve the pointer to the specified interface
-		Utilities::IGlobal* retrieve(const Utilities::typeID& pID) const;
+		//! Retrieve the slot assigned to a type, cached after the first call
+		template<typename T>
+		static inline size_t slotOf() {
+			static const size_t SLOT = reserveSlot(Utilities::typeToID<T>());
+			return SLOT;
+		}
 	};
 }
\ No newline at end of file
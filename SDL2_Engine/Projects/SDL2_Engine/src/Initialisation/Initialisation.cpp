@@ -7,10 +7,12 @@
 #include "../Math.hpp"
 #include "../Window/Window.hpp"
 #include "../Time.hpp"
+#include "../Utilities/Clock.hpp"
 #include "../Input/Controllers/Controllers.hpp"
 #include "../Input/Keyboard/Keyboard.hpp"
 #include "../Input/Mouse/Mouse.hpp"
 #include "../Input/AxisInput.hpp"
+#include "../Input/InputRecorder.hpp"
 #include "../Rendering/Renderer.hpp"
 #include "../Audio/Audio.hpp"
 #include "../Resources/Resources.hpp"
@@ -26,7 +28,7 @@ namespace SDL2_Engine {
 			SDL2_Engine_Init - Initialise the SDL2_Engine and begin operation
 			Author: Mitchell Croft
 			Created: 06/10/2017
-			Modified: 02/11/2017
+			Modified: 16/10/2026
 
 			param[in] pSetup - An SDL2_Engine_Initialiser object defining how the program should be created
 
@@ -41,6 +43,8 @@ namespace SDL2_Engine {
 
 			//Store a reference to the required Global objects
 			Window* window = nullptr;
+			Time* time = nullptr;
+			Input::InputRecorder* recorder = nullptr;
 			Rendering::Renderer* renderer = nullptr;
 			Scenes::SceneManager* sceneManager = nullptr;
 
@@ -49,7 +53,7 @@ namespace SDL2_Engine {
 				//Create the Math object
 				if (Globals::addInterface<Math>()) {
 					//Prompt initial SDL setup
-					SDL_Init(NULL);
+					SDL_Init(0);
 
 					/////////////////////////////////////////////////////////////////////////////////////////////////////
 					////////-------------------------------------Setup Systems-----------------------------------////////
@@ -58,9 +62,51 @@ namespace SDL2_Engine {
 					//Setup the window
 					if (!(window = Globals::addInterface<Window>(pSetup.windowValues))) errorNum = EInitialisationError::Window_Initialisation_Failed;
 
+					//Setup the Input Recorder before Time, so replayed frames are read before time and input are updated
+					if (!(int)errorNum && pSetup.initialiseSystems & EInitialiseSystems::Input && pSetup.recorderValues.mode != EInputRecordMode::None)
+						if (!(recorder = Globals::addInterface<Input::InputRecorder>(pSetup.recorderValues))) errorNum = EInitialisationError::Input_Recorder_Initialisation_Failed;
+
 					//Check for Time inclusion
-					if (!(int)errorNum && pSetup.initialiseSystems & EInitialiseSystems::Time)
-						if (!Globals::addInterface<Time>()) errorNum = EInitialisationError::Time_Initialisation_Failed;
+					if (!(int)errorNum && pSetup.initialiseSystems & EInitialiseSystems::Time) {
+						//Replays drive time from the recorded deltas
+						Utilities::IClock* clock = pSetup.loopValues.clock;
+						if (recorder && recorder->isReplaying()) {
+							//Delete the assigned Clock (if it exists)
+							if (clock) delete clock;
+
+							//Give the Input Recorder a clock to advance
+							Utilities::VirtualClock* replayClock = new Utilities::VirtualClock();
+							recorder->setReplayClock(replayClock);
+							clock = replayClock;
+						}
+
+						//Create the Time object, deleting the clock if Time was never constructed to take ownership of it
+						if (!(time = Globals::addInterface<Time>(clock))) {
+							if (clock) delete clock;
+							errorNum = EInitialisationError::Time_Initialisation_Failed;
+						}
+
+						//Apply the recorded time step of a replay, without limiting the frame rate
+						else if (recorder && recorder->isReplaying()) {
+							if (recorder->getTimestep() > 0.f) time->setFixedStep(recorder->getTimestep(), pSetup.loopValues.maxFixedSteps);
+						}
+
+						//Apply the loop pacing values
+						else {
+							if (pSetup.loopValues.mode == ELoopMode::Fixed) time->setFixedStep(pSetup.loopValues.fixedTimeStep, pSetup.loopValues.maxFixedSteps);
+							time->setFrameRate(pSetup.loopValues.targetFrameRate);
+						}
+					}
+
+					//Time values were supplied without a Time object to use them
+					else {
+						//Fixed steps are driven by the Time object
+						if (!(int)errorNum && pSetup.loopValues.mode == ELoopMode::Fixed)
+							Globals::get<Debug::Logger>().logWarning("SDL2_Engine_Init requested a fixed time step loop without initialising the Time system. Scenes will only receive variable updates");
+
+						//Delete the assigned Clock (if it exists)
+						if (pSetup.loopValues.clock) delete pSetup.loopValues.clock;
+					}
 					
 					//Check for Input
 					if (!(int)errorNum && pSetup.initialiseSystems & EInitialiseSystems::Input) {
@@ -86,8 +132,14 @@ namespace SDL2_Engine {
 						if (!Globals::addInterface<Audio>(pSetup.audioValues)) errorNum = EInitialisationError::Audio_Initialisation_Failed;
 
 					//Check for Local Resources
-					if (!(int)errorNum && pSetup.initialiseSystems & EInitialiseSystems::Local_Resources) 
-						if (!Globals::addInterface<Resources>(renderer->getRenderer())) errorNum = EInitialisationError::Local_Resources_Initialisation_Failed;
+					if (!(int)errorNum && pSetup.initialiseSystems & EInitialiseSystems::Local_Resources) {
+						//Create the Resources object
+						Resources* resources = Globals::addInterface<Resources>(renderer->getRenderer());
+						if (!resources) errorNum = EInitialisationError::Local_Resources_Initialisation_Failed;
+
+						//Mount the packed resources, continuing with loose files if they can't be opened
+						else if (pSetup.resourceArchive) resources->mountArchive(pSetup.resourceArchive);
+					}
 
 					//Setup the Scene Manager
 					if (!(int)errorNum)
@@ -99,7 +151,22 @@ namespace SDL2_Engine {
 					
 					//Run the Game Loop
 					if (!(int)errorNum) {
+						//Get the clock for the frame limiter, so that a virtual clock also controls the frame rate
+						Utilities::SteadyClock steadyClock;
+						Utilities::IClock& clock = (time ? time->getClock() : steadyClock);
+
+						//Get the timing values for the frame limiter
+						const Utilities::clockTicks FREQUENCY = clock.frequency();
+						const Utilities::clockTicks FRAME_TICKS = (pSetup.loopValues.targetFrameRate && !(recorder && recorder->isReplaying()) ? FREQUENCY / pSetup.loopValues.targetFrameRate : 0);
+						const Utilities::clockTicks SPIN_TICKS = FREQUENCY * pSetup.loopValues.spinMargin / 1000;
+
+						//Store the point in time the current frame should end
+						Utilities::clockTicks deadline = clock.peek() + FRAME_TICKS;
+
 						do {
+							//Store the time the frame began processing
+							const Utilities::clockTicks FRAME_START = clock.peek();
+
 							//Update SDL events
 							SDL_PumpEvents();
 
@@ -109,6 +176,10 @@ namespace SDL2_Engine {
 								//Check for quite event
 								if (evt.type == SDL_QUIT)
 									sceneManager->quit();
+
+								//Check for the loss of render target contents
+								else if (evt.type == SDL_RENDER_TARGETS_RESET)
+									renderer->notifyTargetsReset();
 							}
 
 							//Update the global objects
@@ -116,6 +187,20 @@ namespace SDL2_Engine {
 
 							//Render the frame
 							renderer->presentFrame();
+
+							//Get the time spent processing the frame
+							Utilities::clockTicks now = clock.peek();
+							if (time) time->recordFrameWork((float)clock.toSeconds(now - FRAME_START));
+
+							//Wait for the remainder of the frame
+							if (FRAME_TICKS) {
+								clock.waitUntil(deadline, SPIN_TICKS);
+								now = clock.peek();
+
+								//Advance the deadline, resynchronising if more than a frame has been missed
+								deadline += FRAME_TICKS;
+								if (now > deadline) deadline = now + FRAME_TICKS;
+							}
 						} while (sceneManager->isRunning());
 					}
 				}
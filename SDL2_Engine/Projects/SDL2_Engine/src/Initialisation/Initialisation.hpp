@@ -1,9 +1,11 @@
 #pragma once
 
 //! Include the Initialisation objects
+#include "LoopInitialiser.hpp"
 #include "../Debug/LoggerInitialiser.hpp"
 #include "../Window/WindowInitialiser.hpp"
 #include "../Input/AxisInputInitialiser.hpp"
+#include "../Input/InputRecorderInitialiser.hpp"
 #include "../Rendering/RendererInitialiser.hpp"
 #include "../Audio/AudioInitialiser.hpp"
 #include "../Scenes/SceneManagerInitialiser.hpp"
@@ -20,6 +22,7 @@ namespace SDL2_Engine {
 			Logger_Initialisation_Failed,
 			Math_Initialisation_Failed,
 			Window_Initialisation_Failed,
+			Input_Recorder_Initialisation_Failed,
 			Time_Initialisation_Failed,
 			Controllers_Initialisation_Failed,
 			Keyboard_Initialisation_Failed,
@@ -57,13 +60,13 @@ namespace SDL2_Engine {
 		};
 
 		//! Export the required Bitmask implementation
-		template class SDL2_LIB_INC Utilities::Bitmask<EInitialiseSystems>;
+		SDL2_LIB_TEMPLATE(Utilities::Bitmask<EInitialiseSystems>);
 
 		/*
 		 *		Name: SDL2_Engine_Initialiser
 		 *		Author: Mitchell Croft
 		 *		Created: 06/10/2017
-		 *		Modified: 02/11/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Store the initialisation setup parameters 
@@ -75,6 +78,9 @@ namespace SDL2_Engine {
 			//! Store the current version for the application
 			Utilities::VersionDescriptor applicationVersion;
 
+			//! Store the values used to pace the main loop
+			LoopInitialiser loopValues;
+
 			//! Store the values used to initialise the Logger object
 			LoggerInitialiser loggerValues;
 
@@ -84,12 +90,18 @@ namespace SDL2_Engine {
 			//! Store the values used to initialise the Input Object
 			AxisInputInitialiser inputValues;
 
+			//! Store the values used to initialise the Input Recorder object, which is only created when recording or replaying
+			InputRecorderInitialiser recorderValues;
+
 			//! Store the values used to initialise the Renderer object
 			RendererInitialiser rendererValues;
 
 			//! Store the values used to initialise the Audio object
 			AudioInitialiser audioValues;
 
+			//! Store the path of a Resource Archive to read resources from (Default nullptr uses loose files)
+			const char* resourceArchive = nullptr;
+
 			//! Store the values used to initialise the Scene Manager object
 			SceneManagerInitialiser* sceneManagerValues = nullptr;
 
@@ -101,7 +113,7 @@ namespace SDL2_Engine {
 			SDL2_Engine_Init - Initialise the SDL2_Engine and begin operation
 			Author: Mitchell Croft
 			Created: 06/10/2017
-			Modified: 02/11/2017
+			Modified: 16/10/2026
 
 			param[in] pSetup - An SDL2_Engine_Initialiser object defining how the program should be created
 
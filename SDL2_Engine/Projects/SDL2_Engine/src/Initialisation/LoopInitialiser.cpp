@@ -0,0 +1,19 @@
+#include "LoopInitialiser.hpp"
+
+namespace SDL2_Engine {
+	namespace Initialisation {
+		/*
+			LoopInitialiser : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		LoopInitialiser::LoopInitialiser() :
+			mode(ELoopMode::Variable),
+			targetFrameRate(0),
+			fixedTimeStep(1.f / 60.f),
+			maxFixedSteps(5),
+			spinMargin(2),
+			clock(nullptr)
+		{}
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+//! Include the SDL2_Engine objects
+#include "../__LibraryManagement.hpp"
+
+namespace SDL2_Engine {
+	//! Prototype the Clock interface
+	namespace Utilities { class IClock; }
+
+	namespace Initialisation {
+		//! Flag the ways the main loop can advance the simulation
+		enum class ELoopMode {
+			//! Scenes are updated once per frame with the variable frame delta
+			Variable,
+
+			//! Scenes are additionally given fixed size simulation steps through ISceneBase::fixedUpdate
+			Fixed
+		};
+
+		/*
+		 *		Name: LoopInitialiser
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *		
+		 *		Purpose:
+		 *		Store initialisation values for the pacing of the main loop
+		**/
+		struct SDL2_LIB_INC LoopInitialiser {
+			//! The way the simulation is advanced each frame (Default Variable)
+			ELoopMode mode;
+
+			//! The number of frames per second the loop is limited to, 0 for no limit (Default 0)
+			unsigned int targetFrameRate;
+
+			//! The number of seconds of simulation time processed by each fixed step (Default 1/60)
+			float fixedTimeStep;
+
+			//! The maximum number of fixed steps processed in a single frame before time is discarded (Default 5)
+			unsigned int maxFixedSteps;
+
+			//! The number of milliseconds before the end of a frame that the limiter stops sleeping and spins (Default 2)
+			unsigned int spinMargin;
+
+			//! Store a pointer to the clock the Time object reads from, ownership is passed to the engine (Default nullptr, uses a SteadyClock)
+			Utilities::IClock* clock;
+
+			/*
+				LoopInitialiser : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			LoopInitialiser();
+		};
+	}
+}
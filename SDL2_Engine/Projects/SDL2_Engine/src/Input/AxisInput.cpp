@@ -10,6 +10,7 @@
 
 #include "VirtualAxis.hpp"
 #include "AxisInputInitialiser.hpp"
+#include "InputRecorder.hpp"
 
 #include "Controllers/Controllers.hpp"
 #include "Keyboard/Keyboard.hpp"
@@ -18,17 +19,38 @@
 //! Include the required STL objects
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 //! Label the different states to be handled
 enum EStates : unsigned char { STATE_CUR, STATE_PRE, STATE_TOTAL };
 
 namespace SDL2_Engine {
 	namespace Input {
+		//! Store the value returned for handles that don't refer to a Virtual Axis
+		static const float NO_AXIS_VALUE = 0.f;
+
+		/*
+		 *		Name: AxisSlot
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the Virtual Axis' and values monitored under a single name
+		**/
+		struct AxisSlot {
+			//! Store the Virtual Axis' that contribute to the value
+			std::vector<VirtualAxis> axis;
+
+			//! Store separate states of information for the Virtual Axis
+			float inputAxis[STATE_TOTAL] = { 0.f, 0.f };
+		};
+
 		/*
 		 *		Name: AxisInputInternalData
 		 *		Author: Mitchell Croft
 		 *		Created: 12/10/2017
-		 *		Modified: 12/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Store the internal data for the Input object
@@ -37,141 +59,259 @@ namespace SDL2_Engine {
 			//! Temporary storage of the Initialiser
 			const Initialisation::AxisInputInitialiser* setup = nullptr;
 
-			//! Store a map of the virtual axis names being monitored
-			std::unordered_map<std::string, char> monitoredNames;
+			//! Store a map of the virtual axis names to their handles
+			std::unordered_map<std::string, vAxisHandle> handles;
 
-			//! Store a map of the Virtual Axis' that need monitoring
-			std::unordered_multimap<std::string, VirtualAxis> monitoredAxis;
+			//! Store the Virtual Axis' and values for each handle
+			std::vector<AxisSlot> slots;
 
-			//! Store separate states of information for the Virtual Axis
-			std::unordered_map<std::string, float> inputAxis[STATE_TOTAL];
+			/*
+				AxisInputInternalData : find - Find the handle of an existing Virtual Axis name
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pAxis - A string defining the name of the Axis to find
+
+				return vAxisHandle - Returns the handle for the name or INVALID_AXIS_HANDLE if it hasn't been used
+			*/
+			inline vAxisHandle find(const char* pAxis) const {
+				if (!pAxis) return INVALID_AXIS_HANDLE;
+				auto found = handles.find(pAxis);
+				return (found != handles.end() ? found->second : INVALID_AXIS_HANDLE);
+			}
+
+			/*
+				AxisInputInternalData : value - Retrieve a state value of a Virtual Axis
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Axis to retrieve
+				param[in] pState - The state of the value to retrieve
+
+				return const float& - Returns the value or zero if the handle is invalid
+			*/
+			inline const float& value(const vAxisHandle& pHandle, const EStates& pState) const { return (pHandle < slots.size() ? slots[pHandle].inputAxis[pState] : NO_AXIS_VALUE); }
 		};
 
+		/*
+			AxisInput : getHandle - Retrieve the handle used to access a Virtual Axis by name
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pAxis - A string defining the name of the Axis to retrieve the handle of
+
+			return vAxisHandle - Returns the handle for the name or INVALID_AXIS_HANDLE if the name is empty
+
+			NOTE:
+			Handles remain valid for the lifetime of the Axis Input object, including after the
+			Virtual Axis' under the name are removed. A handle with no Virtual Axis' has a value of 0
+		*/
+		vAxisHandle AxisInput::getHandle(const char* pAxis) {
+			//Check the name is valid
+			if (!pAxis || !*pAxis) return INVALID_AXIS_HANDLE;
+
+			//Check for an existing handle
+			vAxisHandle handle = mData->find(pAxis);
+			if (handle != INVALID_AXIS_HANDLE) return handle;
+
+			//Create a new slot for the name
+			handle = (vAxisHandle)mData->slots.size();
+			mData->slots.emplace_back();
+			mData->handles.emplace(pAxis, handle);
+			return handle;
+		}
+
+		/*
+			AxisInput : getAxis - Retrieve the value of a Virtual Axis being monitored
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pHandle - The handle of the Axis to retrieve
+
+			return const float& - Returns the value of the Virtual Axis as a const float reference
+		*/
+		const float& AxisInput::getAxis(const vAxisHandle& pHandle) const { return mData->value(pHandle, STATE_CUR); }
+
+		/*
+			AxisInput : getAxisDelta - Retrieve the change in axis value since the last cycle
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pHandle - The handle of the Axis to retrieve
+
+			return float - Returns a float value containing the change in the Virtual Axis' value
+		*/
+		float AxisInput::getAxisDelta(const vAxisHandle& pHandle) const { return (mData->value(pHandle, STATE_CUR) - mData->value(pHandle, STATE_PRE)); }
+
+		/*
+			AxisInput : btnDown - Treat the Virtual Axis as a button and check if it is currently 'down'
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pHandle - The handle of the Axis to retrieve
+
+			return bool - Returns true if the Virtual Axis is not equal to zero
+		*/
+		bool AxisInput::btnDown(const vAxisHandle& pHandle) const { return (mData->value(pHandle, STATE_CUR) != 0.f); }
+
+		/*
+			AxisInput : btnPressed - Treat the Virtual Axis as a button and check if it was 'pressed'
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pHandle - The handle of the Axis to retrieve
+
+			return bool - Returns true the first cycle the Virtual Axis is not equal to zero
+		*/
+		bool AxisInput::btnPressed(const vAxisHandle& pHandle) const { return (mData->value(pHandle, STATE_CUR) && !mData->value(pHandle, STATE_PRE)); }
+
+		/*
+			AxisInput : btnReleased - Treat the Virtual Axis as a button and check if it was 'released'
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pHandle - The handle of the Axis to retrieve
+
+			return bool - Returns true the first cycle the Virtual Axis is equal to zero
+		*/
+		bool AxisInput::btnReleased(const vAxisHandle& pHandle) const { return (!mData->value(pHandle, STATE_CUR) && mData->value(pHandle, STATE_PRE)); }
+
+		/*
+			AxisInput : hasAxis - Check to see if a Virtual Axis handle has Virtual Axis' being monitored
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pHandle - The handle of the Axis to check
+
+			return bool - Returns true if there are Virtual Axis' monitored under the handle
+		*/
+		bool AxisInput::hasAxis(const vAxisHandle& pHandle) const { return (pHandle < mData->slots.size() && mData->slots[pHandle].axis.size()); }
+
 		/*
 			AxisInput : getAxis - Retrieve the value of a Virtual Axis being monitored
 			Created: 22/09/2017
-			Modified: 12/10/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A string defining the name of the Axis to retrieve
 
 			return const float& - Returns the value of the Virtual Axis as a const float reference
 		*/
-		const float& AxisInput::getAxis(const char* pAxis) const { return mData->inputAxis[STATE_CUR][pAxis]; }
+		const float& AxisInput::getAxis(const char* pAxis) const { return getAxis(mData->find(pAxis)); }
 
 		/*
 			AxisInput : getAxisDelta - Retrieve the change in axis value since the last cycle
 			Created: 22/09/2017
-			Modified: 12/10/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A string defining the name of the Axis to retrieve
 
 			return float - Returns a float value containing the change in the Virtual Axis' value
 		*/
-		float AxisInput::getAxisDelta(const char* pAxis) const { return (mData->inputAxis[STATE_CUR][pAxis] - mData->inputAxis[STATE_PRE][pAxis]); }
+		float AxisInput::getAxisDelta(const char* pAxis) const { return getAxisDelta(mData->find(pAxis)); }
 
 		/*
 			AxisInput : btnDown - Treat the Virtual Axis as a button and check if it is currently 'down'
 			Created: 22/09/2017
-			Modified: 12/10/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A string defining the name of the Axis to retrieve
 
 			return bool - Returns true if the Virtual Axis is not equal to zero
 		*/
-		bool AxisInput::btnDown(const char* pAxis) const { return (mData->inputAxis[STATE_CUR][pAxis] != 0.f); }
+		bool AxisInput::btnDown(const char* pAxis) const { return btnDown(mData->find(pAxis)); }
 
 		/*
 			AxisInput : btnPressed - Treat the Virtual Axis as a button and check if it was 'pressed'
 			Created: 22/09/2017
-			Modified: 12/10/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A string defining the name of the Axis to retrieve
 
 			return bool - Returns true the first cycle the Virtual Axis is not equal to zero
 		*/
-		bool AxisInput::btnPressed(const char* pAxis) const { return (mData->inputAxis[STATE_CUR][pAxis] && !mData->inputAxis[STATE_PRE][pAxis]); }
+		bool AxisInput::btnPressed(const char* pAxis) const { return btnPressed(mData->find(pAxis)); }
 
 		/*
 			AxisInput : btnReleased - Treat the Virtual Axis as a button and check if it was 'released'
 			Created: 22/09/2017
-			Modified: 12/10/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A string defining the name of the Axis to retrieve
 
 			return bool - Returns true the first cycle the Virtual Axis is equal to zero
 		*/
-		bool AxisInput::btnReleased(const char* pAxis) const { return (!mData->inputAxis[STATE_CUR][pAxis] && mData->inputAxis[STATE_PRE][pAxis]); }
+		bool AxisInput::btnReleased(const char* pAxis) const { return btnReleased(mData->find(pAxis)); }
 
 		/*
 			AxisInput : addAxis - Add a new Virtual Axis description to the monitor list
 			Created: 22/09/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - The Virtual Axis object describing the new Virtual Axis
+
+			return vAxisHandle - Returns the handle for the name of the Virtual Axis
 		*/
-		void AxisInput::addAxis(const VirtualAxis& pAxis) { 
-			//Insert the name into the monitored list
-			mData->monitoredNames[pAxis.name.c_str()]++;
+		vAxisHandle AxisInput::addAxis(const VirtualAxis& pAxis) { 
+			//Get the handle for the name
+			const vAxisHandle handle = getHandle(pAxis.name.c_str());
 
-			//Stash the Virtual Axis under the name
-			mData->monitoredAxis.insert(std::pair<std::string, VirtualAxis>(pAxis.name.c_str(), pAxis)); 
+			//Stash the Virtual Axis under the handle
+			if (handle != INVALID_AXIS_HANDLE) mData->slots[handle].axis.push_back(pAxis);
+			return handle;
 		}
 
 		/*
 			AxisInput : addAxis -  Add an array of Virtual Axis descriptions to the monitor list
 			Created: 22/09/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A pointer to the array of Virtual Axis objects to monitor
 			param[in] pCount - The number of Virtual Axis objects stored in the array
 		*/
 		void AxisInput::addAxis(const VirtualAxis* pAxis, const size_t& pCount) {
-			for (size_t i = 0; i < pCount; i++) {
-				//Insert the name into the monitored list
-				mData->monitoredNames[pAxis[i].name.c_str()]++;
-
-				//Stash the Virtual Axis under the name
-				mData->monitoredAxis.insert(std::pair<std::string, VirtualAxis>(pAxis[i].name.c_str(), pAxis[i]));
-			}
+			for (size_t i = 0; i < pCount; i++) addAxis(pAxis[i]);
 		}
 
 		/*
 			AxisInput : hasAxis - Check to see if a Virtual Axis exists in the monitor list
 			Created: 13/10/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A string defining the name of the Axis to retrieve
 
 			return bool - Returns true if the specified axis name exists
 		*/
-		bool AxisInput::hasAxis(const char* pAxis) const { return (mData->monitoredNames.find(pAxis) != mData->monitoredNames.end()); }
+		bool AxisInput::hasAxis(const char* pAxis) const { return hasAxis(mData->find(pAxis)); }
 
 		/*
 			AxisInput : removeAxis - Clear all Virtual Axis' with a specific name
 			Created: 22/09/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pAxis - A string defining the name of the Axis to remove
 		*/
 		void AxisInput::removeAxis(const char* pAxis) {
-			//Clear all traces of the axis
-			mData->monitoredNames.erase(pAxis);
-			mData->monitoredAxis.erase(pAxis);
-			mData->inputAxis[STATE_CUR].erase(pAxis);
-			mData->inputAxis[STATE_PRE].erase(pAxis);
+			//Find the handle for the name
+			const vAxisHandle handle = mData->find(pAxis);
+			if (handle == INVALID_AXIS_HANDLE) return;
+
+			//Clear all traces of the axis, the handle remains valid
+			AxisSlot& slot = mData->slots[handle];
+			slot.axis.clear();
+			slot.inputAxis[STATE_CUR] = slot.inputAxis[STATE_PRE] = 0.f;
 		}
 
 		/*
 			AxisInput : removeAxis - Clear all Virtual Axis'
 			Created: 22/09/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 		*/
 		void AxisInput::removeAxis() {
 			//Clear all Virtual Axis
-			mData->monitoredNames.clear();
-			mData->monitoredAxis.clear();
-			mData->inputAxis[STATE_CUR].clear();
-			mData->inputAxis[STATE_PRE].clear();
+			for (AxisSlot& slot : mData->slots) {
+				slot.axis.clear();
+				slot.inputAxis[STATE_CUR] = slot.inputAxis[STATE_PRE] = 0.f;
+			}
 		}
 
 		/*
@@ -218,9 +358,21 @@ namespace SDL2_Engine {
 		/*
 			AxisInput : update - Update the Virtual Axis
 			Created: 11/10/2017
-			Modified: 09/11/2017
+			Modified: 16/10/2026
 		*/
 		void AxisInput::update() {
+			//Get the Input Recorder (if there is one)
+			InputRecorder* recorder = (Globals::interfaceExists<InputRecorder>() ? &Globals::get<InputRecorder>() : nullptr);
+
+			//Read the resolved values from the replay
+			if (recorder && recorder->isReplaying()) {
+				for (size_t i = 0; i < mData->slots.size(); i++) {
+					mData->slots[i].inputAxis[STATE_PRE] = mData->slots[i].inputAxis[STATE_CUR];
+					recorder->syncAxis(i, mData->slots[i].inputAxis[STATE_CUR]);
+				}
+				return;
+			}
+
 			//Check that the Window has focus
 			if (!Globals::get<Window>().hasProperty(EWindowProperties::Focus)) return;
 
@@ -234,9 +386,9 @@ namespace SDL2_Engine {
 			const Mouse& mouse = Globals::get<Mouse>();
 
 			//Loop through all monitored axis
-			for (auto it = mData->monitoredNames.cbegin(); it != mData->monitoredNames.cend(); ++it) {
-				//Store the name of the Virtual axis
-				const std::string& V_AXIS_NAME = it->first;
+			for (AxisSlot& slot : mData->slots) {
+				//Skip handles that have no Virtual Axis'
+				if (slot.axis.empty()) continue;
 
 				//Store the number of Virtual axis' contributing to these values
 				size_t contributingAxis = 0U;
@@ -248,19 +400,13 @@ namespace SDL2_Engine {
 				float gravAvg = 0.f;
 
 				//Copy the previous value of the axis
-				mData->inputAxis[STATE_PRE][V_AXIS_NAME] = mData->inputAxis[STATE_CUR][V_AXIS_NAME];
-
-				//Get all Virtual Axis with the name
-				auto range = mData->monitoredAxis.equal_range(V_AXIS_NAME);
+				slot.inputAxis[STATE_PRE] = slot.inputAxis[STATE_CUR];
 
 				//Loop through all monitored Virtual Axis with the same name
-				for (auto iter = range.first; iter != range.second; ++iter) {
+				for (const VirtualAxis& axis : slot.axis) {
 					//Add to the contributing Axis' counter
 					++contributingAxis;
 
-					//Get a reference to the current Virtual Axis
-					const VirtualAxis& axis = iter->second;
-
 					//Add the gravity to the running sum
 					gravAvg += axis.gravity;
 
@@ -331,24 +477,30 @@ namespace SDL2_Engine {
 				}
 
 				//Add the strength to the current Input state
-				if (strongestAxis && abs(strongestAxis) > abs(mData->inputAxis[STATE_CUR][V_AXIS_NAME]))
-					mData->inputAxis[STATE_CUR][V_AXIS_NAME] = math.clamp(mData->inputAxis[STATE_CUR][V_AXIS_NAME] + strongestAxis * time.getDelta(), -1.f, 1.f);
+				if (strongestAxis && abs(strongestAxis) > abs(slot.inputAxis[STATE_CUR]))
+					slot.inputAxis[STATE_CUR] = math.clamp(slot.inputAxis[STATE_CUR] + strongestAxis * time.getDelta(), -1.f, 1.f);
 
 				//Otherwise apply gravity
-				else if (gravAvg && mData->inputAxis[STATE_CUR][V_AXIS_NAME]) {
+				else if (gravAvg && slot.inputAxis[STATE_CUR]) {
 					//Get the inverse direction
-					const float INV_DIR = math.sign(mData->inputAxis[STATE_CUR][V_AXIS_NAME]) * -1.f;
+					const float INV_DIR = math.sign(slot.inputAxis[STATE_CUR]) * -1.f;
 
 					//Average out the gravity values
 					gravAvg /= (float)contributingAxis;
 
 					//Get the value after gravity is applied
-					const float APP_GRAV_VAL = mData->inputAxis[STATE_CUR][V_AXIS_NAME] + gravAvg * INV_DIR * time.getDelta();
+					const float APP_GRAV_VAL = slot.inputAxis[STATE_CUR] + gravAvg * INV_DIR * time.getDelta();
 
 					//Assign the axis value
-					mData->inputAxis[STATE_CUR][V_AXIS_NAME] = (math.sign(APP_GRAV_VAL) == INV_DIR ? 0.f : APP_GRAV_VAL);
+					slot.inputAxis[STATE_CUR] = (math.sign(APP_GRAV_VAL) == INV_DIR ? 0.f : APP_GRAV_VAL);
 				}
 			}
+
+			//Record the resolved values
+			if (recorder) {
+				for (size_t i = 0; i < mData->slots.size(); i++)
+					recorder->syncAxis(i, mData->slots[i].inputAxis[STATE_CUR]);
+			}
 		}
 	}
 }
@@ -3,6 +3,7 @@
 //! Include SDL2_Engine objects
 #include "../__LibraryManagement.hpp"
 #include "../Utilities/IGlobal.hpp"
+#include "AxisInputValues.hpp"
 
 namespace SDL2_Engine {
 	//! Prototype the Input Initialiser object
@@ -16,14 +17,105 @@ namespace SDL2_Engine {
 		 *		Name: AxisInput
 		 *		Author: Mitchell Croft
 		 *		Created: 12/10/2017
-		 *		Modified: 08/11/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Provide an interface for managing and evaluating Virtual Axis
 		 *		across all three input types
+		 *
+		 *		Notes:
+		 *		Virtual Axis names are interned to handles that index a flat array of
+		 *		values. Names should be resolved once with getHandle and the handle
+		 *		overloads used each frame, the name overloads exist for convenience
+		 *		and never add unknown names
 		**/
 		class SDL2_LIB_INC AxisInput : public Utilities::IGlobal {
 		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------Virtual Axis Handles--------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				AxisInput : getHandle - Retrieve the handle used to access a Virtual Axis by name
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pAxis - A string defining the name of the Axis to retrieve the handle of
+
+				return vAxisHandle - Returns the handle for the name or INVALID_AXIS_HANDLE if the name is empty
+
+				NOTE:
+				Handles remain valid for the lifetime of the Axis Input object, including after the
+				Virtual Axis' under the name are removed. A handle with no Virtual Axis' has a value of 0
+			*/
+			vAxisHandle getHandle(const char* pAxis);
+
+			/*
+				AxisInput : getAxis - Retrieve the value of a Virtual Axis being monitored
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Axis to retrieve
+
+				return const float& - Returns the value of the Virtual Axis as a const float reference
+			*/
+			const float& getAxis(const vAxisHandle& pHandle) const;
+
+			/*
+				AxisInput : getAxisDelta - Retrieve the change in axis value since the last cycle
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Axis to retrieve
+
+				return float - Returns a float value containing the change in the Virtual Axis' value
+			*/
+			float getAxisDelta(const vAxisHandle& pHandle) const;
+
+			/*
+				AxisInput : btnDown - Treat the Virtual Axis as a button and check if it is currently 'down'
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Axis to retrieve
+
+				return bool - Returns true if the Virtual Axis is not equal to zero
+			*/
+			bool btnDown(const vAxisHandle& pHandle) const;
+
+			/*
+				AxisInput : btnPressed - Treat the Virtual Axis as a button and check if it was 'pressed'
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Axis to retrieve
+
+				return bool - Returns true the first cycle the Virtual Axis is not equal to zero
+			*/
+			bool btnPressed(const vAxisHandle& pHandle) const;
+
+			/*
+				AxisInput : btnReleased - Treat the Virtual Axis as a button and check if it was 'released'
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Axis to retrieve
+
+				return bool - Returns true the first cycle the Virtual Axis is equal to zero
+			*/
+			bool btnReleased(const vAxisHandle& pHandle) const;
+
+			/*
+				AxisInput : hasAxis - Check to see if a Virtual Axis handle has Virtual Axis' being monitored
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Axis to check
+
+				return bool - Returns true if there are Virtual Axis' monitored under the handle
+			*/
+			bool hasAxis(const vAxisHandle& pHandle) const;
+
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////---------------------------------Virtual Axis Functions------------------------------////////
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,7 +123,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : getAxis - Retrieve the value of a Virtual Axis being monitored
 				Created: 22/09/2017
-				Modified: 12/10/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A string defining the name of the Axis to retrieve
 
@@ -42,7 +134,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : getAxisDelta - Retrieve the change in axis value since the last cycle
 				Created: 22/09/2017
-				Modified: 12/10/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A string defining the name of the Axis to retrieve
 
@@ -53,7 +145,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : btnDown - Treat the Virtual Axis as a button and check if it is currently 'down'
 				Created: 22/09/2017
-				Modified: 12/10/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A string defining the name of the Axis to retrieve
 
@@ -64,7 +156,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : btnPressed - Treat the Virtual Axis as a button and check if it was 'pressed'
 				Created: 22/09/2017
-				Modified: 12/10/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A string defining the name of the Axis to retrieve
 
@@ -75,7 +167,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : btnReleased - Treat the Virtual Axis as a button and check if it was 'released'
 				Created: 22/09/2017
-				Modified: 12/10/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A string defining the name of the Axis to retrieve
 
@@ -86,16 +178,18 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : addAxis - Add a new Virtual Axis description to the monitor list
 				Created: 22/09/2017
-				Modified: 08/11/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - The Virtual Axis object describing the new Virtual Axis
+
+				return vAxisHandle - Returns the handle for the name of the Virtual Axis
 			*/
-			void addAxis(const VirtualAxis& pAxis);
+			vAxisHandle addAxis(const VirtualAxis& pAxis);
 
 			/*
 				AxisInput : addAxis -  Add an array of Virtual Axis descriptions to the monitor list
 				Created: 22/09/2017
-				Modified: 08/11/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A pointer to the array of Virtual Axis objects to monitor
 				param[in] pCount - The number of Virtual Axis objects stored in the array
@@ -105,7 +199,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : hasAxis - Check to see if a Virtual Axis exists in the monitor list
 				Created: 13/10/2017
-				Modified: 08/11/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A string defining the name of the Axis to retrieve
 
@@ -116,7 +210,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : removeAxis - Clear all Virtual Axis' with a specific name
 				Created: 22/09/2017
-				Modified: 08/11/2017
+				Modified: 16/10/2026
 
 				param[in] pAxis - A string defining the name of the Axis to remove
 			*/
@@ -125,7 +219,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : removeAxis - Clear all Virtual Axis'
 				Created: 22/09/2017
-				Modified: 08/11/2017
+				Modified: 16/10/2026
 			*/
 			void removeAxis();
 
@@ -161,7 +255,7 @@ namespace SDL2_Engine {
 			/*
 				AxisInput : update - Update the Virtual Axis
 				Created: 11/10/2017
-				Modified: 09/11/2017
+				Modified: 16/10/2026
 			*/
 			void update() override;
 
@@ -8,11 +8,17 @@
 namespace SDL2_Engine {
 	namespace Input {
 		//! Export the required FString implementation
-		template class SDL2_LIB_INC Utilities::FString<VIRTUAL_AXIS_NAME_MAX>;
+		SDL2_LIB_TEMPLATE(Utilities::FString<VIRTUAL_AXIS_NAME_MAX>);
 
 		//! Create a type define for the names of Virtual Axis
 		typedef Utilities::FString<VIRTUAL_AXIS_NAME_MAX> vAxisName;
 
+		//! Create a type define for the handles used to access Virtual Axis without a name lookup
+		typedef unsigned int vAxisHandle;
+
+		//! Flag a Virtual Axis handle that doesn't refer to any Virtual Axis
+		const vAxisHandle INVALID_AXIS_HANDLE = ~0U;
+
 		//! Flag the input devices the Virtual Axis can use
 		enum class EInputDevice { Null, GamePad, Keyboard, Mouse };
 	}
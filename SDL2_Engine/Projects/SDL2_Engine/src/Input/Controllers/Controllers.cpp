@@ -5,10 +5,14 @@
 #include "../../Time.hpp"
 #include "../../Math.hpp"
 #include "../../Window/Window.hpp"
+#include "../InputRecorder.hpp"
 
 //! Include the STL objects used to track keyed values
 #include <unordered_map>
 
+//! Include the math functions used to convert IDs and normalise axis
+#include <cmath>
+
 //! Include the required SDL2_Engine objects
 #include "GamePad.hpp"
 #include "VibrationDescription.hpp"
@@ -340,11 +344,15 @@ namespace SDL2_Engine {
 		/*
 			Controllers : update - Update the GamePads input states
 			Created: 25/07/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 		*/
 		void Controllers::update() {
-			//Check that the Window has focus
-			if (!Globals::get<Window>().hasProperty(EWindowProperties::Focus)) return;
+			//Get the Input Recorder (if there is one)
+			InputRecorder* recorder = (Globals::interfaceExists<InputRecorder>() ? &Globals::get<InputRecorder>() : nullptr);
+			const bool REPLAYING = (recorder && recorder->isReplaying());
+
+			//Check that the Window has focus, replays don't rely on the devices
+			if (!REPLAYING && !Globals::get<Window>().hasProperty(EWindowProperties::Focus)) return;
 
 			//Get the Global Objects
 			const Time& time = Globals::get<Time>();
@@ -364,8 +372,26 @@ namespace SDL2_Engine {
 				//Flag if the gamepad was previously connected
 				bool flag = mData->gamepads[i].mConnected;
 
-				//Update the gamepad
-				if (mData->gamepads[i].update(attemptReconnect) && !flag) {
+				//Store the state exchanged with the Input Recorder
+				GamePadRecord record;
+
+				//Update the gamepad from the replay or the device
+				bool connected;
+				if (REPLAYING) {
+					recorder->syncGamePad(i, record);
+					connected = mData->gamepads[i].replay(record);
+				} else {
+					connected = mData->gamepads[i].update(attemptReconnect);
+
+					//Record the state
+					if (recorder) {
+						mData->gamepads[i].capture(record);
+						recorder->syncGamePad(i, record);
+					}
+				}
+
+				//Check for a new connection
+				if (connected && !flag) {
 					//Create short vibration animation
 					VibrationDescription desc;
 					desc.gamePad = (1 << i);
@@ -383,7 +409,7 @@ namespace SDL2_Engine {
 				if (mData->vibrationTimer >= mData->vibrationFrequency) {
 					//Spend the built up time
 					float integral;
-					mData->vibrationTimer = modf(mData->vibrationTimer / mData->vibrationFrequency, &integral) * mData->vibrationFrequency;
+					mData->vibrationTimer = std::modf(mData->vibrationTimer / mData->vibrationFrequency, &integral) * mData->vibrationFrequency;
 
 					//Loop through the Vibration Descriptions
 					for (auto it = mData->vibrationValues.begin(); it != mData->vibrationValues.end();) {
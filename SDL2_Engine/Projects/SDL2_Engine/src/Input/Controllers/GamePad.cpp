@@ -1,23 +1,46 @@
 #include "GamePad.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "../../Utilities/Portability.hpp"
+
 //! Include useful types and functions
 #include <cmath>
-#include <windows.h>
+#include <cstring>
+#include <stdint.h>
 
-//! Include the XInput API 
+//! Include the XInput API on Windows and the SDL GameController API elsewhere
+#ifdef _WIN32
+#include <windows.h>
 #include <Xinput.h>
+#else
+#include <SDL.h>
+#endif
 
 //! Include Bitmask objects to be used with GamePad button checks
 #include "../../Utilities/Bitmask.hpp"
 
+//! Include the Input Recorder values to exchange states with
+#include "../InputRecorder.hpp"
+
 //! Define useful information for managing GamePad input
 #define GAMEPAD_AXIS_TOTAL		6
 #define GAMEPAD_TRIGGER_MAX		255.f
 #define GAMEPAD_THUMBSTICK_MAX	32767.f
 #define GAMEPAD_VIBRATION_MAX	65535.f
+#define GAMEPAD_MAX_COUNT		4
 
-//! Define simple clamp function
+//! Ensure the recorded states match the XInput states
+static_assert(GAMEPAD_AXIS_TOTAL == SDL2_Engine::Input::GamePadRecord::AXIS_TOTAL, "GamePadRecord must store the same number of axis values as the GamePad");
+
+//! Define simple clamp functions
 #define CLAMP01(X) ((X) < 0 ? 0 : ((X) > 1 ? 1 : (X)))
+#define CLAMP11(X) ((X) < -1 ? -1 : ((X) > 1 ? 1 : (X)))
+
+#ifndef _WIN32
+//! Store the SDL devices opened by each GamePad
+static SDL_GameController* gControllers[GAMEPAD_MAX_COUNT] = { nullptr };
+static SDL_Haptic* gHaptics[GAMEPAD_MAX_COUNT] = { nullptr };
+#endif
 
 namespace SDL2_Engine {
 	namespace Input {
@@ -28,20 +51,20 @@ namespace SDL2_Engine {
 		 *		Name: InputState
 		 *		Author: Mitchell Croft
 		 *		Created: 10/02/2017
-		 *		Modified: 24/07/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Store converted XInput state information about a physical device
 		**/
 		struct _GamePad::InputState {
 			//! Store the packet ID for the GamePad
-			DWORD packetID;
+			uint32_t packetID;
 
 			//! Store an array of floats for the axis values
 			float axisValues[GAMEPAD_AXIS_TOTAL];
 
 			//! Store a Bitmask for the controller buttons
-			WORD buttonMask;
+			uint16_t buttonMask;
 
 			/*
 				InputState : Constructor - Initialise with default values
@@ -53,9 +76,9 @@ namespace SDL2_Engine {
 			/*
 				InputState : Reset - Reset the memory used by the InputState object to 0
 				Created: 10/02/2017
-				Modified: 10/02/2017
+				Modified: 16/10/2026
 			*/
-			inline void reset() { ZeroMemory(this, sizeof(InputState)); }
+			inline void reset() { memset(this, 0, sizeof(InputState)); }
 
 			/*
 				InputState : Assignment Operator (InputState) - Copy the values of another InputState
@@ -68,6 +91,7 @@ namespace SDL2_Engine {
 			*/
 			inline InputState& operator=(const InputState& pCopy) { memcpy_s(this, sizeof(InputState), &pCopy, sizeof(InputState)); return *this; }
 			
+		#ifdef _WIN32
 			/*
 				InputState : Assignment Operator (XINPUT_STATE) - Assign the values according to an XINPUT_STATE object
 				Created: 10/02/2017
@@ -95,6 +119,49 @@ namespace SDL2_Engine {
 				//Return self
 				return *this;
 			}
+		#else
+			/*
+				InputState : Assignment Operator (SDL_GameController) - Assign the values according to the current state of an SDL GameController
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pController - The SDL GameController to read values from
+
+				return InputState& - Returns a reference to itself
+
+				NOTE:
+				The packet ID is not modified, SDL does not provide one
+			*/
+			InputState& operator=(SDL_GameController* pController) {
+				//Store the SDL buttons that match each bit of the XInput button mask
+				const SDL_GameControllerButton BUTTONS[16] = {
+					SDL_CONTROLLER_BUTTON_DPAD_UP, SDL_CONTROLLER_BUTTON_DPAD_DOWN, SDL_CONTROLLER_BUTTON_DPAD_LEFT, SDL_CONTROLLER_BUTTON_DPAD_RIGHT,
+					SDL_CONTROLLER_BUTTON_START, SDL_CONTROLLER_BUTTON_BACK, SDL_CONTROLLER_BUTTON_LEFTSTICK, SDL_CONTROLLER_BUTTON_RIGHTSTICK,
+					SDL_CONTROLLER_BUTTON_LEFTSHOULDER, SDL_CONTROLLER_BUTTON_RIGHTSHOULDER, SDL_CONTROLLER_BUTTON_INVALID, SDL_CONTROLLER_BUTTON_INVALID,
+					SDL_CONTROLLER_BUTTON_A, SDL_CONTROLLER_BUTTON_B, SDL_CONTROLLER_BUTTON_X, SDL_CONTROLLER_BUTTON_Y
+				};
+
+				//Build the button mask
+				buttonMask = 0;
+				for (int i = 0; i < 16; i++) {
+					if (BUTTONS[i] != SDL_CONTROLLER_BUTTON_INVALID && SDL_GameControllerGetButton(pController, BUTTONS[i]))
+						buttonMask |= (uint16_t)(1 << i);
+				}
+
+				//Convert the trigger values, which SDL reports in the positive half of the axis range
+				axisValues[(int)EGamePadAxisCode::Left_Trigger] = (float)SDL_GameControllerGetAxis(pController, SDL_CONTROLLER_AXIS_TRIGGERLEFT) / GAMEPAD_THUMBSTICK_MAX;
+				axisValues[(int)EGamePadAxisCode::Right_Trigger] = (float)SDL_GameControllerGetAxis(pController, SDL_CONTROLLER_AXIS_TRIGGERRIGHT) / GAMEPAD_THUMBSTICK_MAX;
+
+				//Convert the thumbstick axis, inverting Y to match XInput's up positive values
+				axisValues[(int)EGamePadAxisCode::Left_X] = CLAMP11((float)SDL_GameControllerGetAxis(pController, SDL_CONTROLLER_AXIS_LEFTX) / GAMEPAD_THUMBSTICK_MAX);
+				axisValues[(int)EGamePadAxisCode::Left_Y] = CLAMP11(-(float)SDL_GameControllerGetAxis(pController, SDL_CONTROLLER_AXIS_LEFTY) / GAMEPAD_THUMBSTICK_MAX);
+				axisValues[(int)EGamePadAxisCode::Right_X] = CLAMP11((float)SDL_GameControllerGetAxis(pController, SDL_CONTROLLER_AXIS_RIGHTX) / GAMEPAD_THUMBSTICK_MAX);
+				axisValues[(int)EGamePadAxisCode::Right_Y] = CLAMP11(-(float)SDL_GameControllerGetAxis(pController, SDL_CONTROLLER_AXIS_RIGHTY) / GAMEPAD_THUMBSTICK_MAX);
+
+				//Return self
+				return *this;
+			}
+		#endif
 		};
 
 		/*
@@ -161,15 +228,20 @@ namespace SDL2_Engine {
 		/*
 			_GamePad : vibrate - Set the vibration values for the connected controller
 			Created: 13/02/2017
-			Modified: 30/07/2017
+			Modified: 16/10/2026
 
 			param[in] pLeftScale - The strength to use for the left rumble motor (0 - 1 scale)
 			param[in] pRightScale - The strength to use for the right rumble motor (0 - 1 scale)
+
+			NOTE:
+			SDL haptics only expose a single rumble strength, so the stronger of the two motors is used outside of Windows
 		*/
 		void _GamePad::vibrate(const float& pLeftScale, const float& pRightScale) const noexcept {
 			//Check the GamePad is connected
 			if (!mConnected) return;
 
+		#ifdef _WIN32
+
 			//Create an XInput structure to describe the vibration
 			XINPUT_VIBRATION vibration;
 			ZeroMemory(&vibration, sizeof(XINPUT_VIBRATION));
@@ -180,6 +252,18 @@ namespace SDL2_Engine {
 
 			//Set the vibration state
 			XInputSetState(mID, &vibration);
+		#else
+			//Check the device supports rumble
+			SDL_Haptic* haptic = gHaptics[mID];
+			if (!haptic) return;
+
+			//Get the strength to apply
+			const float STRENGTH = CLAMP01(pLeftScale > pRightScale ? pLeftScale : pRightScale);
+
+			//Set the vibration state
+			if (STRENGTH > 0.f) SDL_HapticRumblePlay(haptic, STRENGTH, SDL_HAPTIC_INFINITY);
+			else SDL_HapticRumbleStop(haptic);
+		#endif
 		}
 
 		/*
@@ -211,14 +295,26 @@ namespace SDL2_Engine {
 		/*
 			_GamePad : Destructor - Unload memory allocated for state information
 			Created: 24/07/2017
-			Modified: 24/07/2017
+			Modified: 16/10/2026
 		*/
-		_GamePad::~_GamePad() { vibrate(0.f, 0.f); delete[] mStates; }
+		_GamePad::~_GamePad() {
+			//Stop any vibration
+			vibrate(0.f, 0.f);
+
+		#ifndef _WIN32
+			//Close the SDL devices
+			if (gHaptics[mID]) { SDL_HapticClose(gHaptics[mID]); gHaptics[mID] = nullptr; }
+			if (gControllers[mID]) { SDL_GameControllerClose(gControllers[mID]); gControllers[mID] = nullptr; }
+		#endif
+
+			//Delete the state array
+			delete[] mStates;
+		}
 
 		/*
 			_GamePad : update - Update the current state information for the controller
 			Created: 13/02/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pReconnect - Flags if the GamePad should attempt to reconnect to a physical device
 
@@ -228,15 +324,67 @@ namespace SDL2_Engine {
 			//If the GamePad is not connected and not reconnecting, don't bother
 			if (!mConnected && !pReconnect) return mConnected;
 
+		#ifdef _WIN32
 			//Create a state to store the data in
 			XINPUT_STATE state;
 			ZeroMemory(&state, sizeof(XINPUT_STATE));
 
 			//Get the current GamePad state
-			DWORD result = XInputGetState(mID, &state);
+			const bool FOUND = (XInputGetState(mID, &state) == ERROR_SUCCESS);
+		#else
+			//Ensure the GameController subsystem is running
+			if (!SDL_WasInit(SDL_INIT_GAMECONTROLLER)) SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER | SDL_INIT_HAPTIC);
+
+			//Release a device that has been removed
+			SDL_GameController*& controller = gControllers[mID];
+			if (controller && !SDL_GameControllerGetAttached(controller)) {
+				if (gHaptics[mID]) { SDL_HapticClose(gHaptics[mID]); gHaptics[mID] = nullptr; }
+				SDL_GameControllerClose(controller);
+				controller = nullptr;
+			}
+
+			//Look for an unclaimed device when reconnecting
+			if (!controller && pReconnect) {
+				for (int i = 0; i < SDL_NumJoysticks() && !controller; i++) {
+					//Skip joysticks that have no GameController mapping
+					if (!SDL_IsGameController(i)) continue;
+
+					//Open the device, SDL returns the existing handle if it is already open
+					SDL_GameController* found = SDL_GameControllerOpen(i);
+					if (!found) continue;
+
+					//Check no other GamePad has claimed the device
+					bool claimed = false;
+					for (int j = 0; j < GAMEPAD_MAX_COUNT; j++) claimed |= (gControllers[j] == found);
+
+					//Release the extra reference to a claimed device
+					if (claimed) SDL_GameControllerClose(found);
+
+					//Otherwise take the device and its rumble support
+					else {
+						controller = found;
+						gHaptics[mID] = SDL_HapticOpenFromJoystick(SDL_GameControllerGetJoystick(found));
+						if (gHaptics[mID] && SDL_HapticRumbleInit(gHaptics[mID])) { SDL_HapticClose(gHaptics[mID]); gHaptics[mID] = nullptr; }
+					}
+				}
+			}
+
+			//Read the current GamePad state
+			InputState state;
+			const bool FOUND = (controller != nullptr);
+			if (FOUND) {
+				//Convert the SDL state
+				state = controller;
+
+				//Assign a new packet ID when the state has changed
+				state.packetID = mStates[STATE_CUR].packetID;
+				if (state.buttonMask != mStates[STATE_CUR].buttonMask || memcmp(state.axisValues, mStates[STATE_CUR].axisValues, sizeof(float) * GAMEPAD_AXIS_TOTAL))
+					++state.packetID;
+			}
+		#endif
 
 			//If the GamePad is still connected
-			if (result == ERROR_SUCCESS) {
+			if (FOUND) {
 				//Check if the controller was already connected
 				if (!mConnected) mConnected = true;
 			}
@@ -260,12 +408,67 @@ namespace SDL2_Engine {
 					mStates[STATE_PRE] = mStates[STATE_CUR];
 
 				//Check if there is a new state to take
+			#ifdef _WIN32
 				if (state.dwPacketNumber != mStates[STATE_CUR].packetID)
+			#else
+				if (state.packetID != mStates[STATE_CUR].packetID)
+			#endif
 					mStates[STATE_CUR] = state;
 			}
 
 			//Return the connection flag
 			return mConnected;
 		}
+
+		/*
+			_GamePad : replay - Update the current state information from a recorded state
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRecord - The GamePadRecord describing the state of the GamePad for the frame
+
+			return bool - Returns true if the GamePad was connected when the state was recorded
+		*/
+		bool _GamePad::replay(const GamePadRecord& pRecord) {
+			//Check if the connection has changed
+			if (pRecord.connected != mConnected) {
+				//Set the connected flag
+				mConnected = pRecord.connected;
+
+				//Reset the state information on disconnection
+				if (!mConnected) for (size_t i = 0; i < STATE_TOTAL; i++) mStates[i].reset();
+			}
+
+			//If the GamePad is connected update the state information
+			if (mConnected) {
+				//Copy the previous state information
+				if (mStates[STATE_PRE].packetID != mStates[STATE_CUR].packetID)
+					mStates[STATE_PRE] = mStates[STATE_CUR];
+
+				//Check if there is a new state to take
+				if (pRecord.packetID != mStates[STATE_CUR].packetID) {
+					mStates[STATE_CUR].packetID = pRecord.packetID;
+					mStates[STATE_CUR].buttonMask = pRecord.buttonMask;
+					memcpy(mStates[STATE_CUR].axisValues, pRecord.axisValues, sizeof(float) * GAMEPAD_AXIS_TOTAL);
+				}
+			}
+
+			//Return the connection flag
+			return mConnected;
+		}
+
+		/*
+			_GamePad : capture - Store the current state information for recording
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[out] pRecord - Receives the current state of the GamePad
+		*/
+		void _GamePad::capture(GamePadRecord& pRecord) const {
+			pRecord.connected = mConnected;
+			pRecord.packetID = mStates[STATE_CUR].packetID;
+			pRecord.buttonMask = mStates[STATE_CUR].buttonMask;
+			memcpy(pRecord.axisValues, mStates[STATE_CUR].axisValues, sizeof(float) * GAMEPAD_AXIS_TOTAL);
+		}
 	}
 }
\ No newline at end of file
@@ -8,11 +8,14 @@ namespace SDL2_Engine {
 	namespace Utilities { template<typename T> class Bitmask; }
 
 	namespace Input {
+		//! Prototype the GamePad Record object
+		struct GamePadRecord;
+
 		/*
 		 *		Name: _GamePad
 		 *		Author: Mitchell Croft
 		 *		Created: 10/02/2017
-		 *		Modified: 24/07/2017
+		 *		Modified: 16/10/2026
 		 *
 		 *		Purpose:
 		 *		Manage the values associated with a single GamePad object
@@ -160,6 +163,10 @@ namespace SDL2_Engine {
 
 			//! Update Input State Information
 			bool update(const bool& pReconnect);
+
+			//! Exchange Input State Information with the Input Recorder
+			bool replay(const GamePadRecord& pRecord);
+			void capture(GamePadRecord& pRecord) const;
 		};
 
 		//! Define a simplified type define for 'everyday' use
@@ -10,7 +10,7 @@
 namespace SDL2_Engine {
 	namespace Input {
 		//! Export the required Action implementation
-		template class SDL2_LIB_INC Utilities::Action<float(const float&)>;
+		SDL2_LIB_TEMPLATE(Utilities::Action<float(const float&)>);
 
 		/*
 		 *		Name: VibrationDescription
@@ -0,0 +1,680 @@
+#include "InputRecorder.hpp"
+
+//! Include the SDL2_Engine objects
+#include "../Globals.hpp"
+
+#include "../Time.hpp"
+#include "../Debug/Logger.hpp"
+#include "../Scenes/SceneManager.hpp"
+
+#include "../Utilities/Clock.hpp"
+#include "../Utilities/Endian/Endian.hpp"
+
+#include "InputRecorderInitialiser.hpp"
+
+//! Include the required STL objects
+#include <string>
+#include <vector>
+
+//! Include the C file functions
+#include <stdio.h>
+#include <string.h>
+
+//! Define the values that identify an input stream
+#define STREAM_MAGIC "SDIR"
+#define STREAM_VERSION 1
+
+//! Define the number of key states recorded for the keyboard
+#define KEYBOARD_STATE_SIZE 256U
+
+//! Define the number of GamePads recorded
+#define GAMEPAD_TOTAL 4U
+
+//! Flag the sections of a frame that are stored in the stream
+enum EFrameSection : unsigned char {
+	SECTION_KEYBOARD	= 1 << 0,
+	SECTION_MOUSE		= 1 << 1,
+	SECTION_GAMEPADS	= 1 << 2,
+	SECTION_AXIS		= 1 << 3
+};
+
+namespace SDL2_Engine {
+	namespace Input {
+		using namespace Initialisation;
+
+		/*
+			samePad - Compare the values of two GamePadRecord objects
+			Author: Mitchell Croft
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pFirst - The first GamePadRecord to compare
+			param[in] pSecond - The second GamePadRecord to compare
+
+			return bool - Returns true if the records store the same state
+		*/
+		static inline bool samePad(const GamePadRecord& pFirst, const GamePadRecord& pSecond) {
+			return (pFirst.connected == pSecond.connected &&
+					pFirst.packetID == pSecond.packetID &&
+					pFirst.buttonMask == pSecond.buttonMask &&
+					!memcmp(pFirst.axisValues, pSecond.axisValues, sizeof(float) * GamePadRecord::AXIS_TOTAL));
+		}
+
+		/*
+		 *		Name: InputFrame
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the complete input state of a single frame
+		**/
+		struct InputFrame {
+			//! Store the real delta time of the frame
+			float delta = 0.f;
+
+			//! Store the state of every key on the keyboard
+			unsigned char keyboard[KEYBOARD_STATE_SIZE] = {};
+
+			//! Store the position of the mouse
+			int mousePosition[2] = { 0, 0 };
+
+			//! Store a bitmask of the mouse buttons that are down
+			unsigned char mouseButtons = 0;
+
+			//! Store the state of each GamePad
+			GamePadRecord gamePads[GAMEPAD_TOTAL];
+
+			//! Store the resolved value of each Virtual Axis handle
+			std::vector<float> axis;
+		};
+
+		/*
+		 *		Name: InputRecorderInternalData
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the internal data for the Input Recorder object
+		**/
+		struct InputRecorder::InputRecorderInternalData {
+			//! Temporary storage of the Initialiser
+			const InputRecorderInitialiser* setup = nullptr;
+
+			//! Store the operation being performed
+			EInputRecordMode mode = EInputRecordMode::None;
+
+			//! Store the path and handle of the stream
+			std::string path;
+			FILE* file = nullptr;
+
+			//! Store the values stored in the header of the stream
+			uint64_t seed = 0;
+			float timestep = 0.f;
+
+			//! Flags if the program should quit when the replay finishes
+			bool quitOnFinish = true;
+
+			//! Flags if the header has been written to a recording
+			bool headerWritten = false;
+
+			//! Flags if every frame of a replay has been read
+			bool finished = false;
+
+			//! Store the number of frames written or read
+			size_t frameCount = 0;
+
+			//! Store the frame being synchronised and the last frame that was written
+			InputFrame frame, written;
+
+			//! Store the clock that replayed delta times are applied to
+			Utilities::VirtualClock* clock = nullptr;
+
+			//! Store the clock used to time the replay
+			Utilities::SteadyClock wallClock;
+			Utilities::clockTicks replayStart = 0;
+
+			/*
+				InputRecorderInternalData : write - Write a value to the stream in the standard byte order
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				Template T - The type of value to write
+
+				param[in] pValue - The value to write
+
+				return bool - Returns true if the value was written
+			*/
+			template<typename T>
+			inline bool write(const T& pValue) {
+				const T VALUE = Utilities::Endian::convert(pValue);
+				return (fwrite(&VALUE, sizeof(T), 1, file) == 1);
+			}
+
+			/*
+				InputRecorderInternalData : read - Read a value from the stream in the standard byte order
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				Template T - The type of value to read
+
+				param[out] pValue - Receives the value that was read
+
+				return bool - Returns true if the value was read
+			*/
+			template<typename T>
+			inline bool read(T& pValue) {
+				if (fread(&pValue, sizeof(T), 1, file) != 1) return false;
+				pValue = Utilities::Endian::convert(pValue);
+				return true;
+			}
+
+			/*
+				InputRecorderInternalData : writePad - Write the state of a GamePad to the stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pPad - The GamePadRecord to write
+
+				return bool - Returns true if the state was written
+			*/
+			inline bool writePad(const GamePadRecord& pPad) {
+				bool success = write((unsigned char)pPad.connected) && write(pPad.packetID) && write(pPad.buttonMask);
+				for (size_t i = 0; success && i < GamePadRecord::AXIS_TOTAL; i++)
+					success = write(pPad.axisValues[i]);
+				return success;
+			}
+
+			/*
+				InputRecorderInternalData : readPad - Read the state of a GamePad from the stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[out] pPad - Receives the state that was read
+
+				return bool - Returns true if the state was read
+			*/
+			inline bool readPad(GamePadRecord& pPad) {
+				unsigned char connected = 0;
+				bool success = read(connected) && read(pPad.packetID) && read(pPad.buttonMask);
+				for (size_t i = 0; success && i < GamePadRecord::AXIS_TOTAL; i++)
+					success = read(pPad.axisValues[i]);
+				pPad.connected = (connected != 0);
+				return success;
+			}
+
+			//! Process the stream
+			bool writeHeader();
+			bool readHeader();
+			bool writeFrame();
+			bool readFrame();
+
+			//! Stop recording after the stream has failed
+			void stop();
+		};
+
+		/*
+			InputRecorderInternalData : writeHeader - Write the identifying values of the stream
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the header was written
+		*/
+		bool InputRecorder::InputRecorderInternalData::writeHeader() {
+			return (fwrite(STREAM_MAGIC, sizeof(char), 4, file) == 4 &&
+					write((uint16_t)STREAM_VERSION) &&
+					write(seed) &&
+					write(timestep));
+		}
+
+		/*
+			InputRecorderInternalData : readHeader - Read and verify the identifying values of the stream
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the stream is a supported input stream
+		*/
+		bool InputRecorder::InputRecorderInternalData::readHeader() {
+			//Check the stream is an input stream
+			char magic[4];
+			if (fread(magic, sizeof(char), 4, file) != 4 || memcmp(magic, STREAM_MAGIC, 4)) return false;
+
+			//Check the version is supported
+			uint16_t version = 0;
+			if (!read(version) || version != STREAM_VERSION) return false;
+
+			//Read the replay values
+			return (read(seed) && read(timestep));
+		}
+
+		/*
+			InputRecorderInternalData : writeFrame - Write the sections of the frame that changed since the last frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the frame was written
+		*/
+		bool InputRecorder::InputRecorderInternalData::writeFrame() {
+			//Store the sections that changed
+			unsigned char sections = 0;
+
+			//Count the keys that changed
+			uint16_t keyChanges = 0;
+			for (size_t i = 0; i < KEYBOARD_STATE_SIZE; i++)
+				if (frame.keyboard[i] != written.keyboard[i]) ++keyChanges;
+			if (keyChanges) sections |= SECTION_KEYBOARD;
+
+			//Check if the mouse changed
+			if (frame.mousePosition[0] != written.mousePosition[0] || frame.mousePosition[1] != written.mousePosition[1] || frame.mouseButtons != written.mouseButtons)
+				sections |= SECTION_MOUSE;
+
+			//Flag the GamePads that changed
+			unsigned char padChanges = 0;
+			for (size_t i = 0; i < GAMEPAD_TOTAL; i++)
+				if (!samePad(frame.gamePads[i], written.gamePads[i])) padChanges |= (1 << i);
+			if (padChanges) sections |= SECTION_GAMEPADS;
+
+			//Count the Virtual Axis values that changed (Handles are never removed, so the frame is never smaller)
+			uint32_t axisChanges = 0;
+			for (size_t i = 0; i < frame.axis.size(); i++)
+				if (i >= written.axis.size() || frame.axis[i] != written.axis[i]) ++axisChanges;
+			if (axisChanges) sections |= SECTION_AXIS;
+
+			//Write the frame values
+			bool success = write(sections) && write(frame.delta);
+
+			//Write the changed keys
+			if (success && (sections & SECTION_KEYBOARD)) {
+				success = write(keyChanges);
+				for (size_t i = 0; success && i < KEYBOARD_STATE_SIZE; i++)
+					if (frame.keyboard[i] != written.keyboard[i]) success = write((unsigned char)i) && write(frame.keyboard[i]);
+			}
+
+			//Write the mouse
+			if (success && (sections & SECTION_MOUSE))
+				success = write((int32_t)frame.mousePosition[0]) && write((int32_t)frame.mousePosition[1]) && write(frame.mouseButtons);
+
+			//Write the changed GamePads
+			if (success && (sections & SECTION_GAMEPADS)) {
+				success = write(padChanges);
+				for (size_t i = 0; success && i < GAMEPAD_TOTAL; i++)
+					if (padChanges & (1 << i)) success = writePad(frame.gamePads[i]);
+			}
+
+			//Write the changed Virtual Axis values
+			if (success && (sections & SECTION_AXIS)) {
+				success = write((uint32_t)frame.axis.size()) && write(axisChanges);
+				for (size_t i = 0; success && i < frame.axis.size(); i++)
+					if (i >= written.axis.size() || frame.axis[i] != written.axis[i]) success = write((uint32_t)i) && write(frame.axis[i]);
+			}
+
+			//Store the frame to compare the next against
+			written = frame;
+			++frameCount;
+			return success;
+		}
+
+		/*
+			InputRecorderInternalData : readFrame - Read the sections of the next frame over the current frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if a complete frame was read
+		*/
+		bool InputRecorder::InputRecorderInternalData::readFrame() {
+			//Read the frame values
+			unsigned char sections = 0;
+			if (!read(sections) || !read(frame.delta)) return false;
+
+			//Read the changed keys
+			if (sections & SECTION_KEYBOARD) {
+				uint16_t keyChanges = 0;
+				if (!read(keyChanges)) return false;
+				for (uint16_t i = 0; i < keyChanges; i++) {
+					unsigned char key = 0;
+					if (!read(key) || !read(frame.keyboard[key])) return false;
+				}
+			}
+
+			//Read the mouse
+			if (sections & SECTION_MOUSE) {
+				int32_t x = 0, y = 0;
+				if (!read(x) || !read(y) || !read(frame.mouseButtons)) return false;
+				frame.mousePosition[0] = (int)x;
+				frame.mousePosition[1] = (int)y;
+			}
+
+			//Read the changed GamePads
+			if (sections & SECTION_GAMEPADS) {
+				unsigned char padChanges = 0;
+				if (!read(padChanges)) return false;
+				for (size_t i = 0; i < GAMEPAD_TOTAL; i++)
+					if ((padChanges & (1 << i)) && !readPad(frame.gamePads[i])) return false;
+			}
+
+			//Read the changed Virtual Axis values
+			if (sections & SECTION_AXIS) {
+				uint32_t count = 0, axisChanges = 0;
+				if (!read(count) || !read(axisChanges)) return false;
+				frame.axis.resize(count, 0.f);
+				for (uint32_t i = 0; i < axisChanges; i++) {
+					uint32_t handle = 0;
+					if (!read(handle) || handle >= count || !read(frame.axis[handle])) return false;
+				}
+			}
+
+			//Count the frame
+			++frameCount;
+			return true;
+		}
+
+		/*
+			InputRecorderInternalData : stop - Close the stream and return to reading the attached devices
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void InputRecorder::InputRecorderInternalData::stop() {
+			Globals::get<Debug::Logger>().logError("Input Recorder failed to write to '%s' after %zu frame(s). Recording has stopped", path.c_str(), frameCount);
+			fclose(file);
+			file = nullptr;
+			mode = EInputRecordMode::None;
+		}
+
+		/*
+			InputRecorder : isRecording - Check if input is being written to the stream
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the Input Recorder is recording
+		*/
+		bool InputRecorder::isRecording() const { return (mData->mode == EInputRecordMode::Record); }
+
+		/*
+			InputRecorder : isReplaying - Check if input is being read from the stream
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the Input Recorder is replaying, including after the stream has finished
+		*/
+		bool InputRecorder::isReplaying() const { return (mData->mode == EInputRecordMode::Replay); }
+
+		/*
+			InputRecorder : isFinished - Check if a replay has reached the end of the stream
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true once every frame of the stream has been replayed
+		*/
+		bool InputRecorder::isFinished() const { return mData->finished; }
+
+		/*
+			InputRecorder : getSeed - Get the seed stored in the stream
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const uint64_t& - Returns the seed as a constant reference
+		*/
+		const uint64_t& InputRecorder::getSeed() const { return mData->seed; }
+
+		/*
+			InputRecorder : setSeed - Set the seed stored in a recording
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeed - The seed that the application's random generators were seeded with
+
+			return bool - Returns true if the seed will be stored
+
+			NOTE:
+			The seed can only be changed while recording, before the first update writes the header
+		*/
+		bool InputRecorder::setSeed(const uint64_t& pSeed) {
+			//Check the header hasn't been written
+			if (mData->mode != EInputRecordMode::Record || mData->headerWritten) return false;
+
+			//Store the seed
+			mData->seed = pSeed;
+			return true;
+		}
+
+		/*
+			InputRecorder : getTimestep - Get the fixed time step stored in the stream
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const float& - Returns the fixed time step in seconds, or 0 if the loop was variable
+		*/
+		const float& InputRecorder::getTimestep() const { return mData->timestep; }
+
+		/*
+			InputRecorder : getFrameCount - Get the number of frames written or read
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const size_t& - Returns the frame count as a constant reference
+		*/
+		const size_t& InputRecorder::getFrameCount() const { return mData->frameCount; }
+
+		/*
+			InputRecorder : setReplayClock - Set the clock that replayed delta times are applied to
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pClock - A pointer to the VirtualClock read by the Time object (Ownership is not taken)
+		*/
+		void InputRecorder::setReplayClock(Utilities::VirtualClock* pClock) { mData->clock = pClock; }
+
+		/*
+			InputRecorder : syncKeyboard - Exchange the current keyboard state with the frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in/out] pState - A pointer to the 256 key states of the keyboard
+		*/
+		void InputRecorder::syncKeyboard(unsigned char* pState) {
+			if (mData->mode == EInputRecordMode::Record) memcpy(mData->frame.keyboard, pState, KEYBOARD_STATE_SIZE);
+			else if (mData->mode == EInputRecordMode::Replay) memcpy(pState, mData->frame.keyboard, KEYBOARD_STATE_SIZE);
+		}
+
+		/*
+			InputRecorder : syncMouse - Exchange the current mouse state with the frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in/out] pPosition - A pointer to the X and Y position of the mouse
+			param[in/out] pButtons - A pointer to the down flags of the mouse buttons
+			param[in] pButtonCount - The number of flags in pButtons (Maximum of 8)
+		*/
+		void InputRecorder::syncMouse(int* pPosition, bool* pButtons, const size_t& pButtonCount) {
+			//Get the number of buttons that fit in the mask
+			const size_t COUNT = (pButtonCount < 8 ? pButtonCount : 8);
+
+			//Copy the device state into the frame
+			if (mData->mode == EInputRecordMode::Record) {
+				mData->frame.mousePosition[0] = pPosition[0];
+				mData->frame.mousePosition[1] = pPosition[1];
+				mData->frame.mouseButtons = 0;
+				for (size_t i = 0; i < COUNT; i++)
+					if (pButtons[i]) mData->frame.mouseButtons |= (1 << i);
+			}
+
+			//Copy the frame into the device state
+			else if (mData->mode == EInputRecordMode::Replay) {
+				pPosition[0] = mData->frame.mousePosition[0];
+				pPosition[1] = mData->frame.mousePosition[1];
+				for (size_t i = 0; i < COUNT; i++)
+					pButtons[i] = ((mData->frame.mouseButtons & (1 << i)) != 0);
+			}
+		}
+
+		/*
+			InputRecorder : syncGamePad - Exchange the current state of a GamePad with the frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pIndex - The index of the GamePad (0 - 3)
+			param[in/out] pRecord - The GamePadRecord describing the state of the GamePad
+		*/
+		void InputRecorder::syncGamePad(const size_t& pIndex, GamePadRecord& pRecord) {
+			//Check the index is in range
+			if (pIndex >= GAMEPAD_TOTAL) return;
+
+			//Exchange the state
+			if (mData->mode == EInputRecordMode::Record) mData->frame.gamePads[pIndex] = pRecord;
+			else if (mData->mode == EInputRecordMode::Replay) pRecord = mData->frame.gamePads[pIndex];
+		}
+
+		/*
+			InputRecorder : syncAxis - Exchange the current value of a Virtual Axis with the frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pHandle - The handle of the Virtual Axis
+			param[in/out] pValue - The resolved value of the Virtual Axis
+
+			NOTE:
+			Replayed handles that were not in the recording are given a value of 0
+		*/
+		void InputRecorder::syncAxis(const size_t& pHandle, float& pValue) {
+			//Copy the value into the frame
+			if (mData->mode == EInputRecordMode::Record) {
+				if (pHandle >= mData->frame.axis.size()) mData->frame.axis.resize(pHandle + 1, 0.f);
+				mData->frame.axis[pHandle] = pValue;
+			}
+
+			//Copy the frame into the value
+			else if (mData->mode == EInputRecordMode::Replay)
+				pValue = (pHandle < mData->frame.axis.size() ? mData->frame.axis[pHandle] : 0.f);
+		}
+
+		/*
+			InputRecorder : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSetup - Defines how the Input Recorder should be setup
+		*/
+		InputRecorder::InputRecorder(const InputRecorderInitialiser& pSetup) : mData(nullptr) {
+			//Create the data object
+			mData = new InputRecorderInternalData();
+
+			//Stow the Initialiser values
+			mData->setup = &pSetup;
+		}
+
+		/*
+			InputRecorder : createInterface - Open the stream and process the header
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the stream was opened
+		*/
+		bool InputRecorder::createInterface() {
+			//Get the initialiser object
+			auto setup = mData->setup;
+			mData->setup = nullptr;
+
+			//Copy the initial values
+			mData->mode = setup->mode;
+			mData->seed = setup->seed;
+			mData->quitOnFinish = setup->quitOnFinish;
+
+			//Check if there is a stream to open
+			if (mData->mode == EInputRecordMode::None) return true;
+
+			//Check a path was supplied
+			if (!setup->path || !*setup->path) {
+				Globals::get<Debug::Logger>().logError("Input Recorder was not given the path of a stream to use");
+				return false;
+			}
+			mData->path = setup->path;
+
+			//Open the stream
+			if (!(mData->file = fopen(setup->path, (mData->mode == EInputRecordMode::Record ? "wb" : "rb")))) {
+				Globals::get<Debug::Logger>().logError("Input Recorder failed to open the stream '%s'", setup->path);
+				return false;
+			}
+
+			//Read the header of a replay
+			if (mData->mode == EInputRecordMode::Replay) {
+				if (!mData->readHeader()) {
+					Globals::get<Debug::Logger>().logError("Input Recorder could not replay '%s' as it is not a supported input stream", setup->path);
+					return false;
+				}
+
+				//Start timing the replay
+				mData->replayStart = mData->wallClock.now();
+			}
+
+			//Return success
+			return true;
+		}
+
+		/*
+			InputRecorder : destroyInterface - Close the stream and deallocate internal memory
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void InputRecorder::destroyInterface() {
+			if (mData) {
+				//Close the stream
+				if (mData->file) fclose(mData->file);
+
+				//Delete the data
+				delete mData;
+				mData = nullptr;
+			}
+		}
+
+		/*
+			InputRecorder : update - Write the last frame or read the next frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void InputRecorder::update() {
+			switch (mData->mode) {
+			case EInputRecordMode::Record: {
+				//Write the header on the first update, once the Time object has been setup
+				if (!mData->headerWritten) {
+					mData->timestep = Globals::get<Time>().getFixedDelta();
+					mData->headerWritten = true;
+					if (!mData->writeHeader()) mData->stop();
+				}
+
+				//Write the frame that was synchronised during the last update, which Time still holds the delta of
+				else {
+					mData->frame.delta = Globals::get<Time>().getRealDelta();
+					if (!mData->writeFrame()) mData->stop();
+				}
+				break; }
+			case EInputRecordMode::Replay: {
+				//Check there are frames left to read
+				if (mData->finished) break;
+
+				//Read the next frame and move time forward by its delta
+				if (mData->readFrame()) {
+					if (mData->clock) mData->clock->advance(mData->frame.delta);
+				}
+
+				//Otherwise the replay is over
+				else {
+					//Flag the end of the stream
+					mData->finished = true;
+
+					//Output the time the replay took to process
+					Globals::get<Debug::Logger>().logFormatted("Input Recorder replayed %zu frame(s) of '%s' in %.2fms", mData->frameCount, mData->path.c_str(), mData->wallClock.toSeconds(mData->wallClock.now() - mData->replayStart) * 1000.0);
+
+					//Hold the last delta so that time continues to pass
+					if (mData->clock) mData->clock->setStep(mData->frame.delta);
+
+					//Close the program if required
+					if (mData->quitOnFinish && Globals::interfaceExists<Scenes::SceneManager>())
+						Globals::get<Scenes::SceneManager>().quit();
+				}
+				break; }
+			default: break;
+			}
+		}
+	}
+}
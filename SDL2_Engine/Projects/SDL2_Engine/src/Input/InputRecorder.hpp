@@ -0,0 +1,241 @@
+#pragma once
+
+//! Include SDL2_Engine objects
+#include "../__LibraryManagement.hpp"
+#include "../Utilities/IGlobal.hpp"
+
+//! Include the fixed width integer types
+#include <stdint.h>
+
+namespace SDL2_Engine {
+	//! Prototype the Input Recorder Initialiser object
+	namespace Initialisation { struct InputRecorderInitialiser; }
+
+	//! Prototype the Virtual Clock object
+	namespace Utilities { class VirtualClock; }
+
+	namespace Input {
+		/*
+		 *		Name: GamePadRecord
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the raw state of a single GamePad for a recorded frame
+		**/
+		struct GamePadRecord {
+			//! Store the number of axis values recorded for each GamePad
+			static const size_t AXIS_TOTAL = 6;
+
+			//! Flags if the GamePad was connected
+			bool connected = false;
+
+			//! Store the packet ID of the last state received from the GamePad
+			uint32_t packetID = 0;
+
+			//! Store the bitmask of the buttons that were down
+			uint16_t buttonMask = 0;
+
+			//! Store the normalised values of the GamePad axis
+			float axisValues[AXIS_TOTAL] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+		};
+
+		/*
+		 *		Name: InputRecorder
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Record the raw device states and resolved Virtual Axis values of
+		 *		each frame to a binary stream, or replay a stream back into the
+		 *		input objects with no devices attached
+		 *
+		 *		Notes:
+		 *		The stream begins with a header storing the seed and fixed time step
+		 *		the application ran with. Each frame stores the real delta time of
+		 *		the frame followed by only the sections that changed since the last
+		 *		frame.
+		 *
+		 *		The input objects call the sync functions during their update. When
+		 *		recording, the sync functions copy the device state into the frame.
+		 *		When replaying, they copy the frame into the device state. The Input
+		 *		Recorder must be updated before the Time and input objects, so that
+		 *		replayed deltas can be applied to a VirtualClock before Time reads it.
+		 *
+		 *		The frame in progress when recording stops is not stored
+		**/
+		class SDL2_LIB_INC InputRecorder : public Utilities::IGlobal {
+		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////--------------------------------------Recorder State---------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				InputRecorder : isRecording - Check if input is being written to the stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return bool - Returns true if the Input Recorder is recording
+			*/
+			bool isRecording() const;
+
+			/*
+				InputRecorder : isReplaying - Check if input is being read from the stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return bool - Returns true if the Input Recorder is replaying, including after the stream has finished
+			*/
+			bool isReplaying() const;
+
+			/*
+				InputRecorder : isFinished - Check if a replay has reached the end of the stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return bool - Returns true once every frame of the stream has been replayed
+			*/
+			bool isFinished() const;
+
+			/*
+				InputRecorder : getSeed - Get the seed stored in the stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const uint64_t& - Returns the seed as a constant reference
+			*/
+			const uint64_t& getSeed() const;
+
+			/*
+				InputRecorder : setSeed - Set the seed stored in a recording
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pSeed - The seed that the application's random generators were seeded with
+
+				return bool - Returns true if the seed will be stored
+
+				NOTE:
+				The seed can only be changed while recording, before the first update writes the header
+			*/
+			bool setSeed(const uint64_t& pSeed);
+
+			/*
+				InputRecorder : getTimestep - Get the fixed time step stored in the stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const float& - Returns the fixed time step in seconds, or 0 if the loop was variable
+			*/
+			const float& getTimestep() const;
+
+			/*
+				InputRecorder : getFrameCount - Get the number of frames written or read
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const size_t& - Returns the frame count as a constant reference
+			*/
+			const size_t& getFrameCount() const;
+
+			/*
+				InputRecorder : setReplayClock - Set the clock that replayed delta times are applied to
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pClock - A pointer to the VirtualClock read by the Time object (Ownership is not taken)
+			*/
+			void setReplayClock(Utilities::VirtualClock* pClock);
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////----------------------------------Device Synchronisation-----------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				InputRecorder : syncKeyboard - Exchange the current keyboard state with the frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in/out] pState - A pointer to the 256 key states of the keyboard
+			*/
+			void syncKeyboard(unsigned char* pState);
+
+			/*
+				InputRecorder : syncMouse - Exchange the current mouse state with the frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in/out] pPosition - A pointer to the X and Y position of the mouse
+				param[in/out] pButtons - A pointer to the down flags of the mouse buttons
+				param[in] pButtonCount - The number of flags in pButtons (Maximum of 8)
+			*/
+			void syncMouse(int* pPosition, bool* pButtons, const size_t& pButtonCount);
+
+			/*
+				InputRecorder : syncGamePad - Exchange the current state of a GamePad with the frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pIndex - The index of the GamePad (0 - 3)
+				param[in/out] pRecord - The GamePadRecord describing the state of the GamePad
+			*/
+			void syncGamePad(const size_t& pIndex, GamePadRecord& pRecord);
+
+			/*
+				InputRecorder : syncAxis - Exchange the current value of a Virtual Axis with the frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pHandle - The handle of the Virtual Axis
+				param[in/out] pValue - The resolved value of the Virtual Axis
+
+				NOTE:
+				Replayed handles that were not in the recording are given a value of 0
+			*/
+			void syncAxis(const size_t& pHandle, float& pValue);
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------Construction/Destruction----------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				InputRecorder : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pSetup - Defines how the Input Recorder should be setup
+			*/
+			InputRecorder(const Initialisation::InputRecorderInitialiser& pSetup);
+
+			/*
+				InputRecorder : createInterface - Open the stream and process the header
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return bool - Returns true if the stream was opened
+			*/
+			bool createInterface() override;
+
+			/*
+				InputRecorder : destroyInterface - Close the stream and deallocate internal memory
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void destroyInterface() override;
+
+			/*
+				InputRecorder : update - Write the last frame or read the next frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void update() override;
+
+		private:
+			//! Define the internal protected elements for the Input Recorder
+			struct InputRecorderInternalData;
+			InputRecorderInternalData* mData;
+		};
+	}
+}
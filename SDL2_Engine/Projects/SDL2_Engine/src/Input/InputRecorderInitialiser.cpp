@@ -0,0 +1,17 @@
+#include "InputRecorderInitialiser.hpp"
+
+namespace SDL2_Engine {
+	namespace Initialisation {
+		/*
+			InputRecorderInitialiser : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		InputRecorderInitialiser::InputRecorderInitialiser() :
+			mode(EInputRecordMode::None),
+			path(nullptr),
+			seed(0),
+			quitOnFinish(true)
+		{}
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+//! Include the SDL2_Engine objects
+#include "../__LibraryManagement.hpp"
+
+//! Include the fixed width integer types
+#include <stdint.h>
+
+namespace SDL2_Engine {
+	namespace Initialisation {
+		//! Flag the ways the Input Recorder can operate
+		enum class EInputRecordMode {
+			//! Input is read from the attached devices and no stream is used
+			None,
+
+			//! Input is read from the attached devices and written to the stream each frame
+			Record,
+
+			//! Input is read from the stream each frame and the attached devices are ignored
+			Replay
+		};
+
+		/*
+		 *		Name: InputRecorderInitialiser
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store initialisation settings for the Input Recorder object
+		**/
+		struct SDL2_LIB_INC InputRecorderInitialiser {
+			//! The way the Input Recorder operates (Default None)
+			EInputRecordMode mode;
+
+			//! The path of the file to record to or replay from (Default nullptr)
+			const char* path;
+
+			//! The seed stored in a recording for the application to seed its random generators with (Default 0)
+			uint64_t seed;
+
+			//! Flags if the program should quit once a replay has reached the end of the stream (Default true)
+			bool quitOnFinish;
+
+			/*
+				InputRecorderInitialiser : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			InputRecorderInitialiser();
+		};
+	}
+}
@@ -1,13 +1,25 @@
 #include "Keyboard.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "../../Utilities/Portability.hpp"
+
 //! Include the global values required to get time information
 #include "../../Globals.hpp"
 #include "../../Time.hpp"
 #include "../../Window/Window.hpp"
+#include "../InputRecorder.hpp"
+
+//! Include the keyboard state functionality
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <SDL.h>
+#endif
 
 //! Include the required STL objects
 #include <bitset>
 #include <array>
+#include <cctype>
 
 //! Define the size of a Keyboard state
 #define KEYBOARD_STATE_SIZE 256U
@@ -24,6 +36,10 @@ enum EStates : unsigned char { STATE_CUR, STATE_PRE, STATE_TOTAL };
 
 namespace SDL2_Engine {
 	namespace Input {
+		//! Prototype the platform specific keyboard functions
+		void pollKeyboardState(BYTE pState[KEYBOARD_STATE_SIZE]);
+		int virtualKeyToCharacter(const EKeyboardKeyCode& pKey, BYTE pState[KEYBOARD_STATE_SIZE]);
+
 		/*
 		 *		Name: KeyboardInternalData
 		 *		Author: Mitchell Croft
@@ -46,7 +62,7 @@ namespace SDL2_Engine {
 		/*
 			Keyboard : verifyKeyboardInput - Verify the key value that is being tested for appending to the passed in string
 			Created: 20/07/2017
-			Modified: 15/10/2017
+			Modified: 16/10/2026
 
 			param[in/out] pString - A reference to the standard string object to fill
 			param[in] pKey - The virtual key that is being tested for inclusion
@@ -71,23 +87,16 @@ namespace SDL2_Engine {
 
 			//Otherwise convert the key to text
 			else {
-				//Create a buffer to hold the character
-				WORD buffer = 0;
-
 				//Convert the key
-				ToAscii((int)pKey,
-					MapVirtualKey((int)pKey, MAPVK_VK_TO_VSC),
-					mData->keyboardStates[STATE_CUR],
-					&buffer,
-					0);
+				const int CHARACTER = virtualKeyToCharacter(pKey, mData->keyboardStates[STATE_CUR]);
 
 				//Check the flags to validate the character
-				if (isprint(buffer) &&
-					((isalpha(buffer) && pFlags & EKeyboardInputFlags::Alphabetical) ||
-					(isdigit(buffer) && pFlags & EKeyboardInputFlags::Numerical) ||
-						(buffer == VK_SPACE && pFlags & EKeyboardInputFlags::Space) ||
+				if (CHARACTER > 0 && CHARACTER < 256 && isprint(CHARACTER) &&
+					((isalpha(CHARACTER) && pFlags & EKeyboardInputFlags::Alphabetical) ||
+					(isdigit(CHARACTER) && pFlags & EKeyboardInputFlags::Numerical) ||
+						(CHARACTER == ' ' && pFlags & EKeyboardInputFlags::Space) ||
 					pFlags & EKeyboardInputFlags::Special))
-					pString += (char)buffer;
+					pString += (char)CHARACTER;
 			}
 
 			//Return if string length is different
@@ -126,23 +135,33 @@ namespace SDL2_Engine {
 		/*
 			Keyboard : update - Update the Keyboard input states
 			Created: 19/07/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 		*/
 		void Keyboard::update() {
-			//Check that the Window has focus
-			if (!Globals::get<Window>().hasProperty(EWindowProperties::Focus)) return;
+			//Get the Input Recorder (if there is one)
+			InputRecorder* recorder = (Globals::interfaceExists<InputRecorder>() ? &Globals::get<InputRecorder>() : nullptr);
+			const bool REPLAYING = (recorder && recorder->isReplaying());
+
+			//Check that the Window has focus, replays don't rely on the device
+			if (!REPLAYING && !Globals::get<Window>().hasProperty(EWindowProperties::Focus)) return;
 
 			//Get the time object
 			Time& time = Globals::get<Time>();
 
-			//Poll keyboard update messages
-			GetKeyState(NULL);
-
 			//Copy the current keyboard state data
 			memcpy_s(mData->keyboardStates[STATE_PRE], sizeof(BYTE) * KEYBOARD_STATE_SIZE, mData->keyboardStates[STATE_CUR], sizeof(BYTE) * KEYBOARD_STATE_SIZE);
 
-			//Get the current keyboard state
-			GetKeyboardState(mData->keyboardStates[STATE_CUR]);
+			//Read the current keyboard state from the replay
+			if (REPLAYING) recorder->syncKeyboard(mData->keyboardStates[STATE_CUR]);
+
+			//Otherwise poll the device
+			else {
+				//Get the current keyboard state
+				pollKeyboardState(mData->keyboardStates[STATE_CUR]);
+
+				//Record the state
+				if (recorder) recorder->syncKeyboard(mData->keyboardStates[STATE_CUR]);
+			}
 
 			//Update the repeat key timers
 			for (int i = (int)mData->repeatTimers.size() - 1; i >= 0; i--) {
@@ -250,5 +269,254 @@ namespace SDL2_Engine {
 			//Return the modified flag
 			return modified;
 		}
+
+	#ifdef _WIN32
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////---------------------------------Windows Keyboard Backend----------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			pollKeyboardState - Read the current state of every virtual key
+			Author: Mitchell Croft
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in/out] pState - The virtual key indexed state buffer to fill
+		*/
+		void pollKeyboardState(BYTE pState[KEYBOARD_STATE_SIZE]) {
+			//Poll keyboard update messages
+			GetKeyState(NULL);
+
+			//Get the current keyboard state
+			GetKeyboardState(pState);
+		}
+
+		/*
+			virtualKeyToCharacter - Convert a virtual key to the character it produces
+			Author: Mitchell Croft
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pKey - The virtual key to convert
+			param[in] pState - The virtual key indexed state buffer to apply modifiers from
+
+			return int - Returns the character produced by the key, or 0 if there is none
+		*/
+		int virtualKeyToCharacter(const EKeyboardKeyCode& pKey, BYTE pState[KEYBOARD_STATE_SIZE]) {
+			//Create a buffer to hold the character
+			WORD buffer = 0;
+
+			//Convert the key
+			ToAscii((int)pKey,
+				MapVirtualKey((int)pKey, MAPVK_VK_TO_VSC),
+				pState,
+				&buffer,
+				0);
+
+			//Return the character
+			return buffer;
+		}
+	#else
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------SDL Keyboard Backend------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			getVirtualKeyScancodes - Get the table mapping virtual key codes to SDL scancodes
+			Author: Mitchell Croft
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const std::array<SDL_Scancode, KEYBOARD_STATE_SIZE>& - Returns the table as a constant reference
+
+			NOTE:
+			The generic Shift, Control and Alt keys have no scancode and are resolved from their left and right keys
+		*/
+		const std::array<SDL_Scancode, KEYBOARD_STATE_SIZE>& getVirtualKeyScancodes() {
+			static const std::array<SDL_Scancode, KEYBOARD_STATE_SIZE> TABLE = [] {
+				//Default every key to unknown
+				std::array<SDL_Scancode, KEYBOARD_STATE_SIZE> table;
+				table.fill(SDL_SCANCODE_UNKNOWN);
+
+				//Map the ranges that are sequential in both sets
+				for (int i = 0; i < 26; i++) table[(int)EKeyboardKeyCode::A + i] = (SDL_Scancode)(SDL_SCANCODE_A + i);
+				for (int i = 1; i < 10; i++) table[(int)EKeyboardKeyCode::Num0 + i] = (SDL_Scancode)(SDL_SCANCODE_1 + i - 1);
+				for (int i = 1; i < 10; i++) table[(int)EKeyboardKeyCode::Num_Pad0 + i] = (SDL_Scancode)(SDL_SCANCODE_KP_1 + i - 1);
+				for (int i = 0; i < 12; i++) table[(int)EKeyboardKeyCode::F1 + i] = (SDL_Scancode)(SDL_SCANCODE_F1 + i);
+				for (int i = 0; i < 12; i++) table[(int)EKeyboardKeyCode::F13 + i] = (SDL_Scancode)(SDL_SCANCODE_F13 + i);
+				table[(int)EKeyboardKeyCode::Num0] = SDL_SCANCODE_0;
+				table[(int)EKeyboardKeyCode::Num_Pad0] = SDL_SCANCODE_KP_0;
+
+				//Map the remaining keys individually
+				table[(int)EKeyboardKeyCode::Num_Pad_Multiply] = SDL_SCANCODE_KP_MULTIPLY;
+				table[(int)EKeyboardKeyCode::Num_Pad_Add] = SDL_SCANCODE_KP_PLUS;
+				table[(int)EKeyboardKeyCode::Num_Pad_Subtract] = SDL_SCANCODE_KP_MINUS;
+				table[(int)EKeyboardKeyCode::Num_Pad_Decimal] = SDL_SCANCODE_KP_PERIOD;
+				table[(int)EKeyboardKeyCode::Num_Pad_Divide] = SDL_SCANCODE_KP_DIVIDE;
+				table[(int)EKeyboardKeyCode::Semi_Colon] = SDL_SCANCODE_SEMICOLON;
+				table[(int)EKeyboardKeyCode::Plus] = SDL_SCANCODE_EQUALS;
+				table[(int)EKeyboardKeyCode::Comma] = SDL_SCANCODE_COMMA;
+				table[(int)EKeyboardKeyCode::Minus] = SDL_SCANCODE_MINUS;
+				table[(int)EKeyboardKeyCode::Period] = SDL_SCANCODE_PERIOD;
+				table[(int)EKeyboardKeyCode::Slash_Forward] = SDL_SCANCODE_SLASH;
+				table[(int)EKeyboardKeyCode::Slash_Backward] = SDL_SCANCODE_BACKSLASH;
+				table[(int)EKeyboardKeyCode::Tilde] = SDL_SCANCODE_GRAVE;
+				table[(int)EKeyboardKeyCode::Square_Left] = SDL_SCANCODE_LEFTBRACKET;
+				table[(int)EKeyboardKeyCode::Square_Right] = SDL_SCANCODE_RIGHTBRACKET;
+				table[(int)EKeyboardKeyCode::Quote] = SDL_SCANCODE_APOSTROPHE;
+				table[(int)EKeyboardKeyCode::Space] = SDL_SCANCODE_SPACE;
+				table[(int)EKeyboardKeyCode::Arrow_Left] = SDL_SCANCODE_LEFT;
+				table[(int)EKeyboardKeyCode::Arrow_Up] = SDL_SCANCODE_UP;
+				table[(int)EKeyboardKeyCode::Arrow_Right] = SDL_SCANCODE_RIGHT;
+				table[(int)EKeyboardKeyCode::Arrow_Down] = SDL_SCANCODE_DOWN;
+				table[(int)EKeyboardKeyCode::Escape] = SDL_SCANCODE_ESCAPE;
+				table[(int)EKeyboardKeyCode::Backspace] = SDL_SCANCODE_BACKSPACE;
+				table[(int)EKeyboardKeyCode::TAB] = SDL_SCANCODE_TAB;
+				table[(int)EKeyboardKeyCode::Return] = SDL_SCANCODE_RETURN;
+				table[(int)EKeyboardKeyCode::Shift_Left] = SDL_SCANCODE_LSHIFT;
+				table[(int)EKeyboardKeyCode::Shift_Right] = SDL_SCANCODE_RSHIFT;
+				table[(int)EKeyboardKeyCode::Control_Left] = SDL_SCANCODE_LCTRL;
+				table[(int)EKeyboardKeyCode::Control_Right] = SDL_SCANCODE_RCTRL;
+				table[(int)EKeyboardKeyCode::Alt_Left] = SDL_SCANCODE_LALT;
+				table[(int)EKeyboardKeyCode::Alt_Right] = SDL_SCANCODE_RALT;
+				table[(int)EKeyboardKeyCode::Windows_Left] = SDL_SCANCODE_LGUI;
+				table[(int)EKeyboardKeyCode::Windows_Right] = SDL_SCANCODE_RGUI;
+				table[(int)EKeyboardKeyCode::Apps] = SDL_SCANCODE_APPLICATION;
+				table[(int)EKeyboardKeyCode::Page_Up] = SDL_SCANCODE_PAGEUP;
+				table[(int)EKeyboardKeyCode::Page_Down] = SDL_SCANCODE_PAGEDOWN;
+				table[(int)EKeyboardKeyCode::End] = SDL_SCANCODE_END;
+				table[(int)EKeyboardKeyCode::Home] = SDL_SCANCODE_HOME;
+				table[(int)EKeyboardKeyCode::Cancel] = SDL_SCANCODE_CANCEL;
+				table[(int)EKeyboardKeyCode::Clear] = SDL_SCANCODE_CLEAR;
+				table[(int)EKeyboardKeyCode::Select] = SDL_SCANCODE_SELECT;
+				table[(int)EKeyboardKeyCode::Execute] = SDL_SCANCODE_EXECUTE;
+				table[(int)EKeyboardKeyCode::Print_Screen] = SDL_SCANCODE_PRINTSCREEN;
+				table[(int)EKeyboardKeyCode::Insert] = SDL_SCANCODE_INSERT;
+				table[(int)EKeyboardKeyCode::Delete] = SDL_SCANCODE_DELETE;
+				table[(int)EKeyboardKeyCode::Help] = SDL_SCANCODE_HELP;
+				table[(int)EKeyboardKeyCode::Sleep] = SDL_SCANCODE_SLEEP;
+				table[(int)EKeyboardKeyCode::Caps_Lock] = SDL_SCANCODE_CAPSLOCK;
+				table[(int)EKeyboardKeyCode::Num_Lock] = SDL_SCANCODE_NUMLOCKCLEAR;
+				table[(int)EKeyboardKeyCode::Scroll_Lock] = SDL_SCANCODE_SCROLLLOCK;
+				return table;
+			}();
+			return TABLE;
+		}
+
+		/*
+			pollKeyboardState - Read the current state of every virtual key
+			Author: Mitchell Croft
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in/out] pState - The virtual key indexed state buffer to fill, holding the previous state
+
+			NOTE:
+			The buffer is filled with the same pressed and toggled bits that GetKeyboardState produces.
+			Lock keys take their toggle from SDL's modifier state, all other keys toggle on each press
+		*/
+		void pollKeyboardState(BYTE pState[KEYBOARD_STATE_SIZE]) {
+			//Get the SDL keyboard state, updated by the event loop
+			const Uint8* KEYS = SDL_GetKeyboardState(nullptr);
+			const SDL_Keymod MODS = SDL_GetModState();
+
+			//Get the scancode table
+			const std::array<SDL_Scancode, KEYBOARD_STATE_SIZE>& TABLE = getVirtualKeyScancodes();
+
+			//Store the generic modifier keys and the keys they are resolved from
+			const int GENERIC[][3] = {
+				{ (int)EKeyboardKeyCode::Shift, (int)EKeyboardKeyCode::Shift_Left, (int)EKeyboardKeyCode::Shift_Right },
+				{ (int)EKeyboardKeyCode::Control, (int)EKeyboardKeyCode::Control_Left, (int)EKeyboardKeyCode::Control_Right },
+				{ (int)EKeyboardKeyCode::Alt, (int)EKeyboardKeyCode::Alt_Left, (int)EKeyboardKeyCode::Alt_Right }
+			};
+
+			//Update the mapped keys
+			for (size_t i = 0; i < KEYBOARD_STATE_SIZE; i++) {
+				//Check the key is down
+				const bool DOWN = (TABLE[i] != SDL_SCANCODE_UNKNOWN && KEYS[TABLE[i]]);
+
+				//Flip the toggle on the first frame of a press
+				BYTE toggle = pState[i] & TOGGLED_MASK;
+				if (DOWN && !(pState[i] & PRESSED_MASK)) toggle ^= TOGGLED_MASK;
+
+				//Store the new state
+				pState[i] = (DOWN ? PRESSED_MASK : 0) | toggle;
+			}
+
+			//Resolve the generic modifier keys
+			for (size_t i = 0; i < 3; i++)
+				pState[GENERIC[i][0]] = (pState[GENERIC[i][1]] | pState[GENERIC[i][2]]) & PRESSED_MASK;
+
+			//Apply the lock key toggles
+			pState[(int)EKeyboardKeyCode::Caps_Lock] = (pState[(int)EKeyboardKeyCode::Caps_Lock] & PRESSED_MASK) | (MODS & KMOD_CAPS ? TOGGLED_MASK : 0);
+			pState[(int)EKeyboardKeyCode::Num_Lock] = (pState[(int)EKeyboardKeyCode::Num_Lock] & PRESSED_MASK) | (MODS & KMOD_NUM ? TOGGLED_MASK : 0);
+		}
+
+		/*
+			virtualKeyToCharacter - Convert a virtual key to the character it produces
+			Author: Mitchell Croft
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pKey - The virtual key to convert
+			param[in] pState - The virtual key indexed state buffer to apply modifiers from
+
+			return int - Returns the character produced by the key, or 0 if there is none
+
+			NOTE:
+			The OEM virtual keys are defined by their position on a US layout, so they are translated as such
+		*/
+		int virtualKeyToCharacter(const EKeyboardKeyCode& pKey, BYTE pState[KEYBOARD_STATE_SIZE]) {
+			//Get the modifier states
+			const bool SHIFT = (pState[(int)EKeyboardKeyCode::Shift] & PRESSED_MASK) != 0;
+			const bool CAPS = (pState[(int)EKeyboardKeyCode::Caps_Lock] & TOGGLED_MASK) != 0;
+			const bool NUM = (pState[(int)EKeyboardKeyCode::Num_Lock] & TOGGLED_MASK) != 0;
+
+			//Store the shifted forms of the number row
+			const char SHIFTED_DIGITS[] = ")!@#$%^&*(";
+
+			//Store the unshifted and shifted forms of the OEM keys
+			const struct { EKeyboardKeyCode key; char normal; char shifted; } OEM_KEYS[] = {
+				{ EKeyboardKeyCode::Semi_Colon, ';', ':' },
+				{ EKeyboardKeyCode::Plus, '=', '+' },
+				{ EKeyboardKeyCode::Comma, ',', '<' },
+				{ EKeyboardKeyCode::Minus, '-', '_' },
+				{ EKeyboardKeyCode::Period, '.', '>' },
+				{ EKeyboardKeyCode::Slash_Forward, '/', '?' },
+				{ EKeyboardKeyCode::Slash_Backward, '\\', '|' },
+				{ EKeyboardKeyCode::Tilde, '`', '~' },
+				{ EKeyboardKeyCode::Square_Left, '[', '{' },
+				{ EKeyboardKeyCode::Square_Right, ']', '}' },
+				{ EKeyboardKeyCode::Quote, '\'', '"' }
+			};
+
+			//Get the integral key value
+			const int KEY = (int)pKey;
+
+			//Check the character ranges
+			if (KEY >= (int)EKeyboardKeyCode::A && KEY <= (int)EKeyboardKeyCode::Z) return (SHIFT != CAPS ? KEY : tolower(KEY));
+			else if (KEY >= (int)EKeyboardKeyCode::Num0 && KEY <= (int)EKeyboardKeyCode::Num9) return (SHIFT ? SHIFTED_DIGITS[KEY - (int)EKeyboardKeyCode::Num0] : KEY);
+			else if (KEY >= (int)EKeyboardKeyCode::Num_Pad0 && KEY <= (int)EKeyboardKeyCode::Num_Pad9) return (NUM ? '0' + KEY - (int)EKeyboardKeyCode::Num_Pad0 : 0);
+
+			//Check the individual keys
+			switch (pKey) {
+			case EKeyboardKeyCode::Space: return ' ';
+			case EKeyboardKeyCode::Num_Pad_Multiply: return '*';
+			case EKeyboardKeyCode::Num_Pad_Add: return '+';
+			case EKeyboardKeyCode::Num_Pad_Subtract: return '-';
+			case EKeyboardKeyCode::Num_Pad_Decimal: return (NUM ? '.' : 0);
+			case EKeyboardKeyCode::Num_Pad_Divide: return '/';
+			default: break;
+			}
+
+			//Check the OEM keys
+			for (const auto& oem : OEM_KEYS) {
+				if (oem.key == pKey) return (SHIFT ? oem.shifted : oem.normal);
+			}
+
+			//No character is produced
+			return 0;
+		}
+	#endif
 	}
 }
\ No newline at end of file
@@ -74,6 +74,7 @@ namespace SDL2_Engine {
 
 			//! Math Operators
 			Num_Pad_Multiply = 0x6A,
+			Num_Pad_Add = 0x6B,
 			Num_Pad_Subtract = 0x6D,
 			Num_Pad_Decimal = 0x6E,
 			Num_Pad_Divide = 0x6F,
@@ -1,10 +1,14 @@
 #include "Mouse.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "../../Utilities/Portability.hpp"
+
 //! Include the SDL2_Engine objects
 #include "../../Globals.hpp"
 #include "../../Time.hpp"
 #include "../../Resources/ResourceTypes/LocalResourceCursor.hpp"
 #include "../../Window/Window.hpp"
+#include "../InputRecorder.hpp"
 
 //! Include the SDL objects
 #include <SDL.h>
@@ -195,22 +199,35 @@ namespace SDL2_Engine {
 		/*
 			Window : update - Update the position values and cursor values of the mouse
 			Created: 06/10/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 		*/
 		void Mouse::update() {
-			//Check that the Window has focus
-			if (!Globals::get<Window>().hasProperty(EWindowProperties::Focus)) return;
+			//Get the Input Recorder (if there is one)
+			InputRecorder* recorder = (Globals::interfaceExists<InputRecorder>() ? &Globals::get<InputRecorder>() : nullptr);
+			const bool REPLAYING = (recorder && recorder->isReplaying());
+
+			//Check that the Window has focus, replays don't rely on the device
+			if (!REPLAYING && !Globals::get<Window>().hasProperty(EWindowProperties::Focus)) return;
 
 			//Save the old mouse values
 			memcpy_s(mData->mousePoints[STATE_PRE], sizeof(int) * AXIS_TOTAL, mData->mousePoints[STATE_CUR], sizeof(int) * AXIS_TOTAL);
 			memcpy_s(mData->mouseStates[STATE_PRE], sizeof(bool) * BTN_TOTAL, mData->mouseStates[STATE_CUR], sizeof(bool) * BTN_TOTAL);
 
-			//Update the mouse coordinates
-			int btnMask = SDL_GetMouseState(&mData->mousePoints[STATE_CUR][AXIS_X], &mData->mousePoints[STATE_CUR][AXIS_Y]);
+			//Read the current mouse state from the replay
+			if (REPLAYING) recorder->syncMouse(mData->mousePoints[STATE_CUR], mData->mouseStates[STATE_CUR], BTN_TOTAL);
 
-			//Update the current key states
-			for (size_t i = 0; i < BTN_TOTAL; i++) 
-				mData->mouseStates[STATE_CUR][i] = (btnMask & (1 << i) ? true : false);
+			//Otherwise poll the device
+			else {
+				//Update the mouse coordinates
+				int btnMask = SDL_GetMouseState(&mData->mousePoints[STATE_CUR][AXIS_X], &mData->mousePoints[STATE_CUR][AXIS_Y]);
+
+				//Update the current key states
+				for (size_t i = 0; i < BTN_TOTAL; i++) 
+					mData->mouseStates[STATE_CUR][i] = (btnMask & (1 << i) ? true : false);
+
+				//Record the state
+				if (recorder) recorder->syncMouse(mData->mousePoints[STATE_CUR], mData->mouseStates[STATE_CUR], BTN_TOTAL);
+			}
 
 			//Check if there is a cursor assigned
 			if (mData->cursor) {
@@ -12,7 +12,7 @@ namespace SDL2_Engine {
 
 			return EInputDevice - Returns an EInputDevice value representing the passed in String value or EInputDevice::Null if not recognised
 		*/
-		EInputDevice SDL2_Engine::Input::stringToInputType(const compareStr& pString) {
+		EInputDevice stringToInputType(const compareStr& pString) {
 			//Convert the String to lowercase
 			const compareStr CMP = pString.toLower();
 
@@ -127,7 +127,7 @@ namespace SDL2_Engine {
 			stringToKeyboardKey - Convert a String value to a corresponding Keyboard Key
 			Author: Mitchell Croft
 			Created: 06/11/2017
-			Modified: 06/11/2017
+			Modified: 16/10/2026
 
 			param[in] pString - The String value to be converted to an EKeyboardKeyCode value
 
@@ -193,6 +193,7 @@ namespace SDL2_Engine {
 			else if (CMP == "arrow_right")		return EKeyboardKeyCode::Arrow_Right;
 
 			else if (CMP == "num_pad_multiply") return EKeyboardKeyCode::Num_Pad_Multiply;
+			else if (CMP == "num_pad_add")		return EKeyboardKeyCode::Num_Pad_Add;
 			else if (CMP == "num_pad_subtract") return EKeyboardKeyCode::Num_Pad_Subtract;
 			else if (CMP == "num_pad_decimal")	return EKeyboardKeyCode::Num_Pad_Decimal;
 			else if (CMP == "num_pad_divide")	return EKeyboardKeyCode::Num_Pad_Divide;
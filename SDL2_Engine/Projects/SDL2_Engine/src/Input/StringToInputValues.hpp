@@ -14,7 +14,7 @@
 namespace SDL2_Engine {
 	namespace Input {
 		//! Export the required FString implementation
-		template class SDL2_LIB_INC Utilities::FString<INPUT_COMPARE_STRING_MAX>;
+		SDL2_LIB_TEMPLATE(Utilities::FString<INPUT_COMPARE_STRING_MAX>);
 
 		//! Create a type define for the compare String
 		typedef Utilities::FString<INPUT_COMPARE_STRING_MAX> compareStr;
@@ -1,5 +1,8 @@
 #include "VirtualAxis.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "../Utilities/Portability.hpp"
+
 //! Include memory manipulation functionality
 #include <string.h>
 
@@ -14,7 +14,7 @@ namespace SDL2_Engine {
 		 *		Name: VirtualAxis
 		 *		Author: Mitchell Croft
 		 *		Created: 30/01/2017
-		 *		Modified: 13/10/2017
+		 *		Modified: 16/10/2026
 		 *
 		 *		Purpose:
 		 *		Store value used to monitor a named virtual axis across either
@@ -40,14 +40,14 @@ namespace SDL2_Engine {
 			//! Flags if the input values should be inverted
 			bool invert = false;
 
+			//! Store the GamePads to check the input values from (Kept outside of the union as Bitmask is not trivially constructible)
+			Utilities::Bitmask<EGamePadID> gamePads;
+
 			union {
 				/////////////////////////////////////////////////////////////////////////////////////////////////////
 				////////----------------------------------GamePad Values-------------------------------------////////
 				/////////////////////////////////////////////////////////////////////////////////////////////////////
 				struct {
-					//! Store the GamePads to check the input values from
-					Utilities::Bitmask<EGamePadID> gamePads;
-
 					//! Store the GamePds input type 
 					EGamePadInputType gamePadInputType;
 
@@ -14,7 +14,7 @@ namespace SDL2_Engine {
 		/*
 			BasicSceneRenderer : drawTexture - Render a texture using passed in values
 			Created: 09/10/2017
-			Modified: 09/10/2017
+			Modified: 16/10/2026
 
 			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 			param[in] pTexture - A pointer to the SDL_Texture object to render
@@ -26,6 +26,12 @@ namespace SDL2_Engine {
 			param[in] pFlip - The SDL_RendererFlip value defining if the image should be flipped in any way (Default SDL_FLIP_NONE)
 		*/
 		void BasicSceneRenderer::drawTexture(SDL_Renderer*& pRenderer, SDL_Texture*& pTexture, const SDL_Rect& pPosition, const SDL_Rect* pClip /*= nullptr*/, const Colour& pFilter /*= Colour::White*/, const double& pAngle /*= 0.0*/, const SDL_Point* pPivot /*= nullptr*/, const int& pFlip /*= 0*/) {
+			//Count the command and the state changes it requires
+			++mStats.commands;
+			++mStats.drawCalls;
+			if (pFilter.ID != ~0U) mStats.stateChanges += 2;
+			if (pFilter.a != 255U) mStats.stateChanges += 2;
+
 			//Check Colour filtering information
 			if (pFilter.ID != ~0U && SDL_SetTextureColorMod(pTexture, pFilter.r, pFilter.g, pFilter.b)) 
 				Globals::get<Debug::Logger>().logWarning("BasicSceneRenderer failed to apply the texture colour filter during a drawTexture(...) call. Error: %s", SDL_GetError());
@@ -46,7 +52,7 @@ namespace SDL2_Engine {
 		/*
 			BasicSceneRenderer : drawLine - Render a line using passed in values
 			Created: 09/10/2017
-			Modified: 09/10/2017
+			Modified: 16/10/2026
 
 			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 			param[in] pFrom - An SDL_Point defining the starting position of the line
@@ -54,6 +60,11 @@ namespace SDL2_Engine {
 			param[in] pColour - A Colour object defining the colour to draw the line in (Default Black)
 		*/
 		void BasicSceneRenderer::drawLine(SDL_Renderer*& pRenderer, const SDL_Point& pFrom, const SDL_Point& pTo, const Colour& pColour /*= Colour::Black*/) {
+			//Count the command
+			++mStats.commands;
+			++mStats.drawCalls;
+			++mStats.stateChanges;
+
 			//Set the Renderers draw colour
 			if (SDL_SetRenderDrawColor(pRenderer, pColour.r, pColour.g, pColour.b, pColour.a))
 				Globals::get<Debug::Logger>().logWarning("BasicSceneRenderer failed to apply the colour during a drawLine(...) call. Error: %s", SDL_GetError());
@@ -66,7 +77,7 @@ namespace SDL2_Engine {
 		/*
 			BasicSceneRenderer : drawRect - Render a uniform area using passed in values
 			Created: 09/10/2017
-			Modified: 09/10/2017
+			Modified: 16/10/2026
 
 			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 			param[in] pPosition - An SDL_Rect object defining where the image is to be rendered
@@ -81,6 +92,11 @@ namespace SDL2_Engine {
 			//Check if the rendering is finished
 			if (pFill && !pBorderColour) return;
 
+			//Count the outline (fills are counted by drawTexture)
+			if (!pFill) ++mStats.commands;
+			++mStats.drawCalls;
+			++mStats.stateChanges;
+
 			//Store the colour to render on the outline
 			Colour border = (pFill ? *pBorderColour : pColour);
 
@@ -96,7 +112,7 @@ namespace SDL2_Engine {
 		/*
 			BasicSceneRenderer : drawText - Render text using the passed in values
 			Created: 09/10/2017
-			Modified: 02/11/2017
+			Modified: 16/10/2026
 
 			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 			param[in] pText - A c-string defining the text to render
@@ -105,61 +121,64 @@ namespace SDL2_Engine {
 			param[in] pColour - A Colour object defining what colour the text should rendered in (Default Black)
 			param[in] pAlignment - An ETextAlignment value defining if the text should be aligned a specific way (Default Null)
 			param[in] pRenderType - An ETextRenderType value defining how the text should be rendered (Default Solid)
+			param[in] pCacheMode - An ETextCacheMode value defining how the rendered text should be cached (Default Glyphs)
 		*/
-		void BasicSceneRenderer::drawText(SDL_Renderer*& pRenderer, const char*& pText, _TTF_Font*& pFont, const SDL_Point& pPosition, const Colour& pColour /*= Colour::Black*/, const ETextAlignment& pAlignment /*= ETextAlignment::Null*/, const ETextRenderType& pRenderType /*= ETextRenderType::Solid*/) {
-			//Render the text to an SDL_Surface
-			SDL_Surface* tempSurface = nullptr;
-
-			//Switch on the render type
-			switch (pRenderType) {
-			case ETextRenderType::Blended:
-				tempSurface = TTF_RenderUTF8_Blended(pFont, pText, { pColour.r, pColour.g, pColour.b, pColour.a });
-				break;
-			default: // Solid
-				tempSurface = TTF_RenderUTF8_Solid(pFont, pText, { pColour.r, pColour.g, pColour.b, pColour.a });
-				break;
-			}
-
-			//Check for error
-			if (!tempSurface) {
-				//Output error
-				Globals::get<Debug::Logger>().logError("BasicSceneRenderer failed to render text '%s' to a surface with the type %i during a drawText(...) call. Error: %s", pText, (int)pRenderType, SDL_GetError());
-				return;
-			}
-
-			//Convert the Surface to a Texture
-			SDL_Texture* textTex = SDL_CreateTextureFromSurface(pRenderer, tempSurface);
-
-			//Check for error
-			if (!textTex) {
-				//Output error
-				Globals::get<Debug::Logger>().logError("BasicSceneRenderer failed to convert temporary SDL_Surface to a Texture during a drawText(...) call. Error: %s", SDL_GetError());
-
-				//Free the temp surface
-				SDL_FreeSurface(tempSurface);
-				return;
-			}
+		void BasicSceneRenderer::drawText(SDL_Renderer*& pRenderer, const char*& pText, _TTF_Font*& pFont, const SDL_Point& pPosition, const Colour& pColour /*= Colour::Black*/, const ETextAlignment& pAlignment /*= ETextAlignment::Null*/, const ETextRenderType& pRenderType /*= ETextRenderType::Solid*/, const ETextCacheMode& pCacheMode /*= ETextCacheMode::Glyphs*/) {
+			//Check there is text to render
+			if (!pText || !*pText) return;
 
-			//Free the temp surface
-			SDL_FreeSurface(tempSurface);
-
-			//Set the blending mode on the texture
-			if (SDL_SetTextureBlendMode(textTex, SDL_BLENDMODE_BLEND))
-				Globals::get<Debug::Logger>().logWarning("BasicSceneRenderer failed to set the Blend Mode of the texture containing the text '%s' during a drawText(...) call. Error: %s", pText, SDL_GetError());
+			//Count the command
+			++mStats.commands;
 
 			//Create a Rect to store the position and dimensions
 			SDL_Rect pos = { pPosition.x, pPosition.y };
 
-			//Get sizing information for the Texture
-			if (SDL_QueryTexture(textTex, nullptr, nullptr, &pos.w, &pos.h)) {
-				//Output error
-				Globals::get<Debug::Logger>().logError("BasicSceneRenderer failed to get sizing information on the rendered string '%s' during a drawText(...) call. Error: %s", pText, SDL_GetError());
-
-				//Destroy the texture
-				SDL_DestroyTexture(textTex);
-				return;
+			//Check if the text can be drawn from the glyph atlas
+			if (pCacheMode == ETextCacheMode::Glyphs) {
+				//Retrieve the atlas for the font
+				const GlyphAtlas* atlas = mTextCache.getAtlas(pRenderer, pFont, pRenderType);
+
+				//Measure the text, strings containing characters outside of the atlas fall back to the string cache
+				int left;
+				if (atlas && atlas->measure(pText, pos.w, left)) {
+					//Get the height of the text
+					pos.h = atlas->height;
+
+					//Position the text
+					switch (pAlignment) {
+					case ETextAlignment::Center:
+						pos.x -= pos.w / 2;
+						pos.y -= pos.h / 2;
+						break;
+					case ETextAlignment::Right:
+						pos.x += pos.w;
+						break;
+					default: break;
+					}
+
+					//Apply the colour of the text to the atlas
+					mStats.stateChanges += 2;
+					if (SDL_SetTextureColorMod(atlas->texture, pColour.r, pColour.g, pColour.b) || SDL_SetTextureAlphaMod(atlas->texture, pColour.a))
+						Globals::get<Debug::Logger>().logWarning("BasicSceneRenderer failed to apply the text colour to the glyph atlas during a drawText(...) call. Error: %s", SDL_GetError());
+
+					//Draw each of the glyphs
+					atlas->layout(pText, pos.x - left, pos.y, [&](const GlyphAtlas::Glyph& pGlyph, const int& pX, const int& pY) {
+						const SDL_Rect src = { pGlyph.x, pGlyph.y, pGlyph.w, pGlyph.h };
+						const SDL_Rect dst = { pX, pY, pGlyph.w, pGlyph.h };
+						++mStats.drawCalls;
+						if (SDL_RenderCopy(pRenderer, atlas->texture, &src, &dst))
+							Globals::get<Debug::Logger>().logError("BasicSceneRenderer failed to render a glyph of the text '%s' during a drawText(...) call. Error: %s", pText, SDL_GetError());
+					});
+					return;
+				}
 			}
 
+			//Retrieve the texture of the whole string
+			SDL_Texture* textTex = mTextCache.getString(pRenderer, pText, pFont, pColour, pRenderType, pos.w, pos.h);
+
+			//Check for error
+			if (!textTex) return;
+
 			//Position the text
 			switch (pAlignment) {
 			case ETextAlignment::Center:
@@ -171,24 +190,32 @@ namespace SDL2_Engine {
 				break;
 			}
 
-			//Check for transparency
-			if (pColour.a != 255 && SDL_SetTextureAlphaMod(textTex, pColour.a))
-				Globals::get<Debug::Logger>().logWarning("BasicSceneRenderer failed to apply the texture alpha modification during a drawText(...) call. Error: %s", SDL_GetError());
-
 			//Draw the Text
-			if (SDL_RenderCopyEx(pRenderer, textTex, nullptr, &pos, 0.0, nullptr, SDL_FLIP_NONE))
+			++mStats.drawCalls;
+			if (SDL_RenderCopy(pRenderer, textTex, nullptr, &pos))
 				Globals::get<Debug::Logger>().logError("BasicSceneRenderer failed to render the texture containing the text '%s' during a drawText(...) call. Error: %s", pText, SDL_GetError());
+		}
+
+		/*
+			BasicSceneRenderer : presentFrame - Store the counters of the completed frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
 
-			//Destroy the texture
-			SDL_DestroyTexture(textTex);
+			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+		*/
+		void BasicSceneRenderer::presentFrame(SDL_Renderer*& /*pRenderer*/) {
+			mFrameStats = mStats;
+			mStats = RenderStats();
 		}
 
 		/*
 			BasicSceneRenderer : Default Constructor - Initialise with default values
 			Created: 09/10/2017
-			Modified: 09/10/2017
+			Modified: 16/10/2026
+
+			param[in] pTextCacheSize - The number of whole string textures to retain between frames (Default 128)
 		*/
-		BasicSceneRenderer::BasicSceneRenderer() : mBlank(nullptr) {}
+		BasicSceneRenderer::BasicSceneRenderer(const size_t& pTextCacheSize /*= 128*/) : mBlank(nullptr), mTextCache(pTextCacheSize) {}
 
 		/*
 			BasicSceneRenderer : createRenderer - Setup the Scene Renderer
@@ -260,9 +287,12 @@ namespace SDL2_Engine {
 		/*
 			BasicSceneRenderer : destroyRenderer - Free memory and resources for the Scene Renderer
 			Created: 09/10/2017
-			Modified: 09/10/2017
+			Modified: 16/10/2026
 		*/
 		void BasicSceneRenderer::destroyRenderer() {
+			//Destroy the cached text
+			mTextCache.clear();
+
 			//Check if the Blank Texture exists
 			if (mBlank) {
 				//Destroy the texture
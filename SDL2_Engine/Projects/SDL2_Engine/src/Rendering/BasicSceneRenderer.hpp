@@ -2,6 +2,7 @@
 
 //! Include the SDL2_Engine objects
 #include "ISceneRenderer.hpp"
+#include "TextCache.hpp"
 
 namespace SDL2_Engine {
 	namespace Rendering {
@@ -9,10 +10,15 @@ namespace SDL2_Engine {
 		 *		Name: BasicSceneRenderer
 		 *		Author: Mitchell Croft
 		 *		Created: 09/10/2017
-		 *		Modified: 02/11/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Provide basic rendering functionality
+		 *		
+		 *		Notes:
+		 *		Text is drawn from a glyph atlas per font (ETextCacheMode::Glyphs) or from a 
+		 *		least recently used cache of whole string textures (ETextCacheMode::String),
+		 *		so no surfaces or textures are created for text that has been drawn before
 		**/
 		class SDL2_LIB_INC BasicSceneRenderer : public ISceneRenderer {
 		public:
@@ -23,7 +29,7 @@ namespace SDL2_Engine {
 			/*
 				BasicSceneRenderer : drawTexture - Render a texture using passed in values
 				Created: 09/10/2017
-				Modified: 09/10/2017
+				Modified: 16/10/2026
 
 				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 				param[in] pTexture - A pointer to the SDL_Texture object to render
@@ -46,7 +52,7 @@ namespace SDL2_Engine {
 			/*
 				BasicSceneRenderer : drawLine - Render a line using passed in values
 				Created: 09/10/2017
-				Modified: 09/10/2017
+				Modified: 16/10/2026
 
 				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 				param[in] pFrom - An SDL_Point defining the starting position of the line
@@ -61,7 +67,7 @@ namespace SDL2_Engine {
 			/*
 				BasicSceneRenderer : drawRect - Render a uniform area using passed in values
 				Created: 09/10/2017
-				Modified: 09/10/2017
+				Modified: 16/10/2026
 
 				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 				param[in] pPosition - An SDL_Rect object defining where the image is to be rendered
@@ -78,7 +84,7 @@ namespace SDL2_Engine {
 			/*
 				BasicSceneRenderer : drawText - Render text using the passed in values
 				Created: 09/10/2017
-				Modified: 02/11/2017
+				Modified: 16/10/2026
 
 				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 				param[in] pText - A c-string defining the text to render
@@ -87,6 +93,7 @@ namespace SDL2_Engine {
 				param[in] pColour - A Colour object defining what colour the text should rendered in (Default Black)
 				param[in] pAlignment - An ETextAlignment value defining if the text should be aligned a specific way (Default Null)
 				param[in] pRenderType - An ETextRenderType value defining how the text should be rendered (Default Solid)
+				param[in] pCacheMode - An ETextCacheMode value defining how the rendered text should be cached (Default Glyphs)
 			*/
 			virtual void drawText(SDL_Renderer*& pRenderer,
 								  const char*& pText,
@@ -94,7 +101,43 @@ namespace SDL2_Engine {
 								  const SDL_Point& pPosition,
 								  const Colour& pColour = Colour::Black,
 								  const ETextAlignment& pAlignment = ETextAlignment::Null,
-								  const ETextRenderType& pRenderType = ETextRenderType::Solid) override;
+								  const ETextRenderType& pRenderType = ETextRenderType::Solid,
+								  const ETextCacheMode& pCacheMode = ETextCacheMode::Glyphs) override;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-----------------------------------Frame Management----------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				BasicSceneRenderer : presentFrame - Store the counters of the completed frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+			*/
+			virtual void presentFrame(SDL_Renderer*& pRenderer) override;
+
+			/*
+				BasicSceneRenderer : getFrameStats - Retrieve the counters describing the last presented frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return RenderStats - Returns the statistics of the last frame
+			*/
+			inline virtual RenderStats getFrameStats() const override { return mFrameStats; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-----------------------------------Cache Accessors-----------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				BasicSceneRenderer : getTextCache - Retrieve the cache used to store rendered text
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return TextCache& - Returns a reference to the internal Text Cache
+			*/
+			inline TextCache& getTextCache() { return mTextCache; }
 
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////-------------------------------Construction/Destruction------------------------------////////
@@ -103,9 +146,11 @@ namespace SDL2_Engine {
 			/*
 				BasicSceneRenderer : Default Constructor - Initialise with default values
 				Created: 09/10/2017
-				Modified: 09/10/2017
+				Modified: 16/10/2026
+
+				param[in] pTextCacheSize - The number of whole string textures to retain between frames (Default 128)
 			*/
-			BasicSceneRenderer();
+			BasicSceneRenderer(const size_t& pTextCacheSize = 128);
 
 			/*
 				BasicSceneRenderer : createRenderer - Setup the Scene Renderer
@@ -121,13 +166,19 @@ namespace SDL2_Engine {
 			/*
 				BasicSceneRenderer : destroyRenderer - Free memory and resources for the Scene Renderer
 				Created: 09/10/2017
-				Modified: 09/10/2017
+				Modified: 16/10/2026
 			*/
 			virtual void destroyRenderer() override;
 
 		private:
 			//! Store a blank texture to be used to render filled rectangles
 			SDL_Texture* mBlank;
+
+			//! Store the rasterised text that is reused between frames
+			TextCache mTextCache;
+
+			//! Store the counters for the current and last presented frames
+			RenderStats mStats, mFrameStats;
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,649 @@
+#include "BatchedSceneRenderer.hpp"
+
+//! Include the SDL2_Engine values
+#include "../Globals.hpp"
+#include "../Debug/Logger.hpp"
+
+//! Include the SDL objects
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+//! Include the required STL objects
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+namespace SDL2_Engine {
+	namespace Rendering {
+		//! Flag the different types of commands that can be queued
+		enum class EDrawCommandType : unsigned char { Texture, FillRect, OutlineRect, Line };
+
+		//! Flag that a command or batch has no following command
+		static const int NO_COMMAND = -1;
+
+		/*
+		 *		Name: DrawCommand
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the values required to submit a single queued draw call
+		**/
+		struct DrawCommand {
+			//! The type of draw call to submit
+			EDrawCommandType type;
+
+			//! The layer the command was queued on
+			int layer;
+
+			//! The texture to render (Texture commands only)
+			SDL_Texture* texture;
+
+			//! The colour to render with (texture modulation for Texture commands)
+			colourID colour;
+
+			//! The destination area (Lines store the end point in w and h)
+			SDL_Rect dest;
+
+			//! The area of the texture to render
+			SDL_Rect clip;
+			bool hasClip;
+
+			//! The rotation values of the texture
+			double angle;
+			SDL_Point pivot;
+			bool hasPivot;
+			int flip;
+
+			//! The screen area that is affected by the command
+			SDL_Rect bounds;
+
+			//! The index of the next command in the same batch
+			int next;
+		};
+
+		/*
+		 *		Name: DrawBatch
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store a run of commands that can be submitted with the same render state
+		**/
+		struct DrawBatch {
+			//! The state shared by every command in the batch
+			EDrawCommandType type;
+			SDL_Texture* texture;
+			colourID colour;
+
+			//! The combined screen area of every command in the batch
+			SDL_Rect bounds;
+
+			//! The first and last commands in the batch
+			int first, last;
+
+			//! The number of commands in the batch
+			unsigned int count;
+		};
+
+		/*
+		 *		Name: BatchedSceneRendererInternalData
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store internal Batched Scene Renderer data values
+		 *
+		 *		Notes:
+		 *		The containers are cleared rather than released each frame so that
+		 *		their storage is reused once the queue has reached its working size
+		**/
+		struct BatchedSceneRenderer::BatchedSceneRendererInternalData {
+			//! Store the commands queued for the current frame
+			std::vector<DrawCommand> commands;
+
+			//! Store the order that the commands are batched in
+			std::vector<int> order;
+
+			//! Store the batches built for the current frame
+			std::vector<DrawBatch> batches;
+
+			//! Store the rectangles of a batch being submitted
+			std::vector<SDL_Rect> rects;
+
+			//! Store the layer that commands are being queued on
+			int layer = 0;
+
+			//! Store the number of preceding batches a command may be merged into
+			size_t lookback;
+
+			//! Store the rasterised text, retained until the end of each frame
+			TextCache textCache;
+
+			//! Store the counters for the current and last presented frames
+			RenderStats stats, frameStats;
+
+			//! Initialise the text cache with the requested size
+			BatchedSceneRendererInternalData(const size_t& pTextCacheSize) : textCache(pTextCacheSize, true) {}
+		};
+
+		/*
+			intersects - Check if two screen areas overlap
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pA - The first area to check
+			param[in] pB - The second area to check
+
+			return bool - Returns true if the areas overlap
+		*/
+		static inline bool intersects(const SDL_Rect& pA, const SDL_Rect& pB) {
+			return (pA.x < pB.x + pB.w && pB.x < pA.x + pA.w &&
+					pA.y < pB.y + pB.h && pB.y < pA.y + pA.h);
+		}
+
+		/*
+			expand - Expand a screen area to contain another
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in/out] pArea - The area to expand
+			param[in] pOther - The area that must be contained
+		*/
+		static inline void expand(SDL_Rect& pArea, const SDL_Rect& pOther) {
+			const int right = std::max(pArea.x + pArea.w, pOther.x + pOther.w);
+			const int bottom = std::max(pArea.y + pArea.h, pOther.y + pOther.h);
+			pArea.x = std::min(pArea.x, pOther.x);
+			pArea.y = std::min(pArea.y, pOther.y);
+			pArea.w = right - pArea.x;
+			pArea.h = bottom - pArea.y;
+		}
+
+		/*
+			calculateBounds - Determine the screen area affected by a command
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in/out] pCommand - The command to calculate the bounds of
+		*/
+		static void calculateBounds(DrawCommand& pCommand) {
+			switch (pCommand.type) {
+			case EDrawCommandType::Line:
+				pCommand.bounds.x = std::min(pCommand.dest.x, pCommand.dest.w);
+				pCommand.bounds.y = std::min(pCommand.dest.y, pCommand.dest.h);
+				pCommand.bounds.w = std::abs(pCommand.dest.w - pCommand.dest.x) + 1;
+				pCommand.bounds.h = std::abs(pCommand.dest.h - pCommand.dest.y) + 1;
+				return;
+			case EDrawCommandType::Texture:
+				if (pCommand.angle != 0.0) {
+					//Get the point the texture is rotated around
+					const double px = pCommand.dest.x + (pCommand.hasPivot ? pCommand.pivot.x : pCommand.dest.w * 0.5);
+					const double py = pCommand.dest.y + (pCommand.hasPivot ? pCommand.pivot.y : pCommand.dest.h * 0.5);
+					const double rad = pCommand.angle * M_PI / 180.0;
+					const double c = std::cos(rad), s = std::sin(rad);
+
+					//Rotate the corners of the destination
+					double minX = px, minY = py, maxX = px, maxY = py;
+					for (int i = 0; i < 4; i++) {
+						const double cx = pCommand.dest.x + (i & 1 ? pCommand.dest.w : 0) - px;
+						const double cy = pCommand.dest.y + (i & 2 ? pCommand.dest.h : 0) - py;
+						const double rx = px + cx * c - cy * s;
+						const double ry = py + cx * s + cy * c;
+						minX = std::min(minX, rx); maxX = std::max(maxX, rx);
+						minY = std::min(minY, ry); maxY = std::max(maxY, ry);
+					}
+
+					//Store the area with a pixel of margin for rounding
+					pCommand.bounds.x = (int)std::floor(minX) - 1;
+					pCommand.bounds.y = (int)std::floor(minY) - 1;
+					pCommand.bounds.w = (int)std::ceil(maxX) - pCommand.bounds.x + 2;
+					pCommand.bounds.h = (int)std::ceil(maxY) - pCommand.bounds.y + 2;
+				}
+				else pCommand.bounds = pCommand.dest;
+				return;
+			default:
+				pCommand.bounds = pCommand.dest;
+				return;
+			}
+		}
+
+		/*
+			queueCommand - Initialise a new command at the end of the queue
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pCommands - The queue of commands to add to
+			param[in] pType - The type of command being queued
+			param[in] pLayer - The layer the command is being queued on
+			param[in] pColour - The colour that the command is rendered with
+			param[in] pDest - The destination area of the command
+
+			return DrawCommand& - Returns a reference to the new command
+		*/
+		static DrawCommand& queueCommand(std::vector<DrawCommand>& pCommands, const EDrawCommandType& pType, const int& pLayer, const colourID& pColour, const SDL_Rect& pDest) {
+			pCommands.emplace_back();
+			DrawCommand& command = pCommands.back();
+			command.type = pType;
+			command.layer = pLayer;
+			command.texture = nullptr;
+			command.colour = pColour;
+			command.dest = pDest;
+			command.hasClip = false;
+			command.angle = 0.0;
+			command.hasPivot = false;
+			command.flip = 0;
+			command.next = NO_COMMAND;
+			return command;
+		}
+
+		/*
+			BatchedSceneRenderer : drawTexture - Queue a texture to be rendered using passed in values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+			param[in] pTexture - A pointer to the SDL_Texture object to render
+			param[in] pPosition - An SDL_Rect object defining where the image is to be rendered
+			param[in] pClip - A pointer to an SDL_Rect defining a section of the texture to render (Default nullptr)
+			param[in] pFilter - A Colour object defining the filter to be applied to the rendered image (Default White)
+			param[in] pAngle - A double value defining the rotation amount in degrees (Default 0)
+			param[in] pPivot - A pointer to an SDL_Point object defining the pivot point for the rotation (Default nullptr)
+			param[in] pFlip - The SDL_RendererFlip value defining if the image should be flipped in any way (Default SDL_FLIP_NONE)
+		*/
+		void BatchedSceneRenderer::drawTexture(SDL_Renderer*& /*pRenderer*/, SDL_Texture*& pTexture, const SDL_Rect& pPosition, const SDL_Rect* pClip /*= nullptr*/, const Colour& pFilter /*= Colour::White*/, const double& pAngle /*= 0.0*/, const SDL_Point* pPivot /*= nullptr*/, const int& pFlip /*= 0*/) {
+			//Check there is something to render
+			if (!pTexture) return;
+			++mData->stats.commands;
+
+			//Queue the command
+			DrawCommand& command = queueCommand(mData->commands, EDrawCommandType::Texture, mData->layer, pFilter.ID, pPosition);
+			command.texture = pTexture;
+			if (pClip) { command.clip = *pClip; command.hasClip = true; }
+			command.angle = pAngle;
+			if (pPivot) { command.pivot = *pPivot; command.hasPivot = true; }
+			command.flip = pFlip;
+			calculateBounds(command);
+		}
+
+		/*
+			BatchedSceneRenderer : drawLine - Queue a line to be rendered using passed in values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+			param[in] pFrom - An SDL_Point defining the starting position of the line
+			param[in] pTo - An SDL_Point defining the end position of the line
+			param[in] pColour - A Colour object defining the colour to draw the line in (Default Black)
+		*/
+		void BatchedSceneRenderer::drawLine(SDL_Renderer*& /*pRenderer*/, const SDL_Point& pFrom, const SDL_Point& pTo, const Colour& pColour /*= Colour::Black*/) {
+			++mData->stats.commands;
+			calculateBounds(queueCommand(mData->commands, EDrawCommandType::Line, mData->layer, pColour.ID, { pFrom.x, pFrom.y, pTo.x, pTo.y }));
+		}
+
+		/*
+			BatchedSceneRenderer : drawRect - Queue a uniform area to be rendered using passed in values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+			param[in] pPosition - An SDL_Rect object defining where the image is to be rendered
+			param[in] pColour - A Colour object defining the colour to render the outline in or render the fill if pFill is true
+			param[in] pFill - A boolean flag indicating if the Rectangle should be filled in (Default false)
+			param[in] pBorderColour - A pointer to a Colour object to render the outline of the area if pFill is true (Default nullptr)
+		*/
+		void BatchedSceneRenderer::drawRect(SDL_Renderer*& /*pRenderer*/, const SDL_Rect& pPosition, const Colour& pColour, const bool& pFill /*= false*/, const Colour* pBorderColour /*= nullptr*/) {
+			//Check if the rectangle should be filled in
+			if (pFill) {
+				calculateBounds(queueCommand(mData->commands, EDrawCommandType::FillRect, mData->layer, pColour.ID, pPosition));
+				++mData->stats.commands;
+			}
+
+			//Check if the rendering is finished
+			if (pFill && !pBorderColour) return;
+
+			//Queue the outline
+			++mData->stats.commands;
+			calculateBounds(queueCommand(mData->commands, EDrawCommandType::OutlineRect, mData->layer, (pFill ? pBorderColour->ID : pColour.ID), pPosition));
+		}
+
+		/*
+			BatchedSceneRenderer : drawText - Queue text to be rendered using the passed in values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+			param[in] pText - A c-string defining the text to render
+			param[in] pFont - An SDL_Font to be used to render the Text
+			param[in] pPosition - An SDL_Point defining where the text should be rendered
+			param[in] pColour - A Colour object defining what colour the text should rendered in (Default Black)
+			param[in] pAlignment - An ETextAlignment value defining if the text should be aligned a specific way (Default Null)
+			param[in] pRenderType - An ETextRenderType value defining how the text should be rendered (Default Solid)
+			param[in] pCacheMode - An ETextCacheMode value defining how the rendered text should be cached (Default Glyphs)
+		*/
+		void BatchedSceneRenderer::drawText(SDL_Renderer*& pRenderer, const char*& pText, _TTF_Font*& pFont, const SDL_Point& pPosition, const Colour& pColour /*= Colour::Black*/, const ETextAlignment& pAlignment /*= ETextAlignment::Null*/, const ETextRenderType& pRenderType /*= ETextRenderType::Solid*/, const ETextCacheMode& pCacheMode /*= ETextCacheMode::Glyphs*/) {
+			//Check there is text to render
+			if (!pText || !*pText) return;
+			++mData->stats.commands;
+
+			//Create a Rect to store the position and dimensions
+			SDL_Rect pos = { pPosition.x, pPosition.y, 0, 0 };
+
+			//Check if the text can be drawn from the glyph atlas
+			if (pCacheMode == ETextCacheMode::Glyphs) {
+				//Retrieve the atlas for the font
+				const GlyphAtlas* atlas = mData->textCache.getAtlas(pRenderer, pFont, pRenderType);
+
+				//Measure the text, strings containing characters outside of the atlas fall back to the string cache
+				int left;
+				if (atlas && atlas->measure(pText, pos.w, left)) {
+					//Get the height of the text
+					pos.h = atlas->height;
+
+					//Position the text
+					switch (pAlignment) {
+					case ETextAlignment::Center:
+						pos.x -= pos.w / 2;
+						pos.y -= pos.h / 2;
+						break;
+					case ETextAlignment::Right:
+						pos.x += pos.w;
+						break;
+					default: break;
+					}
+
+					//Queue each of the glyphs, tinted with the colour of the text
+					atlas->layout(pText, pos.x - left, pos.y, [&](const GlyphAtlas::Glyph& pGlyph, const int& pX, const int& pY) {
+						DrawCommand& command = queueCommand(mData->commands, EDrawCommandType::Texture, mData->layer, pColour.ID, { pX, pY, pGlyph.w, pGlyph.h });
+						command.texture = atlas->texture;
+						command.clip = { pGlyph.x, pGlyph.y, pGlyph.w, pGlyph.h };
+						command.hasClip = true;
+						command.bounds = command.dest;
+					});
+					return;
+				}
+			}
+
+			//Retrieve the texture of the whole string
+			SDL_Texture* textTex = mData->textCache.getString(pRenderer, pText, pFont, pColour, pRenderType, pos.w, pos.h);
+
+			//Check for error
+			if (!textTex) return;
+
+			//Position the text
+			switch (pAlignment) {
+			case ETextAlignment::Center:
+				pos.x -= pos.w / 2;
+				pos.y -= pos.h / 2;
+				break;
+			case ETextAlignment::Right:
+				pos.x += pos.w;
+				break;
+			default: break;
+			}
+
+			//Queue the texture, the string is already coloured so only its alpha is modulated
+			DrawCommand& command = queueCommand(mData->commands, EDrawCommandType::Texture, mData->layer, Colour(255U, 255U, 255U, pColour.a).ID, pos);
+			command.texture = textTex;
+			command.bounds = command.dest;
+		}
+
+		/*
+			BatchedSceneRenderer : flush - Sort, batch and submit the queued draw commands
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+		*/
+		void BatchedSceneRenderer::flush(SDL_Renderer*& pRenderer) {
+			//Check there is work to submit
+			if (mData->commands.empty()) return;
+
+			//Get shorthand references to the containers
+			std::vector<DrawCommand>& commands = mData->commands;
+			std::vector<int>& order = mData->order;
+			std::vector<DrawBatch>& batches = mData->batches;
+			RenderStats& stats = mData->stats;
+
+			//Order the commands by layer, preserving submission order within a layer
+			order.resize(commands.size());
+			for (size_t i = 0; i < order.size(); i++) order[i] = (int)i;
+			const auto byLayer = [&](const int& pA, const int& pB) { return commands[pA].layer < commands[pB].layer; };
+			if (!std::is_sorted(order.begin(), order.end(), byLayer))
+				std::stable_sort(order.begin(), order.end(), byLayer);
+
+			//Merge each command into the closest batch that shares its state without being obscured
+			batches.clear();
+			for (const int& index : order) {
+				const DrawCommand& command = commands[index];
+
+				//Search the preceding batches
+				DrawBatch* target = nullptr;
+				const size_t limit = (batches.size() > mData->lookback ? batches.size() - mData->lookback : 0);
+				for (size_t i = batches.size(); i > limit; i--) {
+					DrawBatch& batch = batches[i - 1];
+
+					//Check if the batch shares the state of the command
+					if (batch.type == command.type && batch.texture == command.texture && batch.colour == command.colour) {
+						target = &batch;
+						break;
+					}
+
+					//Commands can't be moved in front of something they overlap
+					if (intersects(batch.bounds, command.bounds)) break;
+				}
+
+				//Add the command to the batch
+				if (target) {
+					commands[target->last].next = index;
+					target->last = index;
+					++target->count;
+					expand(target->bounds, command.bounds);
+				}
+
+				//Start a new batch
+				else batches.push_back({ command.type, command.texture, command.colour, command.bounds, index, index, 1U });
+			}
+
+			//Track the render state to avoid redundant changes
+			bool colourSet = false;
+			colourID drawColour = 0;
+			int drawBlend = -1;
+
+			//Submit the batches
+			for (const DrawBatch& batch : batches) {
+				const Colour colour = batch.colour;
+
+				//Textures apply their colour through modulation
+				if (batch.type == EDrawCommandType::Texture) {
+					//Apply the colour modulation if the texture doesn't already have it
+					Uint8 r, g, b, a;
+					if (SDL_GetTextureColorMod(batch.texture, &r, &g, &b) || r != colour.r || g != colour.g || b != colour.b) {
+						++stats.stateChanges;
+						if (SDL_SetTextureColorMod(batch.texture, colour.r, colour.g, colour.b))
+							Globals::get<Debug::Logger>().logWarning("BatchedSceneRenderer failed to apply the texture colour filter during a presentFrame(...) call. Error: %s", SDL_GetError());
+					}
+					if (SDL_GetTextureAlphaMod(batch.texture, &a) || a != colour.a) {
+						++stats.stateChanges;
+						if (SDL_SetTextureAlphaMod(batch.texture, colour.a))
+							Globals::get<Debug::Logger>().logWarning("BatchedSceneRenderer failed to apply the texture alpha modification during a presentFrame(...) call. Error: %s", SDL_GetError());
+					}
+
+					//Draw each of the textures
+					for (int i = batch.first; i != NO_COMMAND; i = commands[i].next) {
+						const DrawCommand& command = commands[i];
+						const SDL_Rect* clip = (command.hasClip ? &command.clip : nullptr);
+						++stats.drawCalls;
+						if (command.angle == 0.0 && !command.flip ?
+							SDL_RenderCopy(pRenderer, command.texture, clip, &command.dest) :
+							SDL_RenderCopyEx(pRenderer, command.texture, clip, &command.dest, command.angle, (command.hasPivot ? &command.pivot : nullptr), (SDL_RendererFlip)command.flip))
+							Globals::get<Debug::Logger>().logError("BatchedSceneRenderer failed to render a Texture during a presentFrame(...) call. Error %s", SDL_GetError());
+					}
+					continue;
+				}
+
+				//Fills are blended the same as the textured fills of the BasicSceneRenderer, outlines and lines are not
+				const SDL_BlendMode blend = (batch.type == EDrawCommandType::FillRect ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+				if (blend != (SDL_BlendMode)drawBlend) {
+					++stats.stateChanges;
+					if (SDL_SetRenderDrawBlendMode(pRenderer, blend))
+						Globals::get<Debug::Logger>().logWarning("BatchedSceneRenderer failed to apply the draw blend mode during a presentFrame(...) call. Error: %s", SDL_GetError());
+					drawBlend = blend;
+				}
+
+				//Apply the draw colour
+				if (!colourSet || drawColour != batch.colour) {
+					++stats.stateChanges;
+					if (SDL_SetRenderDrawColor(pRenderer, colour.r, colour.g, colour.b, colour.a))
+						Globals::get<Debug::Logger>().logWarning("BatchedSceneRenderer failed to apply the draw colour during a presentFrame(...) call. Error: %s", SDL_GetError());
+					drawColour = batch.colour;
+					colourSet = true;
+				}
+
+				//Lines are drawn individually
+				if (batch.type == EDrawCommandType::Line) {
+					for (int i = batch.first; i != NO_COMMAND; i = commands[i].next) {
+						const SDL_Rect& line = commands[i].dest;
+						++stats.drawCalls;
+						if (SDL_RenderDrawLine(pRenderer, line.x, line.y, line.w, line.h))
+							Globals::get<Debug::Logger>().logError("BatchedSceneRenderer failed to render a line during a presentFrame(...) call. Error: %s", SDL_GetError());
+					}
+					continue;
+				}
+
+				//Gather the rectangles of the batch
+				mData->rects.clear();
+				for (int i = batch.first; i != NO_COMMAND; i = commands[i].next)
+					mData->rects.push_back(commands[i].dest);
+
+				//Submit the rectangles in a single call
+				++stats.drawCalls;
+				if (batch.type == EDrawCommandType::FillRect ?
+					SDL_RenderFillRects(pRenderer, mData->rects.data(), (int)mData->rects.size()) :
+					SDL_RenderDrawRects(pRenderer, mData->rects.data(), (int)mData->rects.size()))
+					Globals::get<Debug::Logger>().logError("BatchedSceneRenderer failed to render a batch of %u rectangles during a presentFrame(...) call. Error: %s", batch.count, SDL_GetError());
+			}
+
+			//Restore the default draw blend mode
+			if (drawBlend > SDL_BLENDMODE_NONE) {
+				++stats.stateChanges;
+				SDL_SetRenderDrawBlendMode(pRenderer, SDL_BLENDMODE_NONE);
+			}
+
+			//Clear the queue
+			commands.clear();
+		}
+
+		/*
+			BatchedSceneRenderer : presentFrame - Submit the queued draw commands and store the counters of the completed frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+		*/
+		void BatchedSceneRenderer::presentFrame(SDL_Renderer*& pRenderer) {
+			//Submit the outstanding commands
+			flush(pRenderer);
+
+			//Allow the text used this frame to be evicted
+			mData->textCache.endFrame();
+
+			//Store the counters for the frame
+			mData->frameStats = mData->stats;
+			mData->stats = RenderStats();
+		}
+
+		/*
+			BatchedSceneRenderer : getFrameStats - Retrieve the counters describing the last presented frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return RenderStats - Returns the statistics of the last frame
+		*/
+		RenderStats BatchedSceneRenderer::getFrameStats() const { return mData->frameStats; }
+
+		/*
+			BatchedSceneRenderer : setLayer - Set the layer that subsequent draw commands are queued on
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pLayer - The layer value, lower layers are rendered first (Default 0)
+		*/
+		void BatchedSceneRenderer::setLayer(const int& pLayer) { mData->layer = pLayer; }
+
+		/*
+			BatchedSceneRenderer : getLayer - Get the layer that draw commands are being queued on
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const int& - Returns a constant reference to the current layer
+		*/
+		const int& BatchedSceneRenderer::getLayer() const { return mData->layer; }
+
+		/*
+			BatchedSceneRenderer : getTextCache - Retrieve the cache used to store rendered text
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return TextCache& - Returns a reference to the internal Text Cache
+		*/
+		TextCache& BatchedSceneRenderer::getTextCache() { return mData->textCache; }
+
+		/*
+			BatchedSceneRenderer : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pTextCacheSize - The number of whole string textures to retain between frames (Default 128)
+			param[in] pLookback - The number of preceding batches a command may be merged into (Default 16)
+		*/
+		BatchedSceneRenderer::BatchedSceneRenderer(const size_t& pTextCacheSize /*= 128*/, const size_t& pLookback /*= 16*/) : mData(nullptr) {
+			//Create the internal data object
+			mData = new BatchedSceneRendererInternalData(pTextCacheSize);
+
+			//Store the lookback limit
+			mData->lookback = (pLookback ? pLookback : 1);
+		}
+
+		/*
+			BatchedSceneRenderer : Destructor - Free the internal data
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		BatchedSceneRenderer::~BatchedSceneRenderer() { delete mData; }
+
+		/*
+			BatchedSceneRenderer : createRenderer - Setup the Scene Renderer
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL_Renderer object to allow for the creation of default textures
+
+			return bool - Returns true if the Scene Renderer was created successfully
+		*/
+		bool BatchedSceneRenderer::createRenderer(SDL_Renderer*& /*pRenderer*/) {
+			//Reserve space for a typical frame
+			mData->commands.reserve(1024);
+			mData->order.reserve(1024);
+			mData->batches.reserve(256);
+			mData->rects.reserve(256);
+			return true;
+		}
+
+		/*
+			BatchedSceneRenderer : destroyRenderer - Free memory and resources for the Scene Renderer
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void BatchedSceneRenderer::destroyRenderer() {
+			//Discard any outstanding commands
+			mData->commands.clear();
+			mData->batches.clear();
+
+			//Destroy the cached text
+			mData->textCache.clear();
+		}
+	}
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+//! Include the SDL2_Engine objects
+#include "ISceneRenderer.hpp"
+#include "TextCache.hpp"
+
+namespace SDL2_Engine {
+	namespace Rendering {
+		/*
+		 *		Name: BatchedSceneRenderer
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Queue the draw commands issued over a frame and submit them when the frame
+		 *		is presented, grouped by layer, texture and colour state so that the number
+		 *		of SDL draw calls and render state changes is kept to a minimum
+		 *
+		 *		Notes:
+		 *		Commands are sorted by layer and then merged into the closest preceding batch
+		 *		that shares their texture and colour, provided no batch in between overlaps
+		 *		them. This keeps the output identical to drawing in submission order.
+		 *
+		 *		Textures passed to the draw functions must remain valid until the frame is
+		 *		presented. Texture colour and alpha modulation is left as it was last applied
+		 *		so that consecutive frames do not need to set it again
+		**/
+		class SDL2_LIB_INC BatchedSceneRenderer : public ISceneRenderer {
+		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------Rendering Functionality-----------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				BatchedSceneRenderer : drawTexture - Queue a texture to be rendered using passed in values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+				param[in] pTexture - A pointer to the SDL_Texture object to render
+				param[in] pPosition - An SDL_Rect object defining where the image is to be rendered
+				param[in] pClip - A pointer to an SDL_Rect defining a section of the texture to render (Default nullptr)
+				param[in] pFilter - A Colour object defining the filter to be applied to the rendered image (Default White)
+				param[in] pAngle - A double value defining the rotation amount in degrees (Default 0)
+				param[in] pPivot - A pointer to an SDL_Point object defining the pivot point for the rotation (Default nullptr)
+				param[in] pFlip - The SDL_RendererFlip value defining if the image should be flipped in any way (Default SDL_FLIP_NONE)
+			*/
+			virtual void drawTexture(SDL_Renderer*& pRenderer,
+									 SDL_Texture*& pTexture,
+									 const SDL_Rect& pPosition,
+									 const SDL_Rect* pClip = nullptr,
+									 const Colour& pFilter = Colour::White,
+									 const double& pAngle = 0.0,
+									 const SDL_Point* pPivot = nullptr,
+									 const int& pFlip = 0) override;
+
+			/*
+				BatchedSceneRenderer : drawLine - Queue a line to be rendered using passed in values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+				param[in] pFrom - An SDL_Point defining the starting position of the line
+				param[in] pTo - An SDL_Point defining the end position of the line
+				param[in] pColour - A Colour object defining the colour to draw the line in (Default Black)
+			*/
+			virtual void drawLine(SDL_Renderer*& pRenderer,
+								  const SDL_Point& pFrom,
+								  const SDL_Point& pTo,
+								  const Colour& pColour = Colour::Black) override;
+
+			/*
+				BatchedSceneRenderer : drawRect - Queue a uniform area to be rendered using passed in values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+				param[in] pPosition - An SDL_Rect object defining where the image is to be rendered
+				param[in] pColour - A Colour object defining the colour to render the outline in or render the fill if pFill is true
+				param[in] pFill - A boolean flag indicating if the Rectangle should be filled in (Default false)
+				param[in] pBorderColour - A pointer to a Colour object to render the outline of the area if pFill is true (Default nullptr)
+			*/
+			virtual void drawRect(SDL_Renderer*& pRenderer,
+								  const SDL_Rect& pPosition,
+								  const Colour& pColour,
+								  const bool& pFill = false,
+								  const Colour* pBorderColour = nullptr) override;
+
+			/*
+				BatchedSceneRenderer : drawText - Queue text to be rendered using the passed in values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+				param[in] pText - A c-string defining the text to render
+				param[in] pFont - An SDL_Font to be used to render the Text
+				param[in] pPosition - An SDL_Point defining where the text should be rendered
+				param[in] pColour - A Colour object defining what colour the text should rendered in (Default Black)
+				param[in] pAlignment - An ETextAlignment value defining if the text should be aligned a specific way (Default Null)
+				param[in] pRenderType - An ETextRenderType value defining how the text should be rendered (Default Solid)
+				param[in] pCacheMode - An ETextCacheMode value defining how the rendered text should be cached (Default Glyphs)
+			*/
+			virtual void drawText(SDL_Renderer*& pRenderer,
+								  const char*& pText,
+								  _TTF_Font*& pFont,
+								  const SDL_Point& pPosition,
+								  const Colour& pColour = Colour::Black,
+								  const ETextAlignment& pAlignment = ETextAlignment::Null,
+								  const ETextRenderType& pRenderType = ETextRenderType::Solid,
+								  const ETextCacheMode& pCacheMode = ETextCacheMode::Glyphs) override;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-------------------------------------Frame Management--------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				BatchedSceneRenderer : flush - Sort, batch and submit the queued draw commands
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+			*/
+			virtual void flush(SDL_Renderer*& pRenderer) override;
+
+			/*
+				BatchedSceneRenderer : presentFrame - Submit the queued draw commands and store the counters of the completed frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+			*/
+			virtual void presentFrame(SDL_Renderer*& pRenderer) override;
+
+			/*
+				BatchedSceneRenderer : getFrameStats - Retrieve the counters describing the last presented frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return RenderStats - Returns the statistics of the last frame
+			*/
+			virtual RenderStats getFrameStats() const override;
+
+			/*
+				BatchedSceneRenderer : setLayer - Set the layer that subsequent draw commands are queued on
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pLayer - The layer value, lower layers are rendered first (Default 0)
+			*/
+			void setLayer(const int& pLayer);
+
+			/*
+				BatchedSceneRenderer : getLayer - Get the layer that draw commands are being queued on
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const int& - Returns a constant reference to the current layer
+			*/
+			const int& getLayer() const;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-------------------------------------Cache Accessors---------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				BatchedSceneRenderer : getTextCache - Retrieve the cache used to store rendered text
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return TextCache& - Returns a reference to the internal Text Cache
+			*/
+			TextCache& getTextCache();
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------Construction/Destruction----------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				BatchedSceneRenderer : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pTextCacheSize - The number of whole string textures to retain between frames (Default 128)
+				param[in] pLookback - The number of preceding batches a command may be merged into (Default 16)
+			*/
+			BatchedSceneRenderer(const size_t& pTextCacheSize = 128, const size_t& pLookback = 16);
+
+			/*
+				BatchedSceneRenderer : Destructor - Free the internal data
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			~BatchedSceneRenderer();
+
+			/*
+				BatchedSceneRenderer : createRenderer - Setup the Scene Renderer
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL_Renderer object to allow for the creation of default textures
+
+				return bool - Returns true if the Scene Renderer was created successfully
+			*/
+			virtual bool createRenderer(SDL_Renderer*& pRenderer) override;
+
+			/*
+				BatchedSceneRenderer : destroyRenderer - Free memory and resources for the Scene Renderer
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			virtual void destroyRenderer() override;
+
+			//! Prevent copying of the Scene Renderer
+			BatchedSceneRenderer(const BatchedSceneRenderer&) = delete;
+			BatchedSceneRenderer& operator=(const BatchedSceneRenderer&) = delete;
+
+		private:
+			//! Define the internal protected elements for the Batched Scene Renderer
+			struct BatchedSceneRendererInternalData;
+			BatchedSceneRendererInternalData* mData;
+		};
+	}
+}
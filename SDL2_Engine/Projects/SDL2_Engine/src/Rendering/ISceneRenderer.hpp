@@ -18,7 +18,7 @@ namespace SDL2_Engine {
 		 *		Name: ISceneRenderer
 		 *		Author: Mitchell Croft
 		 *		Created: 09/10/2017
-		 *		Modified: 09/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Provide basic implementation interfaces for Scene Renderers to implement
@@ -87,7 +87,7 @@ namespace SDL2_Engine {
 			/*
 				ISceneRenderer : drawText - Render text using the passed in values
 				Created: 09/10/2017
-				Modified: 09/10/2017
+				Modified: 16/10/2026
 
 				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
 				param[in] pText - A c-string defining the text to render
@@ -96,6 +96,7 @@ namespace SDL2_Engine {
 				param[in] pColour - A Colour object defining what colour the text should rendered in (Default Black)
 				param[in] pAlignment - An ETextAlignment value defining if the text should be aligned a specific way (Default Null)
 				param[in] pRenderType - An ETextRenderType value defining how the text should be rendered (Default Solid)
+				param[in] pCacheMode - An ETextCacheMode value defining how the rendered text should be cached (Default Glyphs)
 			*/
 			virtual void drawText(SDL_Renderer*& pRenderer,
 								  const char*& pText,
@@ -103,7 +104,46 @@ namespace SDL2_Engine {
 								  const SDL_Point& pPosition,
 								  const Colour& pColour = Colour::Black,
 								  const ETextAlignment& pAlignment = ETextAlignment::Null,
-								  const ETextRenderType& pRenderType = ETextRenderType::Solid) = 0;
+								  const ETextRenderType& pRenderType = ETextRenderType::Solid,
+								  const ETextCacheMode& pCacheMode = ETextCacheMode::Glyphs) = 0;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-------------------------------------Frame Management--------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				ISceneRenderer : flush - Called by the Renderer before the render target or clip area is changed
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+
+				NOTE:
+				Scene Renderers that defer drawing must submit the outstanding work so that it is drawn to the
+				target it was issued for. Unlike presentFrame, this does not mark the end of the frame
+			*/
+			inline virtual void flush(SDL_Renderer*& /*pRenderer*/) {}
+
+			/*
+				ISceneRenderer : presentFrame - Called by the Renderer before the current frame is presented
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object to be used to draw graphics to the screen
+
+				NOTE:
+				Scene Renderers that defer drawing must submit all outstanding work during this call
+			*/
+			inline virtual void presentFrame(SDL_Renderer*& /*pRenderer*/) {}
+
+			/*
+				ISceneRenderer : getFrameStats - Retrieve the counters describing the last presented frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return RenderStats - Returns the statistics of the last frame (Empty if the Scene Renderer doesn't track them)
+			*/
+			inline virtual RenderStats getFrameStats() const { return RenderStats(); }
 
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////-------------------------------Construction/Destruction------------------------------////////
@@ -0,0 +1,269 @@
+#include "RenderLayer.hpp"
+
+//! Include the SDL2_Engine values
+#include "Renderer.hpp"
+#include "../Globals.hpp"
+#include "../Debug/Logger.hpp"
+
+//! Include the SDL objects
+#include <SDL.h>
+
+//! Include the required STL objects
+#include <vector>
+#include <algorithm>
+
+namespace SDL2_Engine {
+	namespace Rendering {
+		/*
+		 *		Name: RenderLayerInternalData
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the internal data used by the Render Layer
+		**/
+		struct RenderLayer::RenderLayerInternalData {
+			//! Store the dimensions of the chunks the layer is redrawn in
+			int chunkWidth = 1, chunkHeight = 1;
+
+			//! Store the dimensions of the layer
+			int width = 0, height = 0;
+
+			//! Store the number of chunks along each axis
+			int columns = 0, rows = 0;
+
+			//! Store the function used to draw areas of the layer
+			layerDrawFunc draw;
+
+			//! Store the texture the layer is cached in (nullptr if the layer is drawn directly)
+			SDL_Texture* texture = nullptr;
+
+			//! Store the Renderer reset counter the texture contents were drawn for
+			size_t targetResets = 0;
+
+			//! Flag the chunks that need to be redrawn
+			std::vector<bool> dirty;
+
+			//! Store the number of chunks that are flagged
+			size_t dirtyCount = 0;
+		};
+
+		/*
+			RenderLayer : markDirty - Flag the chunks overlapping an area of the layer to be redrawn
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pArea - An SDL_Rect defining the area of the layer (in layer space) that has changed
+		*/
+		void RenderLayer::markDirty(const SDL_Rect& pArea) {
+			//Check there is an area to flag
+			if (pArea.w <= 0 || pArea.h <= 0 || mData->dirty.empty()) return;
+
+			//Get the range of chunks the area overlaps
+			const int LEFT = std::max(pArea.x / mData->chunkWidth, 0);
+			const int TOP = std::max(pArea.y / mData->chunkHeight, 0);
+			const int RIGHT = std::min((pArea.x + pArea.w - 1) / mData->chunkWidth, mData->columns - 1);
+			const int BOTTOM = std::min((pArea.y + pArea.h - 1) / mData->chunkHeight, mData->rows - 1);
+
+			//Flag the chunks
+			for (int y = TOP; y <= BOTTOM; y++) {
+				for (int x = LEFT; x <= RIGHT; x++) {
+					const size_t INDEX = (size_t)(y * mData->columns + x);
+					if (!mData->dirty[INDEX]) {
+						mData->dirty[INDEX] = true;
+						++mData->dirtyCount;
+					}
+				}
+			}
+		}
+
+		/*
+			RenderLayer : markAllDirty - Flag every chunk of the layer to be redrawn
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void RenderLayer::markAllDirty() {
+			mData->dirty.assign(mData->dirty.size(), true);
+			mData->dirtyCount = mData->dirty.size();
+		}
+
+		/*
+			RenderLayer : getDirtyCount - Get the number of chunks waiting to be redrawn
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the number of dirty chunks
+		*/
+		size_t RenderLayer::getDirtyCount() const { return mData->dirtyCount; }
+
+		/*
+			RenderLayer : getChunkCount - Get the number of chunks the layer is divided into
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the number of chunks
+		*/
+		size_t RenderLayer::getChunkCount() const { return mData->dirty.size(); }
+
+		/*
+			RenderLayer : isCached - Check if the layer is being cached in a render target texture
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the layer is cached, false if it is drawn directly
+		*/
+		bool RenderLayer::isCached() const { return (mData->texture != nullptr); }
+
+		/*
+			RenderLayer : draw - Redraw the dirty chunks and render the layer
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPosition - An SDL_Point defining where the top left of the layer should be rendered
+			param[in] pFilter - A Colour object defining the filter to be applied to the layer (Default White)
+		*/
+		void RenderLayer::draw(const SDL_Point& pPosition, const Colour& pFilter) {
+			//Check the layer has been created
+			if (!mData->draw) return;
+
+			//Get the Renderer
+			Renderer& rend = Globals::get<Renderer>();
+
+			//If there is no texture, draw the entire layer directly
+			if (!mData->texture) {
+				mData->draw({ 0, 0, mData->width, mData->height }, pPosition);
+				return;
+			}
+
+			//Check if the contents of the texture have been lost
+			if (mData->targetResets != rend.getTargetResets()) {
+				mData->targetResets = rend.getTargetResets();
+				markAllDirty();
+			}
+
+			//Redraw the dirty chunks
+			if (mData->dirtyCount) {
+				SDL_Renderer* sdlRenderer = rend.getRenderer();
+				bool targeted = true;
+				for (int y = 0; y < mData->rows && targeted; y++) {
+					for (int x = 0; x < mData->columns; x++) {
+						//Check the chunk needs to be drawn
+						const size_t INDEX = (size_t)(y * mData->columns + x);
+						if (!mData->dirty[INDEX]) continue;
+
+						//Get the area of the layer covered by the chunk
+						const SDL_Rect AREA = {
+							x * mData->chunkWidth,
+							y * mData->chunkHeight,
+							std::min(mData->chunkWidth, mData->width - x * mData->chunkWidth),
+							std::min(mData->chunkHeight, mData->height - y * mData->chunkHeight)
+						};
+
+						//Target the chunk, leaving the remaining chunks dirty on failure
+						if (!(targeted = rend.setRenderTarget(mData->texture, &AREA))) break;
+
+						//Clear the previous contents of the chunk
+						SDL_SetRenderDrawBlendMode(sdlRenderer, SDL_BLENDMODE_NONE);
+						SDL_SetRenderDrawColor(sdlRenderer, 0U, 0U, 0U, 0U);
+						SDL_RenderFillRect(sdlRenderer, &AREA);
+
+						//Draw the contents of the chunk
+						mData->draw(AREA, { 0, 0 });
+						mData->dirty[INDEX] = false;
+						--mData->dirtyCount;
+					}
+				}
+
+				//Return to drawing to the Window
+				rend.setRenderTarget(nullptr);
+			}
+
+			//Render the cached layer
+			rend.drawTexture(mData->texture, { pPosition.x, pPosition.y, mData->width, mData->height }, nullptr, pFilter);
+		}
+
+		/*
+			RenderLayer : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		RenderLayer::RenderLayer() : mData(new RenderLayerInternalData()) {}
+
+		/*
+			RenderLayer : Destructor - Free the render target texture
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		RenderLayer::~RenderLayer() {
+			destroy();
+			delete mData;
+		}
+
+		/*
+			RenderLayer : create - Create the render target texture and flag the layer to be drawn
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pWidth - The width of the layer in pixels
+			param[in] pHeight - The height of the layer in pixels
+			param[in] pDraw - The function used to draw areas of the layer
+			param[in] pChunkWidth - The width of the areas the layer is redrawn in (Default 128)
+			param[in] pChunkHeight - The height of the areas the layer is redrawn in (Default 128)
+
+			return bool - Returns true if the layer can be drawn
+		*/
+		bool RenderLayer::create(const int& pWidth, const int& pHeight, const layerDrawFunc& pDraw, const int& pChunkWidth, const int& pChunkHeight) {
+			//Clear the previous layer
+			destroy();
+
+			//Check the values are valid
+			if (pWidth <= 0 || pHeight <= 0 || !pDraw) {
+				Globals::get<Debug::Logger>().logError("Unable to create a RenderLayer of %i x %i%s", pWidth, pHeight, (pDraw ? "" : " without a draw function"));
+				return false;
+			}
+
+			//Store the dimensions
+			mData->chunkWidth = std::max(pChunkWidth, 1);
+			mData->chunkHeight = std::max(pChunkHeight, 1);
+			mData->width = pWidth;
+			mData->height = pHeight;
+			mData->columns = (pWidth + mData->chunkWidth - 1) / mData->chunkWidth;
+			mData->rows = (pHeight + mData->chunkHeight - 1) / mData->chunkHeight;
+			mData->draw = pDraw;
+
+			//Create the texture to cache the layer in
+			Renderer& rend = Globals::get<Renderer>();
+			if (rend.supportsRenderTargets()) {
+				mData->texture = SDL_CreateTexture(rend.getRenderer(), SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, pWidth, pHeight);
+				if (mData->texture) SDL_SetTextureBlendMode(mData->texture, SDL_BLENDMODE_BLEND);
+				else Globals::get<Debug::Logger>().logWarning("RenderLayer failed to create a %i x %i render target, the layer will be drawn directly. Error: %s", pWidth, pHeight, SDL_GetError());
+			}
+
+			//Flag every chunk to be drawn
+			mData->targetResets = rend.getTargetResets();
+			mData->dirty.assign((size_t)(mData->columns * mData->rows), true);
+			mData->dirtyCount = mData->dirty.size();
+			return true;
+		}
+
+		/*
+			RenderLayer : destroy - Free the render target texture and draw function
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void RenderLayer::destroy() {
+			//Free the texture
+			if (mData->texture) {
+				SDL_DestroyTexture(mData->texture);
+				mData->texture = nullptr;
+			}
+
+			//Clear the layer values
+			mData->draw = nullptr;
+			mData->width = mData->height = mData->columns = mData->rows = 0;
+			mData->dirty.clear();
+			mData->dirtyCount = 0;
+		}
+	}
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+//! Include the SDL2_Engine objects
+#include "../__LibraryManagement.hpp"
+#include "Colour.hpp"
+
+//! Include the STL function wrapper used for the draw callback
+#include <functional>
+
+//! Prototype the SDL objects
+struct SDL_Rect;
+struct SDL_Point;
+
+namespace SDL2_Engine {
+	namespace Rendering {
+		//! Export the required std::function implementation
+		SDL2_LIB_TEMPLATE(std::function<void(const SDL_Rect&, const SDL_Point&)>);
+
+		//! Create a type define for the function that draws an area of a Render Layer (The area in layer space and the offset to apply to it)
+		typedef std::function<void(const SDL_Rect&, const SDL_Point&)> layerDrawFunc;
+
+		/*
+		 *		Name: RenderLayer
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Cache rarely changing graphics in a render target texture so that they
+		 *		can be drawn each frame with a single texture draw, redrawing only the
+		 *		chunks of the layer that have been marked as dirty
+		 *
+		 *		Notes:
+		 *		The draw function is called with the area of the layer to draw and the offset
+		 *		to add to the layer space positions. It should draw everything overlapping the
+		 *		area through the Renderer, drawing is clipped to the area.
+		 *
+		 *		If the SDL Renderer doesn't support render targets the draw function is called
+		 *		for the whole layer every time the layer is drawn
+		**/
+		class SDL2_LIB_INC RenderLayer {
+		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////--------------------------------------Dirty Tracking---------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				RenderLayer : markDirty - Flag the chunks overlapping an area of the layer to be redrawn
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pArea - An SDL_Rect defining the area of the layer (in layer space) that has changed
+			*/
+			void markDirty(const SDL_Rect& pArea);
+
+			/*
+				RenderLayer : markAllDirty - Flag every chunk of the layer to be redrawn
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void markAllDirty();
+
+			/*
+				RenderLayer : getDirtyCount - Get the number of chunks waiting to be redrawn
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the number of dirty chunks
+			*/
+			size_t getDirtyCount() const;
+
+			/*
+				RenderLayer : getChunkCount - Get the number of chunks the layer is divided into
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the number of chunks
+			*/
+			size_t getChunkCount() const;
+
+			/*
+				RenderLayer : isCached - Check if the layer is being cached in a render target texture
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return bool - Returns true if the layer is cached, false if it is drawn directly
+			*/
+			bool isCached() const;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-----------------------------------------Drawing-------------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				RenderLayer : draw - Redraw the dirty chunks and render the layer
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pPosition - An SDL_Point defining where the top left of the layer should be rendered
+				param[in] pFilter - A Colour object defining the filter to be applied to the layer (Default White)
+			*/
+			void draw(const SDL_Point& pPosition, const Colour& pFilter = Colour::White);
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------Construction/Destruction----------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				RenderLayer : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			RenderLayer();
+
+			/*
+				RenderLayer : Destructor - Free the render target texture
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			~RenderLayer();
+
+			/*
+				RenderLayer : create - Create the render target texture and flag the layer to be drawn
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pWidth - The width of the layer in pixels
+				param[in] pHeight - The height of the layer in pixels
+				param[in] pDraw - The function used to draw areas of the layer
+				param[in] pChunkWidth - The width of the areas the layer is redrawn in (Default 128)
+				param[in] pChunkHeight - The height of the areas the layer is redrawn in (Default 128)
+
+				return bool - Returns true if the layer can be drawn
+
+				NOTE:
+				The Renderer must exist in the Globals. Failing to create the render target
+				texture isn't an error, the layer will be drawn directly instead
+			*/
+			bool create(const int& pWidth, const int& pHeight, const layerDrawFunc& pDraw, const int& pChunkWidth = 128, const int& pChunkHeight = 128);
+
+			/*
+				RenderLayer : destroy - Free the render target texture and draw function
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void destroy();
+
+			//! Prevent copying of the Render Layer
+			RenderLayer(const RenderLayer&) = delete;
+			RenderLayer& operator=(const RenderLayer&) = delete;
+
+		private:
+			//! Define the internal protected elements for the Render Layer
+			struct RenderLayerInternalData;
+			RenderLayerInternalData* mData;
+		};
+	}
+}
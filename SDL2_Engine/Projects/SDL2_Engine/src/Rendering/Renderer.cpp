@@ -15,7 +15,7 @@ namespace SDL2_Engine {
 		 *		Name: RendererInternalData
 		 *		Author: Mitchell Croft
 		 *		Created: 09/10/2017
-		 *		Modified: 09/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Store the internal data used by the Renderer
@@ -36,6 +36,9 @@ namespace SDL2_Engine {
 				//! Store a pointer to the current SceneRenderer
 				ISceneRenderer* sceneRenderer = nullptr;
 			};
+
+			//! Store the number of times the contents of render targets have been lost
+			size_t targetResets = 0;
 		};
 
 		/*
@@ -85,7 +88,7 @@ namespace SDL2_Engine {
 		/*
 			Renderer : drawText - Render text using the passed in values
 			Created: 09/10/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 
 			param[in] pText - A c-string defining the text to render
 			param[in] pFont - An SDL_Font to be used to render the Text
@@ -93,9 +96,10 @@ namespace SDL2_Engine {
 			param[in] pColour - A Colour object defining what colour the text should rendered in (Default Black)
 			param[in] pAlignment - An ETextAlignment value defining if the text should be aligned a specific way (Default Null)
 			param[in] pRenderType - An ETextRenderType value defining how the text should be rendered (Default Solid)
+			param[in] pCacheMode - An ETextCacheMode value defining how the rendered text should be cached (Default Glyphs)
 		*/
-		void Renderer::drawText(const char* pText, _TTF_Font* pFont, const SDL_Point& pPosition, const Colour& pColour /*= Colour::Black*/, const ETextAlignment& pAlignment /*= ETextAlignment::Null*/, const ETextRenderType& pRenderType /*= ETextRenderType::Solid*/) {
-			mData->sceneRenderer->drawText(mData->renderer, pText, pFont, pPosition, pColour, pAlignment, pRenderType);
+		void Renderer::drawText(const char* pText, _TTF_Font* pFont, const SDL_Point& pPosition, const Colour& pColour /*= Colour::Black*/, const ETextAlignment& pAlignment /*= ETextAlignment::Null*/, const ETextRenderType& pRenderType /*= ETextRenderType::Solid*/, const ETextCacheMode& pCacheMode /*= ETextCacheMode::Glyphs*/) {
+			mData->sceneRenderer->drawText(mData->renderer, pText, pFont, pPosition, pColour, pAlignment, pRenderType, pCacheMode);
 		}
 
 		/*
@@ -110,9 +114,12 @@ namespace SDL2_Engine {
 		/*
 			Renderer : presentFrame - Present the newly rendered elements to the Window
 			Created: 11/10/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 		*/
 		void Renderer::presentFrame() {
+			//Allow the Scene Renderer to submit any deferred work
+			if (mData->sceneRenderer) mData->sceneRenderer->presentFrame(mData->renderer);
+
 			//Display the current frame
 			SDL_RenderPresent(mData->renderer);
 
@@ -121,6 +128,68 @@ namespace SDL2_Engine {
 			SDL_RenderClear(mData->renderer);
 		}
 
+		/*
+			Renderer : supportsRenderTargets - Check if textures can be used as render targets
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if the SDL Renderer supports rendering to textures
+		*/
+		bool Renderer::supportsRenderTargets() const { return (SDL_RenderTargetSupported(mData->renderer) == SDL_TRUE); }
+
+		/*
+			Renderer : setRenderTarget - Change where subsequent draw calls are rendered to
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pTarget - A texture created with SDL_TEXTUREACCESS_TARGET, or nullptr to render to the Window
+			param[in] pClip - A pointer to an SDL_Rect limiting drawing to an area of the target (Default nullptr)
+
+			return bool - Returns true if the target and clip area were applied
+		*/
+		bool Renderer::setRenderTarget(SDL_Texture* pTarget, const SDL_Rect* pClip) {
+			//Submit the work issued for the current target
+			if (mData->sceneRenderer) mData->sceneRenderer->flush(mData->renderer);
+
+			//Apply the new target
+			if (SDL_SetRenderTarget(mData->renderer, pTarget)) {
+				Globals::get<Debug::Logger>().logError("Renderer failed to set the render target. Error: %s", SDL_GetError());
+				return false;
+			}
+
+			//Apply the clip area
+			if (SDL_RenderSetClipRect(mData->renderer, pClip)) {
+				Globals::get<Debug::Logger>().logError("Renderer failed to set the clip area of the render target. Error: %s", SDL_GetError());
+				return false;
+			}
+			return true;
+		}
+
+		/*
+			Renderer : getTargetResets - Get the number of times the contents of render target textures have been lost
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const size_t& - Returns a constant reference to the reset counter
+		*/
+		const size_t& Renderer::getTargetResets() const { return mData->targetResets; }
+
+		/*
+			Renderer : notifyTargetsReset - Record that the contents of render target textures have been lost
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void Renderer::notifyTargetsReset() { ++mData->targetResets; }
+
+		/*
+			Renderer : getFrameStats - Retrieve the draw call and state change counters of the last presented frame
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return RenderStats - Returns the statistics reported by the current Scene Renderer
+		*/
+		RenderStats Renderer::getFrameStats() const { return (mData->sceneRenderer ? mData->sceneRenderer->getFrameStats() : RenderStats()); }
+
 		/*
 			Renderer : Constructor - Initialise with default values
 			Created: 05/10/2017
@@ -4,6 +4,9 @@
 #include "../Utilities/IGlobal.hpp"
 #include "ISceneRenderer.hpp"
 
+//! Include the type trait checks used to validate template types
+#include <type_traits>
+
 //! Prototype the SDL objects
 struct SDL_Window;
 
@@ -16,7 +19,7 @@ namespace SDL2_Engine {
 		 *		Name: Renderer
 		 *		Author: Mitchell Croft
 		 *		Created: 09/10/2017
-		 *		Modified: 11/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Provide a uniform interface for rendering images to the screen 
@@ -80,7 +83,7 @@ namespace SDL2_Engine {
 			/*
 				Renderer : drawText - Render text using the passed in values
 				Created: 09/10/2017
-				Modified: 11/10/2017
+				Modified: 16/10/2026
 
 				param[in] pText - A c-string defining the text to render
 				param[in] pFont - An SDL_Font to be used to render the Text
@@ -88,13 +91,15 @@ namespace SDL2_Engine {
 				param[in] pColour - A Colour object defining what colour the text should rendered in (Default Black)
 				param[in] pAlignment - An ETextAlignment value defining if the text should be aligned a specific way (Default Null)
 				param[in] pRenderType - An ETextRenderType value defining how the text should be rendered (Default Solid)
+				param[in] pCacheMode - An ETextCacheMode value defining how the rendered text should be cached (Default Glyphs)
 			*/
 			void drawText(const char* pText,
 						  _TTF_Font* pFont,
 						  const SDL_Point& pPosition,
 						  const Colour& pColour = Colour::Black,
 						  const ETextAlignment& pAlignment = ETextAlignment::Null,
-						  const ETextRenderType& pRenderType = ETextRenderType::Solid);
+						  const ETextRenderType& pRenderType = ETextRenderType::Solid,
+						  const ETextCacheMode& pCacheMode = ETextCacheMode::Glyphs);
 
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////----------------------------------Rendering Accessors--------------------------------////////
@@ -155,10 +160,64 @@ namespace SDL2_Engine {
 			/*
 				Renderer : presentFrame - Present the newly rendered elements to the Window
 				Created: 11/10/2017
-				Modified: 11/10/2017 
+				Modified: 16/10/2026 
 			*/
 			void presentFrame();
 
+			/*
+				Renderer : supportsRenderTargets - Check if textures can be used as render targets
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return bool - Returns true if the SDL Renderer supports rendering to textures
+			*/
+			bool supportsRenderTargets() const;
+
+			/*
+				Renderer : setRenderTarget - Change where subsequent draw calls are rendered to
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pTarget - A texture created with SDL_TEXTUREACCESS_TARGET, or nullptr to render to the Window
+				param[in] pClip - A pointer to an SDL_Rect limiting drawing to an area of the target (Default nullptr)
+
+				return bool - Returns true if the target and clip area were applied
+
+				NOTE:
+				Draw calls deferred by the Scene Renderer are submitted to the previous target before it is changed.
+				The target must be reset to nullptr before the frame is presented
+			*/
+			bool setRenderTarget(SDL_Texture* pTarget, const SDL_Rect* pClip = nullptr);
+
+			/*
+				Renderer : getTargetResets - Get the number of times the contents of render target textures have been lost
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const size_t& - Returns a constant reference to the reset counter
+			*/
+			const size_t& getTargetResets() const;
+
+			/*
+				Renderer : notifyTargetsReset - Record that the contents of render target textures have been lost
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				NOTE:
+				This is called when SDL reports an SDL_RENDER_TARGETS_RESET event, objects caching
+				graphics in render targets compare the counter to know when to redraw them
+			*/
+			void notifyTargetsReset();
+
+			/*
+				Renderer : getFrameStats - Retrieve the draw call and state change counters of the last presented frame
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return RenderStats - Returns the statistics reported by the current Scene Renderer
+			*/
+			RenderStats getFrameStats() const;
+
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////--------------------------------Construction/Destruction-----------------------------////////
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
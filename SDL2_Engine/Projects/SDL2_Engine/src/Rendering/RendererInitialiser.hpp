@@ -10,7 +10,7 @@ namespace SDL2_Engine {
 	namespace Rendering { class ISceneRenderer; }
 
 	//! Export the required Bitmask implementation
-	template class SDL2_LIB_INC Utilities::Bitmask<Rendering::ERendererProperties>;
+	SDL2_LIB_TEMPLATE(Utilities::Bitmask<Rendering::ERendererProperties>);
 
 	namespace Initialisation {
 		/*
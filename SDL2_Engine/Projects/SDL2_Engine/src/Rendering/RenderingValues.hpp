@@ -15,5 +15,28 @@ namespace SDL2_Engine {
 
 		//! Flag text rendering options 
 		enum class ETextRenderType { Solid, Blended };
+
+		//! Flag how rendered text should be cached between frames (Glyphs for changing text, String for static labels)
+		enum class ETextCacheMode { Glyphs, String };
+
+		/*
+		 *		Name: RenderStats
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *		
+		 *		Purpose:
+		 *		Store counters describing the work a Scene Renderer submitted to SDL over a frame
+		**/
+		struct RenderStats {
+			//! The number of draw functions called on the Scene Renderer
+			unsigned int commands = 0;
+
+			//! The number of SDL draw calls that were issued
+			unsigned int drawCalls = 0;
+
+			//! The number of SDL render state changes (colour, alpha and blend modes) that were issued
+			unsigned int stateChanges = 0;
+		};
 	}
 }
\ No newline at end of file
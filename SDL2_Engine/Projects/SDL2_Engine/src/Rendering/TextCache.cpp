@@ -0,0 +1,568 @@
+#include "TextCache.hpp"
+
+//! Include the SDL2_Engine values
+#include "../Globals.hpp"
+#include "../Debug/Logger.hpp"
+
+//! Include the SDL objects
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+//! Include the required STL objects
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SDL2_Engine {
+	namespace Rendering {
+		//! Define the width that glyph atlases are packed into
+		static const int ATLAS_WIDTH = 512;
+
+		//! Define the padding placed between glyphs in the atlas
+		static const int ATLAS_PADDING = 1;
+
+		/*
+		 *		Name: FontFingerprint
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the properties of a font that affect how it is rasterised, used
+		 *		to identify when a font pointer has been reused by a different font
+		**/
+		struct FontFingerprint {
+			int height = 0, ascent = 0, descent = 0, style = 0, outline = 0, hinting = 0, kerning = 0;
+			std::string family;
+
+			//! Fill the fingerprint with the values of a font
+			inline void fill(_TTF_Font* pFont) {
+				height = TTF_FontHeight(pFont);
+				ascent = TTF_FontAscent(pFont);
+				descent = TTF_FontDescent(pFont);
+				style = TTF_GetFontStyle(pFont);
+				outline = TTF_GetFontOutline(pFont);
+				hinting = TTF_GetFontHinting(pFont);
+				kerning = TTF_GetFontKerning(pFont);
+				const char* name = TTF_FontFaceFamilyName(pFont);
+				family = (name ? name : "");
+			}
+
+			//! Check if the fingerprint matches the values of a font
+			inline bool matches(_TTF_Font* pFont) const {
+				if (height != TTF_FontHeight(pFont) || ascent != TTF_FontAscent(pFont) || descent != TTF_FontDescent(pFont) ||
+					style != TTF_GetFontStyle(pFont) || outline != TTF_GetFontOutline(pFont) || hinting != TTF_GetFontHinting(pFont) ||
+					kerning != TTF_GetFontKerning(pFont)) return false;
+				const char* name = TTF_FontFaceFamilyName(pFont);
+				return !strcmp(family.c_str(), (name ? name : ""));
+			}
+		};
+
+		/*
+		 *		Name: FontRecord
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the cached values associated with a single font
+		**/
+		struct FontRecord {
+			//! The fingerprint of the font that the values were generated for
+			FontFingerprint fingerprint;
+
+			//! Incremented whenever the font pointer is found to belong to a new font
+			unsigned int generation = 0;
+
+			//! The glyph atlases for each of the render types
+			GlyphAtlas* atlases[2] = { nullptr, nullptr };
+		};
+
+		/*
+		 *		Name: StringEntry
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store a single whole string texture in the least recently used cache
+		**/
+		struct StringEntry {
+			size_t hash;
+			_TTF_Font* font;
+			unsigned int generation;
+			colourID colour;
+			ETextRenderType renderType;
+			std::string text;
+			SDL_Texture* texture;
+			int width, height;
+			unsigned int frame;
+		};
+
+		/*
+		 *		Name: TextCacheInternalData
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the internal data used by the Text Cache
+		**/
+		struct TextCache::TextCacheInternalData {
+			//! Store the cached values for each font
+			std::unordered_map<_TTF_Font*, FontRecord> fonts;
+
+			//! Store the string textures in order of use (front is most recent)
+			std::list<StringEntry> strings;
+
+			//! Index the string textures by their hash
+			std::unordered_map<size_t, std::list<StringEntry>::iterator> stringLookup;
+
+			//! Store the textures of replaced entries that were used in the current frame, destroyed at endFrame
+			std::vector<SDL_Texture*> retiredTextures;
+
+			//! Store the maximum number of string textures to retain
+			size_t stringCapacity;
+
+			//! Flag if string textures used in the current frame are protected from eviction
+			bool retainFrame;
+
+			//! Store the current frame number
+			unsigned int frame = 0;
+
+			//! Store the usage statistics
+			TextCacheStats stats;
+		};
+
+		/*
+			hashString - Create a hash code for a whole string cache entry without allocating
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pText - The text of the entry
+			param[in] pFont - The font of the entry
+			param[in] pGeneration - The generation of the font record
+			param[in] pColour - The colour of the entry
+			param[in] pRenderType - The render type of the entry
+
+			return size_t - Returns the combined FNV-1a hash of the values
+		*/
+		static size_t hashString(const char* pText, const _TTF_Font* pFont, const unsigned int& pGeneration, const colourID& pColour, const ETextRenderType& pRenderType) {
+			unsigned long long hash = 14695981039346656037ULL;
+			for (const char* c = pText; *c; c++) hash = (hash ^ (unsigned char)*c) * 1099511628211ULL;
+			hash = (hash ^ (unsigned long long)(size_t)pFont) * 1099511628211ULL;
+			hash = (hash ^ pGeneration) * 1099511628211ULL;
+			hash = (hash ^ pColour) * 1099511628211ULL;
+			hash = (hash ^ (unsigned long long)pRenderType) * 1099511628211ULL;
+			return (size_t)hash;
+		}
+
+		/*
+			destroyAtlas - Free the memory associated with a glyph atlas
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pAtlas - A pointer to the atlas to destroy
+		*/
+		static void destroyAtlas(GlyphAtlas*& pAtlas) {
+			if (!pAtlas) return;
+			if (pAtlas->texture) SDL_DestroyTexture(pAtlas->texture);
+			delete pAtlas;
+			pAtlas = nullptr;
+		}
+
+		/*
+			buildAtlas - Rasterise the printable ASCII glyphs of a font into a single texture
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer used to create the texture
+			param[in] pFont - The font to rasterise
+			param[in] pRenderType - The ETextRenderType value defining how the glyphs are rasterised
+
+			return GlyphAtlas* - Returns a pointer to the new atlas or nullptr on failure
+		*/
+		static GlyphAtlas* buildAtlas(SDL_Renderer* pRenderer, _TTF_Font* pFont, const ETextRenderType& pRenderType) {
+			//Rasterise the glyphs in white so they can be colour modulated
+			const SDL_Color WHITE = { 255U, 255U, 255U, 255U };
+
+			//Create the atlas object
+			GlyphAtlas* atlas = new GlyphAtlas();
+			atlas->height = TTF_FontHeight(pFont);
+
+			//Store the individually rendered glyphs
+			SDL_Surface* surfaces[GlyphAtlas::GLYPH_COUNT] = { nullptr };
+
+			//Track the packing position
+			int penX = 0, penY = 0, atlasW = ATLAS_WIDTH;
+
+			//Render each of the glyphs
+			for (int i = 0; i < GlyphAtlas::GLYPH_COUNT; i++) {
+				//Get the glyph information
+				const Uint16 ch = (Uint16)(GlyphAtlas::FIRST_GLYPH + i);
+				GlyphAtlas::Glyph& glyph = atlas->glyphs[i];
+				glyph = { 0, 0, 0, 0, 0, 0 };
+				int minX, maxX, minY, maxY;
+				if (TTF_GlyphMetrics(pFont, ch, &minX, &maxX, &minY, &maxY, &glyph.advance)) continue;
+
+				//Render the glyph
+				surfaces[i] = (pRenderType == ETextRenderType::Blended ? TTF_RenderGlyph_Blended(pFont, ch, WHITE) : TTF_RenderGlyph_Solid(pFont, ch, WHITE));
+				if (!surfaces[i]) continue;
+
+				//Glyph surfaces begin at the left most pixel of the glyph, which can be behind the pen
+				glyph.offset = (minX < 0 ? minX : 0);
+				glyph.w = surfaces[i]->w;
+				glyph.h = surfaces[i]->h;
+
+				//Ensure the atlas is wide enough to fit the glyph
+				if (glyph.w + ATLAS_PADDING > atlasW) atlasW = glyph.w + ATLAS_PADDING;
+			}
+
+			//Pack the glyphs into rows
+			int rowHeight = 0;
+			for (int i = 0; i < GlyphAtlas::GLYPH_COUNT; i++) {
+				GlyphAtlas::Glyph& glyph = atlas->glyphs[i];
+				if (!surfaces[i]) continue;
+
+				//Move to the next row if there is no space
+				if (penX + glyph.w + ATLAS_PADDING > atlasW) {
+					penX = 0;
+					penY += rowHeight + ATLAS_PADDING;
+					rowHeight = 0;
+				}
+
+				//Assign the location
+				glyph.x = penX;
+				glyph.y = penY;
+				penX += glyph.w + ATLAS_PADDING;
+				if (glyph.h > rowHeight) rowHeight = glyph.h;
+			}
+
+			//Create the surface that will hold all of the glyphs
+			SDL_Surface* atlasSurface = SDL_CreateRGBSurfaceWithFormat(0, atlasW, penY + rowHeight + ATLAS_PADDING, 32, SDL_PIXELFORMAT_RGBA32);
+
+			//Copy the glyphs into the atlas surface
+			if (atlasSurface) {
+				SDL_FillRect(atlasSurface, nullptr, 0U);
+				for (int i = 0; i < GlyphAtlas::GLYPH_COUNT; i++) {
+					if (!surfaces[i]) continue;
+					SDL_Rect dest = { atlas->glyphs[i].x, atlas->glyphs[i].y, atlas->glyphs[i].w, atlas->glyphs[i].h };
+					SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+					SDL_BlitSurface(surfaces[i], nullptr, atlasSurface, &dest);
+				}
+
+				//Upload the atlas
+				atlas->texture = SDL_CreateTextureFromSurface(pRenderer, atlasSurface);
+				SDL_FreeSurface(atlasSurface);
+			}
+
+			//Free the individual glyphs
+			for (int i = 0; i < GlyphAtlas::GLYPH_COUNT; i++)
+				if (surfaces[i]) SDL_FreeSurface(surfaces[i]);
+
+			//Check the atlas texture was created
+			if (!atlas->texture) {
+				Globals::get<Debug::Logger>().logError("TextCache failed to create a glyph atlas texture for a font with the render type %i. Error: %s", (int)pRenderType, SDL_GetError());
+				delete atlas;
+				return nullptr;
+			}
+
+			//Set the blend mode of the atlas
+			if (SDL_SetTextureBlendMode(atlas->texture, SDL_BLENDMODE_BLEND))
+				Globals::get<Debug::Logger>().logWarning("TextCache failed to set the Blend Mode of a glyph atlas texture. Error: %s", SDL_GetError());
+
+			//Build the kerning table
+			const bool useKerning = (TTF_GetFontKerning(pFont) != 0);
+			for (int p = 0; p < GlyphAtlas::GLYPH_COUNT; p++) {
+				for (int c = 0; c < GlyphAtlas::GLYPH_COUNT; c++)
+					atlas->kerning[p][c] = (short)(useKerning ? TTF_GetFontKerningSizeGlyphs(pFont, (Uint16)(GlyphAtlas::FIRST_GLYPH + p), (Uint16)(GlyphAtlas::FIRST_GLYPH + c)) : 0);
+			}
+
+			//Return the completed atlas
+			return atlas;
+		}
+
+		/*
+			validateFont - Retrieve the record for a font, resetting it if the font has changed
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pFonts - The map of font records to search
+			param[in] pFont - The font to retrieve the record for
+
+			return FontRecord& - Returns a reference to the up to date font record
+		*/
+		static FontRecord& validateFont(std::unordered_map<_TTF_Font*, FontRecord>& pFonts, _TTF_Font* pFont) {
+			//Find or insert the record
+			auto it = pFonts.find(pFont);
+			if (it == pFonts.end()) {
+				FontRecord& record = pFonts[pFont];
+				record.fingerprint.fill(pFont);
+				return record;
+			}
+
+			//Check the font pointer still refers to the same font
+			FontRecord& record = it->second;
+			if (!record.fingerprint.matches(pFont)) {
+				destroyAtlas(record.atlases[0]);
+				destroyAtlas(record.atlases[1]);
+				record.fingerprint.fill(pFont);
+				++record.generation;
+			}
+			return record;
+		}
+
+		/*
+			trimStrings - Evict the least recently used string textures until the cache is within capacity
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStrings - The list of string entries, ordered by use
+			param[in] pLookup - The hash lookup of the string entries
+			param[in] pStats - The statistics object to record evictions in
+			param[in] pCapacity - The maximum number of entries to retain
+			param[in] pProtectFrame - The frame number of entries that can't be evicted (~0U for none)
+		*/
+		static void trimStrings(std::list<StringEntry>& pStrings, std::unordered_map<size_t, std::list<StringEntry>::iterator>& pLookup, TextCacheStats& pStats, const size_t& pCapacity, const unsigned int& pProtectFrame) {
+			while (pStrings.size() > pCapacity && pStrings.back().frame != pProtectFrame) {
+				SDL_DestroyTexture(pStrings.back().texture);
+				pLookup.erase(pStrings.back().hash);
+				pStrings.pop_back();
+				++pStats.stringEvictions;
+			}
+		}
+
+		/*
+			TextCache : getAtlas - Retrieve the glyph atlas for a font, rasterising it if required
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object used to create the atlas texture
+			param[in] pFont - The font that the atlas is being requested for
+			param[in] pRenderType - The ETextRenderType value defining how the glyphs are rasterised
+
+			return const GlyphAtlas* - Returns a pointer to the atlas or nullptr if it could not be created
+		*/
+		const GlyphAtlas* TextCache::getAtlas(SDL_Renderer* pRenderer, _TTF_Font* pFont, const ETextRenderType& pRenderType) {
+			//Get the record for the font
+			FontRecord& record = validateFont(mData->fonts, pFont);
+
+			//Get the atlas for the render type
+			GlyphAtlas*& atlas = record.atlases[pRenderType == ETextRenderType::Blended ? 1 : 0];
+
+			//Build the atlas if required
+			if (!atlas) {
+				atlas = buildAtlas(pRenderer, pFont, pRenderType);
+				++mData->stats.atlasBuilds;
+			}
+
+			//Return the atlas
+			return atlas;
+		}
+
+		/*
+			TextCache : getString - Retrieve a texture containing an entire string, rasterising it if required
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL Renderer object used to create the string texture
+			param[in] pText - A c-string defining the text to retrieve
+			param[in] pFont - The font that the text is rendered with
+			param[in] pColour - The Colour that the text is rendered in
+			param[in] pRenderType - The ETextRenderType value defining how the text is rasterised
+			param[out] pWidth - Receives the width of the returned texture
+			param[out] pHeight - Receives the height of the returned texture
+
+			return SDL_Texture* - Returns the cached texture or nullptr if it could not be created
+		*/
+		SDL_Texture* TextCache::getString(SDL_Renderer* pRenderer, const char* pText, _TTF_Font* pFont, const Colour& pColour, const ETextRenderType& pRenderType, int& pWidth, int& pHeight) {
+			//Get the record for the font
+			const FontRecord& record = validateFont(mData->fonts, pFont);
+
+			//Generate the hash for the string
+			const size_t hash = hashString(pText, pFont, record.generation, pColour.ID, pRenderType);
+
+			//Look for an existing entry
+			auto found = mData->stringLookup.find(hash);
+			if (found != mData->stringLookup.end()) {
+				StringEntry& entry = *found->second;
+
+				//Check the entry is a true match
+				if (entry.font == pFont && entry.generation == record.generation && entry.colour == pColour.ID && entry.renderType == pRenderType && !strcmp(entry.text.c_str(), pText)) {
+					//Move the entry to the front of the list
+					mData->strings.splice(mData->strings.begin(), mData->strings, found->second);
+					entry.frame = mData->frame;
+					++mData->stats.stringHits;
+
+					//Return the texture
+					pWidth = entry.width;
+					pHeight = entry.height;
+					return entry.texture;
+				}
+
+				//Otherwise remove the colliding entry, keeping its texture until the end of the frame if it may still be drawn
+				if (mData->retainFrame && entry.frame == mData->frame) mData->retiredTextures.push_back(entry.texture);
+				else SDL_DestroyTexture(entry.texture);
+				mData->strings.erase(found->second);
+				mData->stringLookup.erase(found);
+			}
+
+			//Track the miss
+			++mData->stats.stringMisses;
+
+			//Render the text to an SDL_Surface
+			SDL_Surface* tempSurface = nullptr;
+			switch (pRenderType) {
+			case ETextRenderType::Blended:
+				tempSurface = TTF_RenderUTF8_Blended(pFont, pText, { pColour.r, pColour.g, pColour.b, pColour.a });
+				break;
+			default: // Solid
+				tempSurface = TTF_RenderUTF8_Solid(pFont, pText, { pColour.r, pColour.g, pColour.b, pColour.a });
+				break;
+			}
+
+			//Check for error
+			if (!tempSurface) {
+				Globals::get<Debug::Logger>().logError("TextCache failed to render text '%s' to a surface with the type %i. Error: %s", pText, (int)pRenderType, SDL_GetError());
+				return nullptr;
+			}
+
+			//Convert the Surface to a Texture
+			SDL_Texture* texture = SDL_CreateTextureFromSurface(pRenderer, tempSurface);
+			pWidth = tempSurface->w;
+			pHeight = tempSurface->h;
+			SDL_FreeSurface(tempSurface);
+
+			//Check for error
+			if (!texture) {
+				Globals::get<Debug::Logger>().logError("TextCache failed to convert the SDL_Surface containing the text '%s' to a Texture. Error: %s", pText, SDL_GetError());
+				return nullptr;
+			}
+
+			//Set the blending mode on the texture
+			if (SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND))
+				Globals::get<Debug::Logger>().logWarning("TextCache failed to set the Blend Mode of the texture containing the text '%s'. Error: %s", pText, SDL_GetError());
+
+			//Apply the transparency, as the colour is part of the key this only needs to be done once
+			if (pColour.a != 255 && SDL_SetTextureAlphaMod(texture, pColour.a))
+				Globals::get<Debug::Logger>().logWarning("TextCache failed to apply the alpha modification to the texture containing the text '%s'. Error: %s", pText, SDL_GetError());
+
+			//Store the new entry
+			mData->strings.push_front({ hash, pFont, record.generation, pColour.ID, pRenderType, pText, texture, pWidth, pHeight, mData->frame });
+			mData->stringLookup[hash] = mData->strings.begin();
+
+			//Evict the least recently used entries
+			trimStrings(mData->strings, mData->stringLookup, mData->stats, mData->stringCapacity, (mData->retainFrame ? mData->frame : ~0U));
+
+			//Return the new texture
+			return texture;
+		}
+
+		/*
+			TextCache : getStringCapacity - Get the maximum number of whole string textures that are retained
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const size_t& - Returns a constant reference to the capacity value
+		*/
+		const size_t& TextCache::getStringCapacity() const { return mData->stringCapacity; }
+
+		/*
+			TextCache : setStringCapacity - Set the maximum number of whole string textures that are retained
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pCapacity - The number of string textures to retain (Minimum 1)
+		*/
+		void TextCache::setStringCapacity(const size_t& pCapacity) {
+			//Store the new capacity
+			mData->stringCapacity = (pCapacity ? pCapacity : 1);
+
+			//Evict the entries that no longer fit
+			trimStrings(mData->strings, mData->stringLookup, mData->stats, mData->stringCapacity, (mData->retainFrame ? mData->frame : ~0U));
+		}
+
+		/*
+			TextCache : getStats - Get the counters describing the use of the cache
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const TextCacheStats& - Returns a constant reference to the internal statistics
+		*/
+		const TextCacheStats& TextCache::getStats() const { return mData->stats; }
+
+		/*
+			TextCache : endFrame - Mark the end of a frame, allowing textures used during it to be evicted
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void TextCache::endFrame() {
+			//Move onto the next frame, skipping the value used to flag no protection
+			if (++mData->frame == ~0U) mData->frame = 0;
+
+			//Destroy the textures of the entries replaced during the frame
+			for (SDL_Texture* texture : mData->retiredTextures)
+				SDL_DestroyTexture(texture);
+			mData->retiredTextures.clear();
+
+			//Evict the entries that were retained beyond capacity
+			trimStrings(mData->strings, mData->stringLookup, mData->stats, mData->stringCapacity, ~0U);
+		}
+
+		/*
+			TextCache : clear - Destroy all cached atlases and string textures
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void TextCache::clear() {
+			//Destroy the atlases
+			for (auto& font : mData->fonts) {
+				destroyAtlas(font.second.atlases[0]);
+				destroyAtlas(font.second.atlases[1]);
+			}
+			mData->fonts.clear();
+
+			//Destroy the string textures
+			for (auto& entry : mData->strings)
+				SDL_DestroyTexture(entry.texture);
+			mData->strings.clear();
+			mData->stringLookup.clear();
+
+			//Destroy the textures of replaced entries
+			for (SDL_Texture* texture : mData->retiredTextures)
+				SDL_DestroyTexture(texture);
+			mData->retiredTextures.clear();
+		}
+
+		/*
+			TextCache : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStringCapacity - The maximum number of whole string textures to retain (Default 128)
+			param[in] pRetainFrame - Flags if string textures retrieved during a frame should not be evicted until endFrame is called (Default false)
+		*/
+		TextCache::TextCache(const size_t& pStringCapacity /*= 128*/, const bool& pRetainFrame /*= false*/) : mData(nullptr) {
+			//Create the internal data object
+			mData = new TextCacheInternalData();
+
+			//Store the settings
+			mData->stringCapacity = (pStringCapacity ? pStringCapacity : 1);
+			mData->retainFrame = pRetainFrame;
+		}
+
+		/*
+			TextCache : Destructor - Destroy all cached textures
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		TextCache::~TextCache() {
+			//Free the cached values
+			clear();
+
+			//Delete the internal data
+			delete mData;
+		}
+	}
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+//! Include the SDL2_Engine objects
+#include "../__LibraryManagement.hpp"
+#include "RenderingValues.hpp"
+#include "Colour.hpp"
+
+//! Prototype the SDL objects
+struct SDL_Renderer;
+struct SDL_Texture;
+struct _TTF_Font;
+
+namespace SDL2_Engine {
+	namespace Rendering {
+		/*
+		 *		Name: GlyphAtlas
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store a single texture containing the pre-rasterised printable ASCII
+		 *		glyphs of a font, allowing strings to be drawn as a run of textured
+		 *		quads without any per-frame allocations
+		 *
+		 *		Notes:
+		 *		Glyphs are rasterised in white so that the colour of the text can be
+		 *		applied through the textures colour modulation
+		**/
+		struct SDL2_LIB_INC GlyphAtlas {
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------------Values----------------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			//! Define the range of characters that are rasterised into the atlas
+			enum : int { FIRST_GLYPH = ' ', LAST_GLYPH = '~', GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1 };
+
+			//! Store the location and metrics of a single glyph within the atlas
+			struct Glyph {
+				//! The area of the atlas texture containing the glyph
+				int x, y, w, h;
+
+				//! The horizontal offset from the pen position to draw the glyph at
+				int offset;
+
+				//! The distance the pen moves after drawing the glyph
+				int advance;
+			};
+
+			//! Store the texture containing all of the glyphs
+			SDL_Texture* texture = nullptr;
+
+			//! Store the height of every glyph in the atlas
+			int height = 0;
+
+			//! Store the glyph information for each of the characters
+			Glyph glyphs[GLYPH_COUNT];
+
+			//! Store the kerning offsets between each pair of glyphs [previous][current]
+			short kerning[GLYPH_COUNT][GLYPH_COUNT];
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////--------------------------------------Functions--------------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				GlyphAtlas : measure - Determine the dimensions of a string drawn with the atlas
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pText - A c-string defining the text to measure
+				param[out] pWidth - Receives the total width of the rendered string
+				param[out] pLeft - Receives the offset of the left most pixel from the starting pen position (<= 0)
+
+				return bool - Returns true if every character in the string is contained in the atlas
+			*/
+			inline bool measure(const char* pText, int& pWidth, int& pLeft) const {
+				//Track the extents of the string
+				int pen = 0, left = 0, right = 0, prev = -1;
+				for (const char* c = pText; *c; c++) {
+					//Check the character is stored in the atlas
+					if (*c < FIRST_GLYPH || *c > LAST_GLYPH) return false;
+
+					//Get the glyph
+					const int index = *c - FIRST_GLYPH;
+					const Glyph& glyph = glyphs[index];
+
+					//Apply the kerning
+					if (prev != -1) pen += kerning[prev][index];
+
+					//Expand the extents
+					if (pen + glyph.offset < left) left = pen + glyph.offset;
+					if (pen + glyph.offset + glyph.w > right) right = pen + glyph.offset + glyph.w;
+
+					//Move the pen
+					pen += glyph.advance;
+					prev = index;
+				}
+
+				//Output the dimensions
+				pWidth = right - left;
+				pLeft = left;
+				return true;
+			}
+
+			/*
+				GlyphAtlas : layout - Process each glyph in a string that has been measured with the atlas
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				Template TFunc - The type of the callback, in the form void(const Glyph&, const int&, const int&)
+
+				param[in] pText - A c-string of the text to process (Must have successfully passed measure)
+				param[in] pX - The X position of the starting pen position
+				param[in] pY - The Y position of the top of the text
+				param[in] pEmit - The callback that will receive each glyph along with its screen position
+			*/
+			template<typename TFunc>
+			inline void layout(const char* pText, const int& pX, const int& pY, TFunc&& pEmit) const {
+				int pen = pX, prev = -1;
+				for (const char* c = pText; *c; c++) {
+					//Get the glyph
+					const int index = *c - FIRST_GLYPH;
+					const Glyph& glyph = glyphs[index];
+
+					//Apply the kerning
+					if (prev != -1) pen += kerning[prev][index];
+
+					//Emit the glyph if there is something to draw
+					if (glyph.w && glyph.h) pEmit(glyph, pen + glyph.offset, pY);
+
+					//Move the pen
+					pen += glyph.advance;
+					prev = index;
+				}
+			}
+		};
+
+		/*
+		 *		Name: TextCacheStats
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store counters describing the effectiveness of a Text Cache
+		**/
+		struct SDL2_LIB_INC TextCacheStats {
+			//! The number of glyph atlases that have been rasterised
+			size_t atlasBuilds = 0;
+
+			//! The number of whole string textures found in the cache
+			size_t stringHits = 0;
+
+			//! The number of whole string textures that had to be rasterised
+			size_t stringMisses = 0;
+
+			//! The number of whole string textures that were evicted to make room
+			size_t stringEvictions = 0;
+		};
+
+		/*
+		 *		Name: TextCache
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Retain rasterised text between frames so that Scene Renderers don't have
+		 *		to create and destroy surfaces and textures for every drawText call.
+		 *		Maintains a glyph atlas per font and render type, as well as a least
+		 *		recently used cache of whole string textures for static labels
+		 *
+		 *		Notes:
+		 *		Fonts are identified by their pointer and a fingerprint of their properties,
+		 *		if a font is freed and another loaded in its place the cached values are rebuilt
+		**/
+		class SDL2_LIB_INC TextCache {
+		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-----------------------------------Cache Retrieval-----------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				TextCache : getAtlas - Retrieve the glyph atlas for a font, rasterising it if required
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object used to create the atlas texture
+				param[in] pFont - The font that the atlas is being requested for
+				param[in] pRenderType - The ETextRenderType value defining how the glyphs are rasterised
+
+				return const GlyphAtlas* - Returns a pointer to the atlas or nullptr if it could not be created
+			*/
+			const GlyphAtlas* getAtlas(SDL_Renderer* pRenderer, _TTF_Font* pFont, const ETextRenderType& pRenderType);
+
+			/*
+				TextCache : getString - Retrieve a texture containing an entire string, rasterising it if required
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL Renderer object used to create the string texture
+				param[in] pText - A c-string defining the text to retrieve
+				param[in] pFont - The font that the text is rendered with
+				param[in] pColour - The Colour that the text is rendered in
+				param[in] pRenderType - The ETextRenderType value defining how the text is rasterised
+				param[out] pWidth - Receives the width of the returned texture
+				param[out] pHeight - Receives the height of the returned texture
+
+				return SDL_Texture* - Returns the cached texture or nullptr if it could not be created
+
+				NOTE:
+				The returned texture is owned by the cache. If the cache was created to retain the textures of a
+				frame, it is valid until the next endFrame call. Otherwise it is only valid until the next getString
+				call, which may evict or replace it
+			*/
+			SDL_Texture* getString(SDL_Renderer* pRenderer, const char* pText, _TTF_Font* pFont, const Colour& pColour, const ETextRenderType& pRenderType, int& pWidth, int& pHeight);
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-----------------------------------Cache Management----------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				TextCache : getStringCapacity - Get the maximum number of whole string textures that are retained
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const size_t& - Returns a constant reference to the capacity value
+			*/
+			const size_t& getStringCapacity() const;
+
+			/*
+				TextCache : setStringCapacity - Set the maximum number of whole string textures that are retained
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pCapacity - The number of string textures to retain (Minimum 1)
+			*/
+			void setStringCapacity(const size_t& pCapacity);
+
+			/*
+				TextCache : getStats - Get the counters describing the use of the cache
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const TextCacheStats& - Returns a constant reference to the internal statistics
+			*/
+			const TextCacheStats& getStats() const;
+
+			/*
+				TextCache : endFrame - Mark the end of a frame, allowing textures used during it to be evicted
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void endFrame();
+
+			/*
+				TextCache : clear - Destroy all cached atlases and string textures
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void clear();
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////-------------------------------Construction/Destruction------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				TextCache : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStringCapacity - The maximum number of whole string textures to retain (Default 128)
+				param[in] pRetainFrame - Flags if string textures retrieved during a frame should not be evicted until endFrame is called (Default false)
+			*/
+			TextCache(const size_t& pStringCapacity = 128, const bool& pRetainFrame = false);
+
+			/*
+				TextCache : Destructor - Destroy all cached textures
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			~TextCache();
+
+			//! Prevent copying of the cache
+			TextCache(const TextCache&) = delete;
+			TextCache& operator=(const TextCache&) = delete;
+
+		private:
+			//! Define the internal protected elements for the Text Cache
+			struct TextCacheInternalData;
+			TextCacheInternalData* mData;
+		};
+	}
+}
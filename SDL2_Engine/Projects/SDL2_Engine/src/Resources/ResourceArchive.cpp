@@ -0,0 +1,587 @@
+#include "ResourceArchive.hpp"
+
+//! Include logging capabilities
+#include "../Globals.hpp"
+#include "../Debug/Logger.hpp"
+
+//! Include the SDL2 definitions
+#include <SDL.h>
+
+//! Include the directory navigation functionality
+#include <dirent.h>
+
+//! Include the STL objects used to store the index and share the archive file
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+//! Define the values identifying an archive file ("SRPK" when read as bytes)
+#define ARCHIVE_MAGIC 0x4B505253U
+#define ARCHIVE_VERSION 1U
+
+//! Define the size of the header and each index entry (in bytes)
+#define ARCHIVE_HEADER_SIZE 16U
+#define ARCHIVE_ENTRY_SIZE 32U
+
+//! Define the size of the buffer used to copy files into an archive (in bytes)
+#define PACK_BUFFER_SIZE 65536U
+
+namespace SDL2_Engine {
+	/*
+	 *		Name: ResourceArchiveInternalData
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Store the index of the open archive and the file it is read from
+	**/
+	struct ResourceArchive::ResourceArchiveInternalData {
+		//! Define a single entry of the archive index
+		struct Entry {
+			uint64_t hash;
+			uint64_t offset;
+			uint64_t size;
+			uint32_t nameOffset;
+			uint32_t nameLength;
+		};
+
+		//! Define the archive file, shared with the open entry streams
+		struct SharedFile {
+			//! The stream the archive is read from
+			SDL_RWops* file = nullptr;
+
+			//! Prevent entry streams on different threads from moving the file position during a read
+			std::mutex lock;
+
+			//! Close the archive file once the last user is done with it
+			inline ~SharedFile() { if (file) SDL_RWclose(file); }
+		};
+
+		//! Define the position of an entry stream within the archive
+		struct EntryStream {
+			std::shared_ptr<SharedFile> source;
+			Sint64 offset;
+			Sint64 size;
+			Sint64 position;
+		};
+
+		//! Store the open archive file
+		std::shared_ptr<SharedFile> file;
+
+		//! Store the index entries, sorted by hash
+		std::vector<Entry> entries;
+
+		//! Store the null terminated entry names
+		std::vector<char> names;
+
+		/*
+			ResourceArchiveInternalData : skipCurrentDirectory - Move past any leading "./" in a path
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path to skip the leading characters of
+
+			return const char* - Returns a pointer to the first significant character of the path
+		*/
+		static inline const char* skipCurrentDirectory(const char* pPath) {
+			while (pPath[0] == '.' && (pPath[1] == '/' || pPath[1] == '\\')) pPath += 2;
+			return pPath;
+		}
+
+		/*
+			ResourceArchiveInternalData : nextPathChar - Read the next character of a path in its normalised form
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPos - The position in the path to read from, moved past the characters consumed
+			param[in] pPrev - The previous normalised character, used to merge repeated separators
+
+			return char - Returns the lower case character with separators as '/', or '\0' at the end of the path
+		*/
+		static inline char nextPathChar(const char*& pPos, const char& pPrev) {
+			while (char c = *pPos) {
+				++pPos;
+				if (c == '\\') c = '/';
+				else if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+				if (c != '/' || pPrev != '/') return c;
+			}
+			return '\0';
+		}
+
+		/*
+			ResourceArchiveInternalData : pathsMatch - Check if two paths refer to the same entry
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pFirst - The first path to compare
+			param[in] pSecond - The second path to compare
+
+			return bool - Returns true if the normalised paths are equal
+		*/
+		static bool pathsMatch(const char* pFirst, const char* pSecond) {
+			pFirst = skipCurrentDirectory(pFirst);
+			pSecond = skipCurrentDirectory(pSecond);
+			char first = '\0', second = '\0';
+			do {
+				first = nextPathChar(pFirst, first);
+				second = nextPathChar(pSecond, second);
+				if (first != second) return false;
+			} while (first);
+			return true;
+		}
+
+		/*
+			ResourceArchiveInternalData : find - Find the index entry for a path
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the entry to find
+
+			return const Entry* - Returns a pointer to the entry or nullptr if not found
+		*/
+		const Entry* find(const char* pPath) const {
+			//Check there are entries to search
+			if (!pPath || entries.empty()) return nullptr;
+
+			//Find the first entry with the hash
+			const uint64_t HASH = ResourceArchive::hashPath(pPath);
+			auto it = std::lower_bound(entries.begin(), entries.end(), HASH, [](const Entry& pEntry, const uint64_t& pHash) { return pEntry.hash < pHash; });
+
+			//Compare the names of the entries sharing the hash
+			for (; it != entries.end() && it->hash == HASH; ++it)
+				if (pathsMatch(&names[it->nameOffset], pPath)) return &*it;
+			return nullptr;
+		}
+
+		/*
+			ResourceArchiveInternalData : encodeEntry - Write an index entry in the archive byte order
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pDest - The ARCHIVE_ENTRY_SIZE bytes to write the entry to
+			param[in] pEntry - The entry to write
+		*/
+		static void encodeEntry(Uint8* pDest, const Entry& pEntry) {
+			const Uint64 WIDE[] = { SDL_SwapLE64(pEntry.hash), SDL_SwapLE64(pEntry.offset), SDL_SwapLE64(pEntry.size) };
+			const Uint32 NARROW[] = { SDL_SwapLE32(pEntry.nameOffset), SDL_SwapLE32(pEntry.nameLength) };
+			memcpy(pDest, WIDE, sizeof(WIDE));
+			memcpy(pDest + sizeof(WIDE), NARROW, sizeof(NARROW));
+		}
+
+		/*
+			ResourceArchiveInternalData : decodeEntry - Read an index entry stored in the archive byte order
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSource - The ARCHIVE_ENTRY_SIZE bytes to read the entry from
+
+			return Entry - Returns the entry in the byte order of the machine
+		*/
+		static Entry decodeEntry(const Uint8* pSource) {
+			Uint64 wide[3];
+			Uint32 narrow[2];
+			memcpy(wide, pSource, sizeof(wide));
+			memcpy(narrow, pSource + sizeof(wide), sizeof(narrow));
+			return { SDL_SwapLE64(wide[0]), SDL_SwapLE64(wide[1]), SDL_SwapLE64(wide[2]), SDL_SwapLE32(narrow[0]), SDL_SwapLE32(narrow[1]) };
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////----------------------------------Entry Stream Callbacks-----------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		//! Retrieve the entry stream from an SDL_RWops object
+		static inline EntryStream* getStream(SDL_RWops* pOps) { return (EntryStream*)pOps->hidden.unknown.data1; }
+
+		//! Get the size of the entry
+		static Sint64 SDLCALL streamSize(SDL_RWops* pOps) { return getStream(pOps)->size; }
+
+		//! Move the read position within the entry
+		static Sint64 SDLCALL streamSeek(SDL_RWops* pOps, Sint64 pOffset, int pWhence) {
+			EntryStream* stream = getStream(pOps);
+			Sint64 position;
+			switch (pWhence) {
+			case RW_SEEK_SET: position = pOffset; break;
+			case RW_SEEK_CUR: position = stream->position + pOffset; break;
+			case RW_SEEK_END: position = stream->size + pOffset; break;
+			default: return SDL_SetError("Unknown seek origin %i for a resource archive entry", pWhence);
+			}
+			if (position < 0 || position > stream->size) return SDL_SetError("Attempted to seek outside of a resource archive entry");
+			return (stream->position = position);
+		}
+
+		//! Read objects from the entry, without reading past its end
+		static size_t SDLCALL streamRead(SDL_RWops* pOps, void* pBuffer, size_t pSize, size_t pCount) {
+			//Limit the read to the remaining objects
+			EntryStream* stream = getStream(pOps);
+			if (!pSize) return 0;
+			const size_t COUNT = std::min(pCount, (size_t)(stream->size - stream->position) / pSize);
+			if (!COUNT) return 0;
+
+			//Read from the shared archive file
+			size_t read = 0;
+			{
+				std::lock_guard<std::mutex> guard(stream->source->lock);
+				if (SDL_RWseek(stream->source->file, stream->offset + stream->position, RW_SEEK_SET) < 0) return 0;
+				read = SDL_RWread(stream->source->file, pBuffer, pSize, COUNT);
+			}
+
+			//Advance the position
+			stream->position += (Sint64)(read * pSize);
+			return read;
+		}
+
+		//! Reject writes to the entry
+		static size_t SDLCALL streamWrite(SDL_RWops* /*pOps*/, const void* /*pBuffer*/, size_t /*pSize*/, size_t /*pCount*/) {
+			SDL_SetError("Resource archive entries are read only");
+			return 0;
+		}
+
+		//! Free the entry stream
+		static int SDLCALL streamClose(SDL_RWops* pOps) {
+			delete getStream(pOps);
+			SDL_FreeRW(pOps);
+			return 0;
+		}
+	};
+
+	/*
+		ResourceArchive : isOpen - Check if an archive file is currently open
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return bool - Returns true if an archive has been opened
+	*/
+	bool ResourceArchive::isOpen() const { return (mData->file != nullptr); }
+
+	/*
+		ResourceArchive : contains - Check if the archive holds an entry for a path
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPath - The path of the resource to look for
+
+		return bool - Returns true if there is an entry for the path
+	*/
+	bool ResourceArchive::contains(const char* pPath) const { return (mData->find(pPath) != nullptr); }
+
+	/*
+		ResourceArchive : getEntryCount - Get the number of entries stored in the archive
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return size_t - Returns the number of entries
+	*/
+	size_t ResourceArchive::getEntryCount() const { return mData->entries.size(); }
+
+	/*
+		ResourceArchive : getEntryName - Get the path an entry was packed with
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pIndex - The index of the entry, in the range [0, getEntryCount())
+
+		return const char* - Returns the path of the entry or nullptr if the index is out of range
+	*/
+	const char* ResourceArchive::getEntryName(const size_t& pIndex) const { return (pIndex < mData->entries.size() ? &mData->names[mData->entries[pIndex].nameOffset] : nullptr); }
+
+	/*
+		ResourceArchive : openEntry - Open a stream to read the contents of an entry
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPath - The path of the resource to open
+
+		return SDL_RWops* - Returns a read only stream over the entry or nullptr if there is no entry for the path
+	*/
+	SDL_RWops* ResourceArchive::openEntry(const char* pPath) const {
+		//Find the entry
+		const ResourceArchiveInternalData::Entry* ENTRY = mData->find(pPath);
+		if (!ENTRY) return nullptr;
+
+		//Create the stream object
+		SDL_RWops* ops = SDL_AllocRW();
+		if (!ops) return nullptr;
+
+		//Setup the callbacks
+		ops->type = SDL_RWOPS_UNKNOWN;
+		ops->size = &ResourceArchiveInternalData::streamSize;
+		ops->seek = &ResourceArchiveInternalData::streamSeek;
+		ops->read = &ResourceArchiveInternalData::streamRead;
+		ops->write = &ResourceArchiveInternalData::streamWrite;
+		ops->close = &ResourceArchiveInternalData::streamClose;
+
+		//Store the area of the archive to read
+		ops->hidden.unknown.data1 = new ResourceArchiveInternalData::EntryStream{ mData->file, (Sint64)ENTRY->offset, (Sint64)ENTRY->size, 0 };
+		return ops;
+	}
+
+	/*
+		ResourceArchive : hashPath - Generate the hash code used to index a resource path
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPath - The path of the resource
+
+		return uint64_t - Returns the 64-bit FNV-1a hash of the normalised path
+	*/
+	uint64_t ResourceArchive::hashPath(const char* pPath) {
+		uint64_t hash = 14695981039346656037ULL;
+		pPath = ResourceArchiveInternalData::skipCurrentDirectory(pPath);
+		char c = '\0';
+		while ((c = ResourceArchiveInternalData::nextPathChar(pPath, c))) {
+			hash ^= (uint64_t)(unsigned char)c;
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	/*
+		ResourceArchive : pack - Pack every file within a directory into a new archive
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pDirectory - The directory to search recursively for files to pack
+		param[in] pArchive - The path of the archive file to create
+		param[in] pPrefix - A string added to the start of the relative path of each file to form its entry path (Default nullptr)
+
+		return bool - Returns true if the archive was written successfully
+	*/
+	bool ResourceArchive::pack(const char* pDirectory, const char* pArchive, const char* pPrefix /*= nullptr*/) {
+		//Get the Logger to output errors with
+		const Debug::Logger& LOG = Globals::get<Debug::Logger>();
+
+		//Store the information for each file to pack
+		struct PackFile {
+			std::string source;
+			std::string name;
+			ResourceArchiveInternalData::Entry entry;
+		};
+		std::vector<PackFile> files;
+
+		//Find all of the files in the directory
+		{
+			//Ensure the root ends with a separator
+			std::string root = pDirectory;
+			if (root.size() && root.back() != '/' && root.back() != '\\') root += '/';
+
+			//Store the directories left to search (relative to the root)
+			std::vector<std::string> toSearch(1);
+			while (toSearch.size()) {
+				//Get the directory to search
+				const std::string REL_DIR = toSearch.back();
+				toSearch.pop_back();
+
+				//Open the directory
+				DIR* directory = opendir((root + REL_DIR).c_str());
+				if (!directory) {
+					LOG.logError("ResourceArchive failed to open the directory '%s%s' when packing '%s'", root.c_str(), REL_DIR.c_str(), pArchive);
+					return false;
+				}
+
+				//Process the elements in the directory
+				while (struct dirent* element = readdir(directory)) {
+					//Skip the navigation directories
+					const std::string NAME = element->d_name;
+					if (NAME == "." || NAME == "..") continue;
+
+					//Check if the element is a directory, testing directly if the type isn't reported
+					bool isDirectory = (element->d_type == DT_DIR);
+					if (element->d_type == DT_UNKNOWN) {
+						if (DIR* test = opendir((root + REL_DIR + NAME).c_str())) {
+							isDirectory = true;
+							closedir(test);
+						}
+					}
+
+					//Stash directories and record files
+					if (isDirectory) toSearch.push_back(REL_DIR + NAME + '/');
+					else files.push_back({ root + REL_DIR + NAME, (pPrefix ? pPrefix : "") + REL_DIR + NAME, {} });
+				}
+
+				//Close the directory
+				closedir(directory);
+			}
+		}
+
+		//Sort the files by the hash of their names
+		for (auto& file : files) file.entry.hash = hashPath(file.name.c_str());
+		std::sort(files.begin(), files.end(), [](const PackFile& pFirst, const PackFile& pSecond) { return pFirst.entry.hash < pSecond.entry.hash; });
+
+		//Check no two files normalise to the same path
+		for (size_t i = 1; i < files.size(); i++) {
+			for (size_t j = i; j-- > 0 && files[j].entry.hash == files[i].entry.hash;) {
+				if (ResourceArchiveInternalData::pathsMatch(files[i].name.c_str(), files[j].name.c_str())) {
+					LOG.logError("ResourceArchive can't pack both '%s' and '%s' into '%s', the paths only differ by case or separators", files[j].source.c_str(), files[i].source.c_str(), pArchive);
+					return false;
+				}
+			}
+		}
+
+		//Build the name block
+		std::vector<char> names;
+		for (auto& file : files) {
+			file.entry.nameOffset = (uint32_t)names.size();
+			file.entry.nameLength = (uint32_t)file.name.size();
+			names.insert(names.end(), file.name.c_str(), file.name.c_str() + file.name.size() + 1);
+		}
+
+		//Open the archive file
+		SDL_RWops* out = SDL_RWFromFile(pArchive, "wb");
+		if (!out) {
+			LOG.logError("ResourceArchive failed to create the archive file '%s'. Error: %s", pArchive, SDL_GetError());
+			return false;
+		}
+
+		//Write the header, a placeholder for the index and the names
+		const Uint32 HEADER[] = { SDL_SwapLE32(ARCHIVE_MAGIC), SDL_SwapLE32(ARCHIVE_VERSION), SDL_SwapLE32((Uint32)files.size()), SDL_SwapLE32((Uint32)names.size()) };
+		std::vector<Uint8> index(files.size() * ARCHIVE_ENTRY_SIZE);
+		bool written = (SDL_RWwrite(out, HEADER, sizeof(HEADER), 1) == 1 &&
+						(index.empty() || SDL_RWwrite(out, index.data(), index.size(), 1) == 1) &&
+						(names.empty() || SDL_RWwrite(out, names.data(), names.size(), 1) == 1));
+
+		//Copy the contents of each file
+		uint64_t offset = ARCHIVE_HEADER_SIZE + index.size() + names.size();
+		std::vector<char> buffer(PACK_BUFFER_SIZE);
+		for (size_t i = 0; i < files.size() && written; i++) {
+			//Open the file
+			SDL_RWops* in = SDL_RWFromFile(files[i].source.c_str(), "rb");
+			if (!in) {
+				LOG.logError("ResourceArchive failed to open the file '%s' when packing '%s'. Error: %s", files[i].source.c_str(), pArchive, SDL_GetError());
+				written = false;
+				break;
+			}
+
+			//Copy the data across
+			files[i].entry.offset = offset;
+			size_t read = 0;
+			while (written && (read = SDL_RWread(in, buffer.data(), 1, buffer.size()))) {
+				written = (SDL_RWwrite(out, buffer.data(), 1, read) == read);
+				offset += read;
+			}
+			files[i].entry.size = offset - files[i].entry.offset;
+			SDL_RWclose(in);
+
+			//Add the entry to the index
+			ResourceArchiveInternalData::encodeEntry(&index[i * ARCHIVE_ENTRY_SIZE], files[i].entry);
+		}
+
+		//Write the completed index
+		if (written && index.size()) written = (SDL_RWseek(out, ARCHIVE_HEADER_SIZE, RW_SEEK_SET) >= 0 && SDL_RWwrite(out, index.data(), index.size(), 1) == 1);
+
+		//Close the archive, removing it if it wasn't finished
+		if (SDL_RWclose(out)) written = false;
+		if (!written) {
+			LOG.logError("ResourceArchive failed to write the archive file '%s'. Error: %s", pArchive, SDL_GetError());
+			remove(pArchive);
+			return false;
+		}
+		return true;
+	}
+
+	/*
+		ResourceArchive : Constructor - Initialise with default values
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	ResourceArchive::ResourceArchive() : mData(new ResourceArchiveInternalData()) {}
+
+	/*
+		ResourceArchive : Destructor - Close the archive file
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	ResourceArchive::~ResourceArchive() {
+		close();
+		delete mData;
+	}
+
+	/*
+		ResourceArchive : open - Open an archive file and read its index
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPath - The path of the archive file to open
+
+		return bool - Returns true if the archive was opened
+	*/
+	bool ResourceArchive::open(const char* pPath) {
+		//Clear the previous archive
+		close();
+
+		//Open the file
+		SDL_RWops* file = SDL_RWFromFile(pPath, "rb");
+		if (!file) return false;
+
+		//Read the header
+		Uint32 header[4];
+		const Sint64 FILE_SIZE = SDL_RWsize(file);
+		if (SDL_RWread(file, header, sizeof(header), 1) != 1 || SDL_SwapLE32(header[0]) != ARCHIVE_MAGIC) {
+			SDL_RWclose(file);
+			SDL_SetError("'%s' is not a resource archive", pPath);
+			return false;
+		}
+		if (SDL_SwapLE32(header[1]) != ARCHIVE_VERSION) {
+			SDL_RWclose(file);
+			SDL_SetError("'%s' is a version %u resource archive, version %u is required", pPath, SDL_SwapLE32(header[1]), ARCHIVE_VERSION);
+			return false;
+		}
+		const uint64_t COUNT = SDL_SwapLE32(header[2]);
+		const uint64_t NAMES_SIZE = SDL_SwapLE32(header[3]);
+
+		//Check the index fits within the file
+		const uint64_t DATA_START = ARCHIVE_HEADER_SIZE + COUNT * ARCHIVE_ENTRY_SIZE + NAMES_SIZE;
+		if (FILE_SIZE < 0 || DATA_START > (uint64_t)FILE_SIZE) {
+			SDL_RWclose(file);
+			SDL_SetError("The index of the resource archive '%s' is truncated", pPath);
+			return false;
+		}
+
+		//Read the index and the names
+		std::vector<Uint8> index((size_t)(COUNT * ARCHIVE_ENTRY_SIZE));
+		std::vector<char> names((size_t)NAMES_SIZE);
+		if ((index.size() && SDL_RWread(file, index.data(), index.size(), 1) != 1) || (names.size() && SDL_RWread(file, names.data(), names.size(), 1) != 1)) {
+			SDL_RWclose(file);
+			SDL_SetError("Failed to read the index of the resource archive '%s'", pPath);
+			return false;
+		}
+
+		//Decode and validate the entries
+		std::vector<ResourceArchiveInternalData::Entry> entries((size_t)COUNT);
+		for (size_t i = 0; i < entries.size(); i++) {
+			const ResourceArchiveInternalData::Entry ENTRY = entries[i] = ResourceArchiveInternalData::decodeEntry(&index[i * ARCHIVE_ENTRY_SIZE]);
+			if (ENTRY.offset < DATA_START || ENTRY.size > (uint64_t)FILE_SIZE - ENTRY.offset ||
+				(uint64_t)ENTRY.nameOffset + ENTRY.nameLength >= NAMES_SIZE || names[ENTRY.nameOffset + ENTRY.nameLength] != '\0' ||
+				(i && ENTRY.hash < entries[i - 1].hash)) {
+				SDL_RWclose(file);
+				SDL_SetError("The resource archive '%s' has an invalid index entry (%i)", pPath, (int)i);
+				return false;
+			}
+		}
+
+		//Store the archive
+		mData->file = std::make_shared<ResourceArchiveInternalData::SharedFile>();
+		mData->file->file = file;
+		mData->entries.swap(entries);
+		mData->names.swap(names);
+		return true;
+	}
+
+	/*
+		ResourceArchive : close - Close the archive file and clear the index
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	void ResourceArchive::close() {
+		//Release the file, open entry streams keep it alive until they are closed
+		mData->file.reset();
+
+		//Clear the index
+		mData->entries.clear();
+		mData->names.clear();
+	}
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+//! Include the Library Management functionality
+#include "../__LibraryManagement.hpp"
+
+//! Include the fixed width types used by the archive index
+#include <cstdint>
+#include <cstddef>
+
+//! Prototype the SDL_RWops object
+struct SDL_RWops;
+
+namespace SDL2_Engine {
+	/*
+	 *		Name: ResourceArchive
+	 *		Author: Mitchell Croft
+	 *		Created: 16/10/2026
+	 *		Modified: 16/10/2026
+	 *
+	 *		Purpose:
+	 *		Provide read access to a directory of resources packed into a single
+	 *		file, looking entries up through an index sorted by the hash of their path
+	 *
+	 *		Notes:
+	 *		The archive starts with a header (magic, version, entry count, name block size)
+	 *		followed by the index entries (path hash, offset, size, name offset, name length),
+	 *		the null terminated entry names and finally the file contents. All values are
+	 *		stored little endian.
+	 *
+	 *		Paths are compared without case, treating '\' as '/' and ignoring any leading
+	 *		"./", so the paths used for loose files find the same entries.
+	 *
+	 *		The streams returned by openEntry share the archive file and can be read from
+	 *		any thread, including after the archive has been closed
+	**/
+	class SDL2_LIB_INC ResourceArchive {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////------------------------------------------Lookup-------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			ResourceArchive : isOpen - Check if an archive file is currently open
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if an archive has been opened
+		*/
+		bool isOpen() const;
+
+		/*
+			ResourceArchive : contains - Check if the archive holds an entry for a path
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the resource to look for
+
+			return bool - Returns true if there is an entry for the path
+		*/
+		bool contains(const char* pPath) const;
+
+		/*
+			ResourceArchive : getEntryCount - Get the number of entries stored in the archive
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the number of entries
+		*/
+		size_t getEntryCount() const;
+
+		/*
+			ResourceArchive : getEntryName - Get the path an entry was packed with
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pIndex - The index of the entry, in the range [0, getEntryCount())
+
+			return const char* - Returns the path of the entry or nullptr if the index is out of range
+
+			NOTE:
+			Entries are ordered by the hash of their path, not alphabetically
+		*/
+		const char* getEntryName(const size_t& pIndex) const;
+
+		/*
+			ResourceArchive : openEntry - Open a stream to read the contents of an entry
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the resource to open
+
+			return SDL_RWops* - Returns a read only stream over the entry or nullptr if there is no entry for the path
+
+			NOTE:
+			The stream must be closed with SDL_RWclose, or passed to an SDL function that takes ownership of it
+		*/
+		SDL_RWops* openEntry(const char* pPath) const;
+
+		/*
+			ResourceArchive : hashPath - Generate the hash code used to index a resource path
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the resource
+
+			return uint64_t - Returns the 64-bit FNV-1a hash of the normalised path
+		*/
+		static uint64_t hashPath(const char* pPath);
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////---------------------------------------Construction----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			ResourceArchive : pack - Pack every file within a directory into a new archive
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pDirectory - The directory to search recursively for files to pack
+			param[in] pArchive - The path of the archive file to create
+			param[in] pPrefix - A string added to the start of the relative path of each file to form its entry path (Default nullptr)
+
+			return bool - Returns true if the archive was written successfully
+
+			NOTE:
+			The prefix should match the path the game uses to reach the directory (e.g. "resources/"), so
+			that the same paths are used whether the resources are loose or packed. Errors are output through
+			the Logger, which must exist in the Globals
+		*/
+		static bool pack(const char* pDirectory, const char* pArchive, const char* pPrefix = nullptr);
+
+		/*
+			ResourceArchive : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		ResourceArchive();
+
+		/*
+			ResourceArchive : Destructor - Close the archive file
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		~ResourceArchive();
+
+		/*
+			ResourceArchive : open - Open an archive file and read its index
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the archive file to open
+
+			return bool - Returns true if the archive was opened
+
+			NOTE:
+			Any previously opened archive is closed first. Failure reasons are returned through SDL_GetError
+			rather than logged, so that callers can treat a missing archive as a request for loose files
+		*/
+		bool open(const char* pPath);
+
+		/*
+			ResourceArchive : close - Close the archive file and clear the index
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void close();
+
+		//! Prevent copying of the Resource Archive
+		ResourceArchive(const ResourceArchive&) = delete;
+		ResourceArchive& operator=(const ResourceArchive&) = delete;
+
+	private:
+		//! Define the internal protected elements for the Resource Archive
+		struct ResourceArchiveInternalData;
+		ResourceArchiveInternalData* mData;
+	};
+}
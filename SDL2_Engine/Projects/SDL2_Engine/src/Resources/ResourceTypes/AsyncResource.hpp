@@ -0,0 +1,228 @@
+#pragma once
+
+//! Include the Resource Base type
+#include "LocalResource.hpp"
+#include "StagedResource.hpp"
+
+//! Include the STL objects used to share the loading state between threads
+#include <memory>
+#include <atomic>
+#include <future>
+#include <functional>
+
+namespace SDL2_Engine {
+	//! Prototype the Resource Manager
+	class Resources;
+
+	namespace ResourceTypes {
+		/*
+		 *		Name: IAsyncResourceBase
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Track the progress of a resource being loaded in the background
+		 *		by the Resources Manager
+		**/
+		class SDL2_LIB_INC IAsyncResourceBase {
+		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------------Information-----------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+			/*
+				IAsyncResourceBase : status - Retrieve the current progress of the load
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return EAsyncLoadStatus - Returns the status value
+			*/
+			inline EAsyncLoadStatus status() const { return mStatus.load(); }
+
+			/*
+				IAsyncResourceBase : ready - Check if the load has finished, successfully or otherwise
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return bool - Returns true if the status is Loaded or Error
+			*/
+			inline bool ready() const { const EAsyncLoadStatus STATUS = status(); return (STATUS == EAsyncLoadStatus::Loaded || STATUS == EAsyncLoadStatus::Error); }
+
+			/*
+				IAsyncResourceBase : Destructor - Default virtual destructor
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			inline virtual ~IAsyncResourceBase() {}
+
+		protected:
+			//! Assign as a friend of the Resources Manager
+			friend class SDL2_Engine::Resources;
+
+			//! Store the progress of the load
+			std::atomic<EAsyncLoadStatus> mStatus;
+
+			//! Store the ID key the resource is stored under
+			const size_t mID;
+
+			//! Store the data read by the worker thread
+			StagedResource mStaged;
+
+			/*
+				IAsyncResourceBase : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pType - The type of resource that is being loaded
+				param[in] pPath - The path of the file to load the resource from
+				param[in] pID - The ID key the resource is stored under
+			*/
+			IAsyncResourceBase(const EResourceType& pType, const char* pPath, const size_t& pID) : mStatus(EAsyncLoadStatus::Queued), mID(pID), mStaged(pType, pPath) {}
+
+			/*
+				IAsyncResourceBase : finalise - Construct the Local Resource from the staged data on the main thread
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return std::shared_ptr<ILocalResourceBase> - Returns the created resource or nullptr if it couldn't be created
+			*/
+			virtual std::shared_ptr<ILocalResourceBase> finalise() = 0;
+
+			/*
+				IAsyncResourceBase : complete - Supply the users of the load with the resource
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pResource - The resource to pass on, which must be of the type being loaded (Can be nullptr)
+			*/
+			virtual void complete(const std::shared_ptr<ILocalResourceBase>& pResource) = 0;
+
+			/*
+				IAsyncResourceBase : fail - Abandon the load, flagging the error status
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			virtual void fail() = 0;
+		};
+
+		/*
+		 *		Name: AsyncResource
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Provide access to the Local Resource produced by a background load
+		 *
+		 *		Notes:
+		 *		The upload of the resource happens during Resources::update on the 
+		 *		main thread, so the future must not be waited on from the main thread
+		**/
+		template<typename T>
+		class __AsyncResource : public IAsyncResourceBase {
+		public:
+			//! Define the type of the shared pointer the resource is returned in
+			typedef std::shared_ptr<__LocalResource<T>> resource_t;
+
+			/*
+				AsyncResource : get - Retrieve the loaded resource without blocking
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return resource_t - Returns the resource if the load has finished, otherwise nullptr
+			*/
+			inline resource_t get() const { return (ready() ? mFuture.get() : nullptr); }
+
+			/*
+				AsyncResource : future - Retrieve the future that will receive the loaded resource
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const std::shared_future<resource_t>& - Returns a constant reference to the future
+			*/
+			inline const std::shared_future<resource_t>& future() const { return mFuture; }
+
+		private:
+			//! Assign as a friend of the Resources Manager
+			friend class SDL2_Engine::Resources;
+
+			//! Store the function used to create the resource from the staged data
+			std::function<__LocalResource<T>*(StagedResource&)> mCreate;
+
+			//! Store the promise and future that pass the resource to its users
+			std::promise<resource_t> mPromise;
+			std::shared_future<resource_t> mFuture;
+
+			/*
+				AsyncResource : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pPath - The path of the file to load the resource from
+				param[in] pID - The ID key the resource is stored under
+				param[in] pCreate - The function used to create the resource from the staged data
+
+				NOTE:
+				The resource type is copied before being passed on, as binding the in class constant to a
+				reference requires it to have a definition outside of the class
+			*/
+			__AsyncResource(const char* pPath, const size_t& pID, const std::function<__LocalResource<T>*(StagedResource&)>& pCreate) :
+				IAsyncResourceBase(EResourceType(ResourceTypeOf<T>::value), pPath, pID),
+				mCreate(pCreate),
+				mFuture(mPromise.get_future().share())
+			{}
+
+			/*
+				AsyncResource : resolve - Complete the load with an existing resource
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pResource - The resource to supply to the users of the load
+			*/
+			inline void resolve(const resource_t& pResource) {
+				mStatus.store(pResource && pResource->status() == EResourceLoadStatus::Loaded ? EAsyncLoadStatus::Loaded : EAsyncLoadStatus::Error);
+				mPromise.set_value(pResource);
+			}
+
+			/*
+				AsyncResource : finalise - Construct the Local Resource from the staged data on the main thread
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return std::shared_ptr<ILocalResourceBase> - Returns the created resource or nullptr if it couldn't be created
+
+				NOTE:
+				The resource isn't passed to the users of the load until complete is called, so that the
+				Resources Manager can supply the handle it tracks the resource through
+			*/
+			std::shared_ptr<ILocalResourceBase> finalise() override {
+				//Create the resource from the staged data
+				resource_t res = resource_t(mCreate(mStaged));
+
+				//Free the data that wasn't taken by the resource
+				mStaged.release();
+				return res;
+			}
+
+			/*
+				AsyncResource : complete - Supply the users of the load with the resource
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pResource - The resource to pass on, which must be of the type being loaded (Can be nullptr)
+			*/
+			inline void complete(const std::shared_ptr<ILocalResourceBase>& pResource) override { resolve(std::static_pointer_cast<__LocalResource<T>>(pResource)); }
+
+			/*
+				AsyncResource : fail - Abandon the load, flagging the error status
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			inline void fail() override {
+				mStaged.release();
+				resolve(nullptr);
+			}
+		};
+	}
+}
@@ -9,7 +9,7 @@ namespace SDL2_Engine {
 		 *		Name: LocalResourceBase
 		 *		Author: Mitchell Croft
 		 *		Created: 04/10/2017
-		 *		Modified: 05/10/2017
+		 *		Modified: 16/10/2026
 		 *
 		 *		Purpose:
 		 *		Provide a base point for resources to be created from
@@ -32,6 +32,19 @@ namespace SDL2_Engine {
 			*/
 			inline const EResourceLoadStatus& status() const { return mStatus; }
 
+			/*
+				LocalResourceBase : memoryUsage - Estimate the memory held by the resource
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the approximate number of bytes used by the loaded resource
+
+				NOTE:
+				This is used by the Resources Manager to decide how many unused resources to keep cached.
+				Resources that don't hold a significant amount of memory can leave this as 0
+			*/
+			inline virtual size_t memoryUsage() const { return 0; }
+
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////---------------------------------Resource Interface----------------------------------////////
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
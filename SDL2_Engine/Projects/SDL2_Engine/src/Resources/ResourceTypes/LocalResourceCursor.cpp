@@ -1,11 +1,20 @@
 #include "LocalResourceCursor.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "../../Utilities/Portability.hpp"
+
 //! Include logging and Math capabilities
 #include "../../Globals.hpp"
 #include "../../Debug/Logger.hpp"
 #include "../../Math.hpp"
 #include "../../Utilities/Endian/Endian.hpp"
 
+//! Include the Staged Resource object
+#include "StagedResource.hpp"
+
+//! Include the Resources Manager to read the source image through the mounted archive
+#include "../Resources.hpp"
+
 //! Include the SDL2 definitions
 #include <SDL.h>
 #include <SDL_image.h>
@@ -116,7 +125,7 @@ namespace SDL2_Engine {
 		/*
 			LocalResource (Cursor) : Constructor - Initialise with default values
 			Created: 05/10/2017
-			Modified: 13/10/2017
+			Modified: 16/10/2026
 
 			param[in] pPath - The path of the Objx file to load
 		*/
@@ -167,6 +176,37 @@ namespace SDL2_Engine {
 			data[SIZE] = '\0';
 			#pragma endregion
 
+			//Build the Cursor from the file data
+			build(pPath, data);
+
+			//Delete the file data
+			delete[] data;
+		}
+
+		/*
+			LocalResource (Cursor) : Constructor - Initialise from data loaded in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStaged - The Staged Resource containing the Objx file data
+		*/
+		__LocalResource<Cursor>::__LocalResource(StagedResource& pStaged) : ILocalResourceBase(EResourceType::Cursor), mFrames(nullptr), mFrameCount(0), mFPS(0.f) {
+			//Build the Cursor from the file data
+			build(pStaged.path.c_str(), pStaged.data);
+		}
+
+		/*
+			LocalResource (Cursor) : build - Create the Cursor frames from the contents of an Objx file
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the Objx file, used to locate the source image
+			param[in] pData - The null terminated contents of the Objx file
+		*/
+		void __LocalResource<Cursor>::build(const char* pPath, const char* pData) {
+			//Get a reference to the Logger object
+			const Debug::Logger& log = Globals::get<Debug::Logger>();
+
 			#pragma region Parse Read Data
 			//Flag if an error occurred during the parsing process
 			bool parsingError = false;
@@ -184,10 +224,7 @@ namespace SDL2_Engine {
 			}, 3);
 
 			//Parse the data
-			const Document DOC = reader.cparse(data);
-
-			//Delete the file data
-			delete[] data;
+			const Document DOC = reader.cparse(pData);
 
 			//If an error occurred
 			if (parsingError) {
@@ -264,7 +301,7 @@ namespace SDL2_Engine {
 			const std::string SRC_LOC = deductLocation(pPath, OBJ["source"].readVal<xstring>());
 			
 			//Load the spritesheet/source image
-			SDL_Surface* spritesheetSrc = IMG_Load(SRC_LOC.c_str());
+			SDL_Surface* spritesheetSrc = IMG_Load_RW(Globals::get<Resources>().openFile(SRC_LOC.c_str()), 1);
 
 			//Check the surface was loaded was correctly
 			if (!spritesheetSrc) {
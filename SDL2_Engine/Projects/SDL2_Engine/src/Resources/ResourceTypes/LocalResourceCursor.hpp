@@ -11,11 +11,14 @@ namespace SDL2_Engine {
 	class Resources;
 
 	namespace ResourceTypes {
+		//! Prototype the Staged Resource object
+		struct StagedResource;
+
 		/*
 		 *		Name: LocalResource (Cursor)
 		 *		Author: Mitchell Croft
 		 *		Created: 05/10/2017
-		 *		Modified: 06/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Specialise the LocalResource object to operate on Objx files that
@@ -117,7 +120,7 @@ namespace SDL2_Engine {
 
 		private:
 			//! Assign as a friend of the Resources Manager
-			friend class Resources;
+			friend class SDL2_Engine::Resources;
 
 			//! Store an array of the cursor frames that make up animation
 			SDL_Cursor** mFrames;
@@ -131,11 +134,30 @@ namespace SDL2_Engine {
 			/*
 				LocalResource (Cursor) : Constructor - Initialise with default values
 				Created: 05/10/2017
-				Modified: 13/10/2017
+				Modified: 16/10/2026
 
 				param[in] pPath - The path of the Objx file to load
 			*/
 			__LocalResource(const char* pPath);
+
+			/*
+				LocalResource (Cursor) : Constructor - Initialise from data loaded in the background
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStaged - The Staged Resource containing the Objx file data
+			*/
+			__LocalResource(StagedResource& pStaged);
+
+			/*
+				LocalResource (Cursor) : build - Create the Cursor frames from the contents of an Objx file
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pPath - The path of the Objx file, used to locate the source image
+				param[in] pData - The null terminated contents of the Objx file
+			*/
+			void build(const char* pPath, const char* pData);
 		};
 	}
 }
\ No newline at end of file
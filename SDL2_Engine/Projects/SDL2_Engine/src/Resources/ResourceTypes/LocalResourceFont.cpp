@@ -4,6 +4,9 @@
 #include "../../Globals.hpp"
 #include "../../Debug/Logger.hpp"
 
+//! Include the Staged Resource object
+#include "StagedResource.hpp"
+
 //! Include the SDL2 definitions
 #include <SDL.h>
 #include <SDL_ttf.h>
@@ -13,7 +16,7 @@ namespace SDL2_Engine {
 		/*
 			LocalResource (Font) : dispose - Unload SDL2 resource information
 			Created: 05/10/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 		*/
 		void __LocalResource<Font>::dispose() {
 			//Check the font exists
@@ -27,25 +30,63 @@ namespace SDL2_Engine {
 				//Flag as unloaded
 				mStatus = EResourceLoadStatus::Freed;
 			}
+
+			//Delete the file data the font was streamed from
+			if (mBuffer) {
+				delete[] mBuffer;
+				mBuffer = nullptr;
+				mBufferSize = 0;
+			}
 		}
 
 		/*
 			LocalResource (Font) : Constructor - Initialise with default values
 			Created: 05/10/2017
-			Modified: 08/11/2017
+			Modified: 16/10/2026
 
 			param[in] pPath - The path of the font file to load
 			param[in] pSize - The point size to use for the font
 			param[in] pIndex - Optional index of the font face to load from the file (Default 0)
 		*/
-		__LocalResource<Font>::__LocalResource(const char* pPath, const int& pSize, const long& pIndex /* = 0*/) : ILocalResourceBase(EResourceType::Font), font(nullptr), fontSize(pSize) {
+		__LocalResource<Font>::__LocalResource(const char* pPath, const int& pSize, const long& pIndex /* = 0*/) : ILocalResourceBase(EResourceType::Font), font(nullptr), fontSize(pSize), mBuffer(nullptr), mBufferSize(0) {
 			//Load the font
 			font = TTF_OpenFontIndex(pPath, pSize, pIndex);
 
 			//Check the file was loaded properly
 			if (!font) {
 				//Output error message
-				Globals::get<Debug::Logger>().logError("Local Resource (Font) failed to load the font file '%s' with size %i and index %i. Error: %s", pPath, pSize, pIndex, SDL_GetError());
+				Globals::get<Debug::Logger>().logError("Local Resource (Font) failed to load the font file '%s' with size %i and index %li. Error: %s", pPath, pSize, pIndex, SDL_GetError());
+
+				//Flag error status
+				mStatus = EResourceLoadStatus::Error;
+			}
+
+			//Otherwise assign loaded flag
+			else mStatus = EResourceLoadStatus::Loaded;
+		}
+
+		/*
+			LocalResource (Font) : Constructor - Initialise from data loaded in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStaged - The Staged Resource containing the font file data
+			param[in] pSize - The point size to use for the font
+			param[in] pIndex - Optional index of the font face to load from the file (Default 0)
+		*/
+		__LocalResource<Font>::__LocalResource(StagedResource& pStaged, const int& pSize, const long& pIndex /* = 0*/) : ILocalResourceBase(EResourceType::Font), font(nullptr), fontSize(pSize), mBuffer(nullptr), mBufferSize(0) {
+			//Take the file data, the font reads from it for as long as it is open
+			mBuffer = pStaged.data;
+			mBufferSize = pStaged.size;
+			pStaged.data = nullptr;
+
+			//Open the font from memory
+			font = TTF_OpenFontIndexRW(SDL_RWFromConstMem(mBuffer, (int)pStaged.size), 1, pSize, pIndex);
+
+			//Check the font was opened properly
+			if (!font) {
+				//Output error message
+				Globals::get<Debug::Logger>().logError("Local Resource (Font) failed to load the font file '%s' with size %i and index %li. Error: %s", pStaged.path.c_str(), pSize, pIndex, SDL_GetError());
 
 				//Flag error status
 				mStatus = EResourceLoadStatus::Error;
@@ -11,11 +11,14 @@ namespace SDL2_Engine {
 	class Resources;
 
 	namespace ResourceTypes {
+		//! Prototype the Staged Resource object
+		struct StagedResource;
+
 		/*
 		 *		Name: LocalResource (Font)
 		 *		Author: Mitchell Croft
 		 *		Created: 05/10/2017
-		 *		Modified: 08/11/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Specialise the LocalResource object to operate on TTF_Font objects
@@ -47,25 +50,49 @@ namespace SDL2_Engine {
 			/*
 				LocalResource (Font) : dispose - Unload SDL2 resource information
 				Created: 05/10/2017
-				Modified: 05/10/2017
+				Modified: 16/10/2026
 			*/
 			void dispose() override;
 
+			/*
+				LocalResource (Font) : memoryUsage - Estimate the memory held by the font
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the size of the file data the font is streamed from, or 0 if it streams from the file
+			*/
+			inline size_t memoryUsage() const override { return mBufferSize; }
+
 		private:
 
 			//! Assign as a friend of the Resources Manager
-			friend class Resources;
+			friend class SDL2_Engine::Resources;
+
+			//! Store the file data the font is streamed from when loaded in the background
+			char* mBuffer;
+			size_t mBufferSize;
 
 			/*
 				LocalResource (Font) : Constructor - Initialise with default values
 				Created: 05/10/2017
-				Modified: 08/11/2017
+				Modified: 16/10/2026
 
 				param[in] pPath - The path of the font file to load
 				param[in] pSize - The point size to use for the font
 				param[in] pIndex - Optional index of the font face to load from the file (Default 0)
 			*/
 			__LocalResource(const char* pPath, const int& pSize, const long& pIndex = 0);
+
+			/*
+				LocalResource (Font) : Constructor - Initialise from data loaded in the background
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStaged - The Staged Resource containing the font file data
+				param[in] pSize - The point size to use for the font
+				param[in] pIndex - Optional index of the font face to load from the file (Default 0)
+			*/
+			__LocalResource(StagedResource& pStaged, const int& pSize, const long& pIndex = 0);
 		};
 	}
 }
\ No newline at end of file
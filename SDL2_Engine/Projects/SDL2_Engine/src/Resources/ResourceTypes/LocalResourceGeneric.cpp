@@ -1,9 +1,15 @@
 #include "LocalResourceGeneric.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "../../Utilities/Portability.hpp"
+
 //! Include logging capabilities
 #include "../../Globals.hpp"
 #include "../../Debug/Logger.hpp"
 
+//! Include the Staged Resource object
+#include "StagedResource.hpp"
+
 namespace SDL2_Engine {
 	namespace ResourceTypes {
 		/*
@@ -78,5 +84,23 @@ namespace SDL2_Engine {
 			//Flag loaded
 			mStatus = EResourceLoadStatus::Loaded;
 		}
+
+		/*
+			LocalResource (Generic) : Constructor - Initialise from data loaded in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStaged - The Staged Resource containing the file data
+		*/
+		__LocalResource<Generic>::__LocalResource(StagedResource& pStaged) : ILocalResourceBase(EResourceType::Generic), mData(nullptr), mSize(0) {
+			//Take the file data
+			mData = pStaged.data;
+			mSize = pStaged.size;
+			pStaged.data = nullptr;
+			pStaged.size = 0;
+
+			//Flag the status based on the data received
+			mStatus = (mData ? EResourceLoadStatus::Loaded : EResourceLoadStatus::Error);
+		}
 	}
 }
\ No newline at end of file
@@ -8,11 +8,14 @@ namespace SDL2_Engine {
 	class Resources;
 
 	namespace ResourceTypes {
+		//! Prototype the Staged Resource object
+		struct StagedResource;
+
 		/*
 		 *		Name: LocalResource (Generic)
 		 *		Author: Mitchell Croft
 		 *		Created: 04/10/2017
-		 *		Modified: 05/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Specialise the LocalResource object to operate on generic files
@@ -60,10 +63,19 @@ namespace SDL2_Engine {
 			*/
 			void dispose() override;
 
+			/*
+				LocalResource (Generic) : memoryUsage - Estimate the memory held by the data stream
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the approximate number of bytes used
+			*/
+			inline size_t memoryUsage() const override { return mSize; }
+
 		private:
 
 			//! Assign as a friend of the Resources Manager
-			friend class Resources;
+			friend class SDL2_Engine::Resources;
 
 			//! Store the data stream
 			char* mData;
@@ -79,6 +91,15 @@ namespace SDL2_Engine {
 				param[in] pPath - The path of the data to load
 			*/
 			__LocalResource(const char* pPath);
+
+			/*
+				LocalResource (Generic) : Constructor - Initialise from data loaded in the background
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStaged - The Staged Resource containing the file data
+			*/
+			__LocalResource(StagedResource& pStaged);
 		};
 	}
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "../../Globals.hpp"
 #include "../../Debug/Logger.hpp"
 
+//! Include the Staged Resource object
+#include "StagedResource.hpp"
+
 //! Include the SDL2 definitions
 #include <SDL.h>
 #include <SDL_mixer.h>
@@ -13,7 +16,7 @@ namespace SDL2_Engine {
 		/*
 			LocalResource (Music) : dispose - Unload SDL2 resource information
 			Created: 04/10/2017
-			Modified: 04/10/2017
+			Modified: 16/10/2026
 		*/
 		void __LocalResource<Music>::dispose() {
 			//Check the music exists
@@ -27,16 +30,23 @@ namespace SDL2_Engine {
 				//Set the status flag
 				mStatus = EResourceLoadStatus::Unloaded;
 			}
+
+			//Delete the file data the music was streamed from
+			if (mBuffer) {
+				delete[] mBuffer;
+				mBuffer = nullptr;
+				mBufferSize = 0;
+			}
 		}
 
 		/*
 			LocalResource (Music) : Constructor - Initialise with default values
 			Created: 04/10/2017
-			Modified: 04/10/2017
+			Modified: 16/10/2026
 
 			param[in] pPath - The path of the music file to load
 		*/
-		__LocalResource<Music>::__LocalResource(const char* pPath) : ILocalResourceBase(EResourceType::Music), music(nullptr) {
+		__LocalResource<Music>::__LocalResource(const char* pPath) : ILocalResourceBase(EResourceType::Music), music(nullptr), mBuffer(nullptr), mBufferSize(0) {
 			//Load the sound effect
 			music = Mix_LoadMUS(pPath);
 
@@ -52,5 +62,34 @@ namespace SDL2_Engine {
 			//Otherwise assign loaded flag
 			else mStatus = EResourceLoadStatus::Loaded;
 		}
+
+		/*
+			LocalResource (Music) : Constructor - Initialise from data loaded in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStaged - The Staged Resource containing the music file data
+		*/
+		__LocalResource<Music>::__LocalResource(StagedResource& pStaged) : ILocalResourceBase(EResourceType::Music), music(nullptr), mBuffer(nullptr), mBufferSize(0) {
+			//Take the file data, the music is streamed from it while playing
+			mBuffer = pStaged.data;
+			mBufferSize = pStaged.size;
+			pStaged.data = nullptr;
+
+			//Open the music from memory
+			music = Mix_LoadMUS_RW(SDL_RWFromConstMem(mBuffer, (int)pStaged.size), 1);
+
+			//Check the music was opened properly
+			if (!music) {
+				//Output error message
+				Globals::get<Debug::Logger>().logError("Local Resource (Music) failed to load the music file '%s'. Error: %s", pStaged.path.c_str(), SDL_GetError());
+
+				//Flag error status
+				mStatus = EResourceLoadStatus::Error;
+			}
+
+			//Otherwise assign loaded flag
+			else mStatus = EResourceLoadStatus::Loaded;
+		}
 	}
 }
\ No newline at end of file
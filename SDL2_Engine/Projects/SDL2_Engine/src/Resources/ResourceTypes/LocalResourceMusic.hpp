@@ -11,11 +11,14 @@ namespace SDL2_Engine {
 	class Resources;
 
 	namespace ResourceTypes {
+		//! Prototype the Staged Resource object
+		struct StagedResource;
+
 		/*
 		 *		Name: LocalResource (Music)
 		 *		Author: Mitchell Croft
 		 *		Created: 04/10/2017
-		 *		Modified: 05/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Specialise the LocalResource object to operate on Mix_Music objects
@@ -44,23 +47,45 @@ namespace SDL2_Engine {
 			/*
 				LocalResource (Music) : dispose - Unload SDL2 resource information
 				Created: 04/10/2017
-				Modified: 04/10/2017
+				Modified: 16/10/2026
 			*/
 			void dispose() override;
 
+			/*
+				LocalResource (Music) : memoryUsage - Estimate the memory held by the music
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the size of the file data the music is streamed from, or 0 if it streams from the file
+			*/
+			inline size_t memoryUsage() const override { return mBufferSize; }
+
 		private:
 
 			//! Assign as a friend of the Resources Manager
-			friend class Resources;
+			friend class SDL2_Engine::Resources;
+
+			//! Store the file data the music is streamed from when loaded in the background
+			char* mBuffer;
+			size_t mBufferSize;
 
 			/*
 				LocalResource (Music) : Constructor - Initialise with default values
 				Created: 04/10/2017
-				Modified: 04/10/2017
+				Modified: 16/10/2026
 
 				param[in] pPath - The path of the music file to load
 			*/
 			__LocalResource(const char* pPath);
+
+			/*
+				LocalResource (Music) : Constructor - Initialise from data loaded in the background
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStaged - The Staged Resource containing the music file data
+			*/
+			__LocalResource(StagedResource& pStaged);
 		};
 	}
 }
\ No newline at end of file
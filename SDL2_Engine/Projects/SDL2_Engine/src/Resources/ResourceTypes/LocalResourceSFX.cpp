@@ -4,6 +4,9 @@
 #include "../../Globals.hpp"
 #include "../../Debug/Logger.hpp"
 
+//! Include the Staged Resource object
+#include "StagedResource.hpp"
+
 //! Include the SDL2 definitions
 #include <SDL.h>
 #include <SDL_mixer.h>
@@ -52,5 +55,39 @@ namespace SDL2_Engine {
 			//Otherwise assign loaded flag
 			else mStatus = EResourceLoadStatus::Loaded;
 		}
+
+		/*
+			LocalResource (SFX) : Constructor - Initialise from data loaded in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStaged - The Staged Resource containing the decoded sound effect
+		*/
+		__LocalResource<SFX>::__LocalResource(StagedResource& pStaged) : ILocalResourceBase(EResourceType::SFX), sfx(nullptr) {
+			//Take the decoded sound effect
+			sfx = (Mix_Chunk*)pStaged.decoded;
+			pStaged.decoded = nullptr;
+
+			//Check there was a sound effect decoded
+			if (!sfx) {
+				//Output error message
+				Globals::get<Debug::Logger>().logError("Local Resource (SFX) did not receive a decoded sound effect for the file '%s'", pStaged.path.c_str());
+
+				//Flag error status
+				mStatus = EResourceLoadStatus::Error;
+			}
+
+			//Otherwise assign loaded flag
+			else mStatus = EResourceLoadStatus::Loaded;
+		}
+
+		/*
+			LocalResource (SFX) : memoryUsage - Estimate the memory held by the decoded audio
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the approximate number of bytes used
+		*/
+		size_t __LocalResource<SFX>::memoryUsage() const { return (sfx ? (size_t)sfx->alen : 0); }
 	}
 }
\ No newline at end of file
@@ -11,11 +11,14 @@ namespace SDL2_Engine {
 	class Resources;
 
 	namespace ResourceTypes {
+		//! Prototype the Staged Resource object
+		struct StagedResource;
+
 		/*
 		 *		Name: LocalResource (SFX)
 		 *		Author: Mitchell Croft
 		 *		Created: 04/10/2017
-		 *		Modified: 05/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Specialise the LocalResource object to operate on Mix_Chunk objects
@@ -48,10 +51,19 @@ namespace SDL2_Engine {
 			*/
 			void dispose() override;
 
+			/*
+				LocalResource (SFX) : memoryUsage - Estimate the memory held by the decoded audio
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the approximate number of bytes used
+			*/
+			size_t memoryUsage() const override;
+
 		private:
 
 			//! Assign as a friend of the Resources Manager
-			friend class Resources;
+			friend class SDL2_Engine::Resources;
 
 			/*
 				LocalResource (SFX) : Constructor - Initialise with default values
@@ -61,6 +73,15 @@ namespace SDL2_Engine {
 				param[in] pPath - The path of the sound effect file to load
 			*/
 			__LocalResource(const char* pPath);
+
+			/*
+				LocalResource (SFX) : Constructor - Initialise from data loaded in the background
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStaged - The Staged Resource containing the decoded sound effect
+			*/
+			__LocalResource(StagedResource& pStaged);
 		};
 	}
 }
\ No newline at end of file
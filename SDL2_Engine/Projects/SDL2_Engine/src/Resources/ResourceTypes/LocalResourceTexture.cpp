@@ -4,6 +4,9 @@
 #include "../../Globals.hpp"
 #include "../../Debug/Logger.hpp"
 
+//! Include the Staged Resource object
+#include "StagedResource.hpp"
+
 //! Include the SDL2 definitions
 #include <SDL.h>
 #include <SDL_image.h>
@@ -32,7 +35,7 @@ namespace SDL2_Engine {
 		/*
 			LocalResource (Texture) : Constructor - Initialise with default values
 			Created: 04/10/2017
-			Modified: 09/10/2017
+			Modified: 16/10/2026
 
 			param[in] pRenderer - The SDL2 renderer object that will be used to create the texture
 			param[in] pPath - The path of the image file to load
@@ -45,15 +48,55 @@ namespace SDL2_Engine {
 			//Check the texture was loaded properly
 			if (!texture) {
 				//Output error message
-				Globals::get<Debug::Logger>().logError("Local Resource (Texture) failed to load the texture '%s'. Error: %s", pPath, pBlendMode, SDL_GetError());
+				Globals::get<Debug::Logger>().logError("Local Resource (Texture) failed to load the texture '%s'. Error: %s", pPath, SDL_GetError());
+
+				//Flag error status
+				mStatus = EResourceLoadStatus::Error;
+				return;
+			}
+
+			//Setup the texture properties
+			setup(pPath, pBlendMode);
+		}
+
+		/*
+			LocalResource (Texture) : Constructor - Initialise from data loaded in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pRenderer - The SDL2 renderer object that will be used to create the texture
+			param[in] pStaged - The Staged Resource containing the decoded image surface
+			param[in] pBlendMode - The SDL_BlendMode value to be applied to the texture
+		*/
+		__LocalResource<Texture>::__LocalResource(SDL_Renderer* pRenderer, StagedResource& pStaged, const int& pBlendMode /* = 0*/) : ILocalResourceBase(EResourceType::Texture), texture(nullptr) {
+			//Upload the decoded surface to a texture
+			texture = SDL_CreateTextureFromSurface(pRenderer, (SDL_Surface*)pStaged.decoded);
+
+			//Check the texture was created properly
+			if (!texture) {
+				//Output error message
+				Globals::get<Debug::Logger>().logError("Local Resource (Texture) failed to create the texture for '%s'. Error: %s", pStaged.path.c_str(), SDL_GetError());
 
 				//Flag error status
 				mStatus = EResourceLoadStatus::Error;
 				return;
 			}
 
+			//Setup the texture properties
+			setup(pStaged.path.c_str(), pBlendMode);
+		}
+
+		/*
+			LocalResource (Texture) : setup - Apply the blend mode and read the properties of the created texture
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the image file, used for error messages
+			param[in] pBlendMode - The SDL_BlendMode value to be applied to the texture
+		*/
+		void __LocalResource<Texture>::setup(const char* pPath, const int& pBlendMode) {
 			//Set the blend mode
-			else if (pBlendMode && SDL_SetTextureBlendMode(texture, (SDL_BlendMode)pBlendMode)) {
+			if (pBlendMode && SDL_SetTextureBlendMode(texture, (SDL_BlendMode)pBlendMode)) {
 				//Output error message
 				Globals::get<Debug::Logger>().logError("Local Resource (Texture) failed to load the file '%s' with the blend mode '%i'. Error: %s", pPath, pBlendMode, SDL_GetError());
 
@@ -65,6 +108,7 @@ namespace SDL2_Engine {
 
 				//Reset the texture pointer
 				texture = nullptr;
+				return;
 			}
 
 			//Get texture information
@@ -74,5 +118,21 @@ namespace SDL2_Engine {
 			//Assign loaded flag
 			mStatus = EResourceLoadStatus::Loaded;
 		}
+
+		/*
+			LocalResource (Texture) : memoryUsage - Estimate the memory held by the texture pixels
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the approximate number of bytes used
+
+			NOTE:
+			Formats that don't report a pixel size (e.g. YUV) are counted as 4 bytes per pixel
+		*/
+		size_t __LocalResource<Texture>::memoryUsage() const {
+			if (!texture) return 0;
+			const size_t BYTES = (size_t)SDL_BYTESPERPIXEL(mFormat);
+			return (size_t)mWidth * (size_t)mHeight * (BYTES ? BYTES : 4);
+		}
 	}
 }
\ No newline at end of file
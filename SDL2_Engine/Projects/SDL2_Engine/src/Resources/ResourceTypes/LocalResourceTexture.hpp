@@ -12,11 +12,14 @@ namespace SDL2_Engine {
 	class Resources;
 
 	namespace ResourceTypes {
+		//! Prototype the Staged Resource object
+		struct StagedResource;
+
 		/*
 		 *		Name: LocalResource (Texture)
 		 *		Author: Mitchell Croft
 		 *		Created: 04/10/2017
-		 *		Modified: 09/10/2017
+		 *		Modified: 16/10/2026
 		 *
 		 *		Purpose:
 		 *		Specialise the LocalResource object to operate on SDL2_Texture objects
@@ -85,10 +88,19 @@ namespace SDL2_Engine {
 			*/
 			void dispose() override;
 
+			/*
+				LocalResource (Texture) : memoryUsage - Estimate the memory held by the texture pixels
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return size_t - Returns the approximate number of bytes used
+			*/
+			size_t memoryUsage() const override;
+
 		private:
 
 			//! Assign as a friend of the Resources Manager
-			friend class Resources;
+			friend class SDL2_Engine::Resources;
 
 			//! Store information about the Texture
 			unsigned int mFormat;
@@ -100,13 +112,34 @@ namespace SDL2_Engine {
 			/*
 				LocalResource (Texture) : Constructor - Initialise with default values
 				Created: 04/10/2017
-				Modified: 09/10/2017
+				Modified: 16/10/2026
 
 				param[in] pRenderer - The SDL2 renderer object that will be used to create the texture
 				param[in] pPath - The path of the image file to load
 				param[in] pBlendMode - The SDL_BlendMode value to be applied to the texture (Default none)
 			*/
 			__LocalResource(SDL_Renderer* pRenderer, const char* pPath, const int& pBlendMode = 0);
+
+			/*
+				LocalResource (Texture) : Constructor - Initialise from data loaded in the background
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pRenderer - The SDL2 renderer object that will be used to create the texture
+				param[in] pStaged - The Staged Resource containing the decoded image surface
+				param[in] pBlendMode - The SDL_BlendMode value to be applied to the texture (Default none)
+			*/
+			__LocalResource(SDL_Renderer* pRenderer, StagedResource& pStaged, const int& pBlendMode = 0);
+
+			/*
+				LocalResource (Texture) : setup - Apply the blend mode and read the properties of the created texture
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pPath - The path of the image file, used for error messages
+				param[in] pBlendMode - The SDL_BlendMode value to be applied to the texture
+			*/
+			void setup(const char* pPath, const int& pBlendMode);
 		};
 	}
 }
\ No newline at end of file
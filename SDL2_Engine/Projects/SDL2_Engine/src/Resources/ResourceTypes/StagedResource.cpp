@@ -0,0 +1,122 @@
+#include "StagedResource.hpp"
+
+//! Include the SDL2 definitions
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_mixer.h>
+
+namespace SDL2_Engine {
+	namespace ResourceTypes {
+		/*
+			StagedResource : stage - Read and decode the resource data
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSource - A stream to read the data from, closed once read (Default nullptr opens the file at path)
+
+			return bool - Returns true if the resource data was staged successfully
+		*/
+		bool StagedResource::stage(SDL_RWops* pSource /*= nullptr*/) {
+			//Attempt to open the file, if no stream was supplied
+			SDL_RWops* file = (pSource ? pSource : SDL_RWFromFile(path.c_str(), "rb"));
+
+			//Check the file was opened
+			if (!file) {
+				error = SDL_GetError();
+				return false;
+			}
+
+			//Get the size of the file
+			const Sint64 LENGTH = SDL_RWsize(file);
+
+			//Check the size could be read
+			if (LENGTH < 0) {
+				error = SDL_GetError();
+				SDL_RWclose(file);
+				return false;
+			}
+
+			//Create the data array
+			size = (size_t)LENGTH;
+			data = new char[size + 1];
+
+			//Read in the file data
+			const size_t READ = SDL_RWread(file, data, sizeof(char), size);
+
+			//Close the file
+			SDL_RWclose(file);
+
+			//Check all of the data was read
+			if (READ != size) {
+				error = "Only read " + std::to_string(READ) + " of " + std::to_string(size) + " bytes";
+				return false;
+			}
+
+			//Null terminate the stream
+			data[size] = '\0';
+
+			//Decode the data where it is safe to do so away from the main thread
+			switch (type) {
+			case EResourceType::Texture:
+				//Decode the image to a surface, the texture is created on the main thread
+				if (!(decoded = IMG_Load_RW(SDL_RWFromConstMem(data, (int)size), 1))) error = IMG_GetError();
+				break;
+			case EResourceType::SFX:
+				//Decode the sound effect to the format of the audio device
+				if (!(decoded = Mix_LoadWAV_RW(SDL_RWFromConstMem(data, (int)size), 1))) error = Mix_GetError();
+				break;
+			default: break;
+			}
+
+			//Check if the data was decoded
+			if (decoded) {
+				//The raw file data is no longer needed
+				delete[] data;
+				data = nullptr;
+			}
+
+			//Return the success of the operation
+			return error.empty();
+		}
+
+		/*
+			StagedResource : release - Free any data that was not taken by a Local Resource
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void StagedResource::release() {
+			//Delete the file data
+			if (data) {
+				delete[] data;
+				data = nullptr;
+				size = 0;
+			}
+
+			//Free the decoded object
+			if (decoded) {
+				switch (type) {
+				case EResourceType::Texture: SDL_FreeSurface((SDL_Surface*)decoded); break;
+				case EResourceType::SFX: Mix_FreeChunk((Mix_Chunk*)decoded); break;
+				default: break;
+				}
+				decoded = nullptr;
+			}
+		}
+
+		/*
+			StagedResource : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pType - The type of resource that is being staged
+			param[in] pPath - The path of the file to read the resource from
+		*/
+		StagedResource::StagedResource(const EResourceType& pType, const char* pPath) :
+			type(pType),
+			path(pPath ? pPath : ""),
+			data(nullptr),
+			size(0),
+			decoded(nullptr)
+		{}
+	}
+}
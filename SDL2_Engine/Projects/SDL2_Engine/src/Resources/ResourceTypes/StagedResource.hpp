@@ -0,0 +1,96 @@
+#pragma once
+
+//! Include the Library Management functionality
+#include "../../__LibraryManagement.hpp"
+
+//! Include the base values for SDL2 Resources
+#include "../ResourceValues.hpp"
+
+//! Include the STL string for storing the path
+#include <string>
+
+//! Prototype the SDL_RWops object
+struct SDL_RWops;
+
+namespace SDL2_Engine {
+	namespace ResourceTypes {
+		/*
+		 *		Name: StagedResource
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Store the data of a resource that has been read (and where possible 
+		 *		decoded) away from the main thread, ready for the Local Resource 
+		 *		object to be constructed from it
+		 *
+		 *		Notes:
+		 *		Local Resources constructed from a Staged Resource take ownership
+		 *		of the data they use, clearing the pointers held here. Anything 
+		 *		left over is freed when the Staged Resource is destroyed
+		**/
+		struct SDL2_LIB_INC StagedResource {
+			//! Flag the type of resource that is being staged
+			EResourceType type;
+
+			//! Store the path that the resource is read from
+			std::string path;
+
+			//! Store the contents of the file (null terminated)
+			char* data;
+
+			//! Store the number of bytes in the file
+			size_t size;
+
+			//! Store the decoded object ready for upload (SDL_Surface for Textures, Mix_Chunk for SFX)
+			void* decoded;
+
+			//! Store a description of the error that occurred while staging
+			std::string error;
+
+			/*
+				StagedResource : stage - Read and decode the resource data
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pSource - A stream to read the data from, closed once read (Default nullptr opens the file at path)
+
+				return bool - Returns true if the resource data was staged successfully
+
+				NOTE:
+				This is safe to call from a worker thread and does not log any errors,
+				instead storing them in the error string for the main thread to report
+			*/
+			bool stage(SDL_RWops* pSource = nullptr);
+
+			/*
+				StagedResource : release - Free any data that was not taken by a Local Resource
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			void release();
+
+			/*
+				StagedResource : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pType - The type of resource that is being staged
+				param[in] pPath - The path of the file to read the resource from
+			*/
+			StagedResource(const EResourceType& pType, const char* pPath);
+
+			/*
+				StagedResource : Destructor - Free any remaining data
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			inline ~StagedResource() { release(); }
+
+			//! Prevent copying of the staged data
+			StagedResource(const StagedResource&) = delete;
+			StagedResource& operator=(const StagedResource&) = delete;
+		};
+	}
+}
@@ -32,6 +32,15 @@ namespace SDL2_Engine {
 		Generic
 	};
 
+	//! Map the resource prototypes to their EResourceType value
+	template<typename T> struct ResourceTypeOf { static const EResourceType value = EResourceType::Null; };
+	template<> struct ResourceTypeOf<Texture> { static const EResourceType value = EResourceType::Texture; };
+	template<> struct ResourceTypeOf<SFX> { static const EResourceType value = EResourceType::SFX; };
+	template<> struct ResourceTypeOf<Music> { static const EResourceType value = EResourceType::Music; };
+	template<> struct ResourceTypeOf<Cursor> { static const EResourceType value = EResourceType::Cursor; };
+	template<> struct ResourceTypeOf<Font> { static const EResourceType value = EResourceType::Font; };
+	template<> struct ResourceTypeOf<Generic> { static const EResourceType value = EResourceType::Generic; };
+
 	//! Store enumeration values for tracking the status of a SDL2Resource object
 	enum class EResourceLoadStatus : char {
 		Error		= 1 << 0,
@@ -39,4 +48,22 @@ namespace SDL2_Engine {
 		Loaded		= 1 << 2,
 		Freed		= 1 << 3
 	};
+
+	//! Store enumeration values for tracking the progress of an asynchronous resource load
+	enum class EAsyncLoadStatus : char {
+		//! Waiting for a worker thread to begin loading
+		Queued,
+
+		//! File data is being read and decoded on a worker thread
+		Loading,
+
+		//! Decoded data is waiting to be uploaded on the main thread
+		Uploading,
+
+		//! The resource has been loaded and can be retrieved
+		Loaded,
+
+		//! The resource could not be loaded
+		Error
+	};
 }
\ No newline at end of file
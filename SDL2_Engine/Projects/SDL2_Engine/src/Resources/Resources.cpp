@@ -1,90 +1,347 @@
 #include "Resources.hpp"
 
+//! Include logging capabilities
+#include "../Globals.hpp"
+#include "../Debug/Logger.hpp"
+
 //! Include the SDL2 definitions
 #include <SDL.h>
 #include <SDL_render.h>
+#include <SDL_image.h>
 
 //! Include STL objects that will be used to track and monitor resources
 #include <unordered_map>
+#include <deque>
+#include <list>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//! Define the default amount of time each update can spend finishing background loads (in seconds)
+#define DEFAULT_UPLOAD_BUDGET 0.002f
+
+//! Define the maximum number of worker threads created when the count is chosen from the hardware
+#define MAX_DEFAULT_WORKERS 4U
+
+//! Define the default amount of memory loaded resources can use before unused ones are freed (in bytes)
+#define DEFAULT_CACHE_BUDGET (64U * 1024U * 1024U)
+
+//! Define the default minimum time between freeing unused resources (in seconds)
+#define DEFAULT_EVICTION_INTERVAL 0.5f
 
 namespace SDL2_Engine {
 	/*
 	 *		Name: ResourcesInternalData
 	 *		Author: Mitchell Croft
 	 *		Created: 05/10/2017
-	 *		Modified: 05/10/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Manage the internal STL objects 
 	**/
 	struct Resources::ResourcesInternalData {
+		//! Define the type used to store background loads
+		typedef std::shared_ptr<ResourceTypes::IAsyncResourceBase> asyncLoad;
+
+		//! Define the values tracked for each stored resource
+		struct StoredResource {
+			//! The resource, owned by the manager
+			LocalResourceBase resource;
+
+			//! The handle shared by the users of the resource, which expires when the last is released
+			std::weak_ptr<ResourceTypes::ILocalResourceBase> handle;
+
+			//! The estimated memory used by the resource
+			size_t bytes;
+
+			//! The position of the resource in the unused list, or the end of the list while in use
+			std::list<size_t>::iterator unused;
+		};
+
+		//! Define the queue that handles add the ID of their resource to when released
+		struct ReleaseQueue {
+			std::mutex lock;
+			std::vector<size_t> ids;
+		};
+
 		//! Maintain a reference to the active Renderer object
 		SDL_Renderer* renderer;
 
-		//! Keep a map of all of the active resources
-		std::unordered_map<size_t, LocalResourceBase> loadedResources;
+		//! Keep a map of all of the stored resources
+		std::unordered_map<size_t, StoredResource> loadedResources;
+
+		//! Keep the IDs of the stored resources that are unused, from least to most recently released
+		std::list<size_t> unused;
+
+		//! Store the queue of released resources, shared with the handles so it can outlive the manager
+		std::shared_ptr<ReleaseQueue> released;
+
+		//! Store the released IDs being processed, reused between updates
+		std::vector<size_t> releasing;
+
+		//! Store the memory budget and the memory used by the stored resources (in bytes)
+		size_t cacheBudget, cacheUsage;
+
+		//! Store the minimum time between evictions and the time of the last (in performance counter ticks)
+		float evictionInterval;
+		Uint64 lastEviction;
+
+		//! Keep a map of the background loads that have not finished (Main thread only)
+		std::unordered_map<size_t, asyncLoad> pendingLoads;
+
+		//! Store the worker threads and the number to create
+		std::vector<std::thread> workers;
+		unsigned int workerCount;
+
+		//! Store the loads waiting for a worker and the loads waiting for the main thread
+		std::deque<asyncLoad> waiting, staged;
+
+		//! Control access to the load queues
+		std::mutex lock;
+		std::condition_variable signal;
+
+		//! Flag when the worker threads should stop
+		bool stopping;
+
+		//! Store the amount of time each update can spend finishing loads
+		float uploadBudget;
+
+		//! Store the archive resources are read from (Only changed while there are no pending loads)
+		ResourceArchive archive;
+
+		/*
+			ResourcesInternalData : workerLoop - Stage the loads passed to the worker threads
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		void workerLoop() {
+			while (true) {
+				//Retrieve the next load to process
+				asyncLoad load;
+				{
+					std::unique_lock<std::mutex> guard(lock);
+					signal.wait(guard, [&]() { return stopping || waiting.size(); });
+					if (stopping) return;
+					load = waiting.front();
+					waiting.pop_front();
+				}
+
+				//Read and decode the resource, from the archive if it has an entry for it
+				load->mStatus.store(EAsyncLoadStatus::Loading);
+				load->mStaged.stage(archive.openEntry(load->mStaged.path.c_str()));
+
+				//Pass the load back to the main thread
+				load->mStatus.store(EAsyncLoadStatus::Uploading);
+				std::lock_guard<std::mutex> guard(lock);
+				staged.push_back(load);
+			}
+		}
+
+		/*
+			ResourcesInternalData : acquire - Get the handle users share a stored resource through
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pID - The ID the resource is stored under
+			param[in] pStored - The stored values of the resource
+
+			return LocalResourceBase - Returns the existing handle if the resource is in use, otherwise a new one
+
+			NOTE:
+			The handle keeps the resource alive and adds its ID to the release queue when its last user releases it
+		*/
+		LocalResourceBase acquire(const size_t& pID, StoredResource& pStored) {
+			//Share the existing handle if the resource is in use
+			if (LocalResourceBase handle = pStored.handle.lock()) return handle;
+
+			//Remove the resource from the unused list
+			if (pStored.unused != unused.end()) {
+				unused.erase(pStored.unused);
+				pStored.unused = unused.end();
+			}
+
+			//Create the handle to report when the resource is released
+			const size_t ID = pID;
+			LocalResourceBase owner = pStored.resource;
+			std::shared_ptr<ReleaseQueue> queue = released;
+			LocalResourceBase handle(owner.get(), [ID, owner, queue](ResourceTypes::ILocalResourceBase*) {
+				std::lock_guard<std::mutex> guard(queue->lock);
+				queue->ids.push_back(ID);
+			});
+			pStored.handle = handle;
+			return handle;
+		}
+
+		/*
+			ResourcesInternalData : evict - Dispose of a stored resource and remove it from the manager
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pIt - An iterator to the resource in the loadedResources map
+		*/
+		void evict(std::unordered_map<size_t, StoredResource>::iterator pIt) {
+			//Remove the resource from the unused list
+			if (pIt->second.unused != unused.end()) unused.erase(pIt->second.unused);
+
+			//Dispose of the resource
+			pIt->second.resource->dispose();
+
+			//Remove the resource from the managed list
+			cacheUsage -= pIt->second.bytes;
+			loadedResources.erase(pIt);
+		}
 	};
 
 	/*
 		Resources : Constructor - Initialise with default values
 		Created: 05/10/2017
-		Modified: 05/10/2017
+		Modified: 16/10/2026
 
 		param[in] pRenderer - A pointer to the Renderer object, to be used to create Textures
+		param[in] pWorkerCount - The number of worker threads used for background loading (Default 0, chosen from the hardware)
 	*/
-	Resources::Resources(SDL_Renderer* pRenderer) : mData(nullptr) {
+	Resources::Resources(SDL_Renderer* pRenderer, const unsigned int& pWorkerCount /*= 0*/) : mData(nullptr) {
 		//Create the internal data object
 		mData = new ResourcesInternalData();
 
 		//Store the Renderer pointer
 		mData->renderer = pRenderer;
+
+		//Store the loading values
+		mData->workerCount = pWorkerCount;
+		mData->stopping = false;
+		mData->uploadBudget = DEFAULT_UPLOAD_BUDGET;
+
+		//Store the cache values
+		mData->released = std::make_shared<ResourcesInternalData::ReleaseQueue>();
+		mData->cacheBudget = DEFAULT_CACHE_BUDGET;
+		mData->cacheUsage = 0;
+		mData->evictionInterval = DEFAULT_EVICTION_INTERVAL;
+		mData->lastEviction = 0;
 	}
 
 	/*
 		Resources : createInterface - Verify and setup starting information
 		Created: 05/10/2017
-		Modified: 05/10/2017
+		Modified: 16/10/2026
 
 		return bool - Returns true if the Resources Manager was setup correctly
 	*/
 	bool Resources::createInterface() {
+		//Load the image decoders before the worker threads could race to do so
+		IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG | IMG_INIT_TIF);
+
+		//Determine the number of worker threads to use
+		if (!mData->workerCount) {
+			const unsigned int HARDWARE = std::thread::hardware_concurrency();
+			mData->workerCount = (HARDWARE > 1 ? HARDWARE - 1 : 1);
+			if (mData->workerCount > MAX_DEFAULT_WORKERS) mData->workerCount = MAX_DEFAULT_WORKERS;
+		}
+
+		//Start the worker threads
+		mData->workers.reserve(mData->workerCount);
+		for (unsigned int i = 0; i < mData->workerCount; i++)
+			mData->workers.emplace_back(&ResourcesInternalData::workerLoop, mData);
+
 		return true;
-		return (mData->renderer != nullptr);
 	}
 
 	/*
 		Resources : destroyInterface - Deallocate internal memory allocated
 		Created: 05/10/2017
-		Modified: 05/10/2017
+		Modified: 16/10/2026
 	*/
 	void Resources::destroyInterface() {
+		//Stop the worker threads
+		{
+			std::lock_guard<std::mutex> guard(mData->lock);
+			mData->stopping = true;
+		}
+		mData->signal.notify_all();
+		for (auto& worker : mData->workers) worker.join();
+
+		//Abandon the loads that have not finished
+		for (auto& it : mData->pendingLoads)
+			it.second->fail();
+
 		//Loop through all resources for forced disposal
-		for (auto it : mData->loadedResources) 
-			it.second->dispose();
+		for (auto& it : mData->loadedResources) 
+			it.second.resource->dispose();
 
 		//Delete the data object
 		delete mData;
+
+		//Unload the image decoders
+		IMG_Quit();
 	}
 
 	/*
 		Resources : update - Update active local resources
 		Created: 05/10/2017
-		Modified: 05/10/2017
+		Modified: 16/10/2026
 	*/
 	void Resources::update() {
-		//Loop through all resources
-		for (auto it = mData->loadedResources.begin(); it != mData->loadedResources.end();) {
-			//Check if the resource can be removed
-			if (it->second.unique() || (int)it->second->status() & ((int)EResourceLoadStatus::Error | (int)EResourceLoadStatus::Freed)) {
-				//Force disposal of the resource
-				it->second->dispose();
-
-				//Remove the resource the managed list
-				mData->loadedResources.erase(it++);
-			}
+		//Finish the background loads, within the upload budget
+		if (mData->pendingLoads.size()) {
+			const Uint64 START = SDL_GetPerformanceCounter();
+			const Uint64 BUDGET = (Uint64)(mData->uploadBudget * (double)SDL_GetPerformanceFrequency());
+			do {
+				//Get the next staged load
+				ResourcesInternalData::asyncLoad load;
+				{
+					std::lock_guard<std::mutex> guard(mData->lock);
+					if (mData->staged.empty()) break;
+					load = mData->staged.front();
+					mData->staged.pop_front();
+				}
+
+				//Check if the data failed to stage
+				if (load->mStaged.error.size()) {
+					Globals::get<Debug::Logger>().logError("Resources failed to load '%s' in the background. Error: %s", load->mStaged.path.c_str(), load->mStaged.error.c_str());
+					load->fail();
+				}
+
+				//Otherwise create the resource, storing it if loaded, and pass it on
+				else {
+					LocalResourceBase res = load->finalise();
+					if (res && res->status() == EResourceLoadStatus::Loaded) res = storeResource(res, load->mID);
+					load->complete(res);
+				}
+
+				//Remove the load from the pending list
+				mData->pendingLoads.erase(load->mID);
+			} while (SDL_GetPerformanceCounter() - START < BUDGET);
+		}
+
+		//Retrieve the resources released since the last update
+		{
+			std::lock_guard<std::mutex> guard(mData->released->lock);
+			mData->releasing.swap(mData->released->ids);
+		}
+
+		//Move the released resources to the end of the unused list
+		for (const size_t& id : mData->releasing) {
+			//Check the resource is still stored and wasn't acquired again
+			auto it = mData->loadedResources.find(id);
+			if (it == mData->loadedResources.end() || !it->second.handle.expired() || it->second.unused != mData->unused.end()) continue;
 
-			//Otherwise continue
-			else ++it;
+			//Remove resources that were freed while in use
+			if ((int)it->second.resource->status() & ((int)EResourceLoadStatus::Error | (int)EResourceLoadStatus::Freed)) mData->evict(it);
+
+			//Otherwise cache the resource
+			else it->second.unused = mData->unused.insert(mData->unused.end(), id);
+		}
+		mData->releasing.clear();
+
+		//Free the least recently used resources until the cache is within budget, at most once per interval
+		if (mData->cacheUsage > mData->cacheBudget && mData->unused.size()) {
+			const Uint64 NOW = SDL_GetPerformanceCounter();
+			if (NOW - mData->lastEviction >= (Uint64)(mData->evictionInterval * (double)SDL_GetPerformanceFrequency())) {
+				mData->lastEviction = NOW;
+				while (mData->cacheUsage > mData->cacheBudget && mData->unused.size())
+					mData->evict(mData->loadedResources.find(mData->unused.front()));
+			}
 		}
 	}
 
@@ -100,27 +357,265 @@ namespace SDL2_Engine {
 	/*
 		Resources : getResource - Retrieve a specific resource by ID
 		Created: 05/10/2017
-		Modified: 05/10/2017
+		Modified: 16/10/2026
 
 		param[in] pID - The ID of the resource to retrieve
 
 		return LocalResourceBase - Returns a shared pointer to a base Resource object or nullptr if not found
 	*/
-	LocalResourceBase Resources::getResource(const size_t& pID) const {
+	LocalResourceBase Resources::getResource(const size_t& pID) {
 		//Search for the Resource
 		auto it = mData->loadedResources.find(pID);
 
-		//Return the resource
-		return (it != mData->loadedResources.end() ? it->second : nullptr);
+		//Return the handle to the resource
+		return (it != mData->loadedResources.end() ? mData->acquire(pID, it->second) : nullptr);
+	}
+
+	/*
+		Resources : getResource - Retrieve a specific resource by ID, if it is of the expected type
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pID - The ID of the resource to retrieve
+		param[in] pType - The type the resource must be
+
+		return LocalResourceBase - Returns a shared pointer to a base Resource object or nullptr if not found
+
+		NOTE:
+		The type is included in the ID, so a mismatch only occurs if two keys collide. Checking it allows
+		the result to be cast without inspecting the type information of the object
+	*/
+	LocalResourceBase Resources::getResource(const size_t& pID, const EResourceType& pType) {
+		//Search for the Resource
+		auto it = mData->loadedResources.find(pID);
+
+		//Return the handle to the resource if the type matches
+		return (it != mData->loadedResources.end() && it->second.resource->type == pType ? mData->acquire(pID, it->second) : nullptr);
 	}
 
 	/*
 		Resources : storeResource - Store a Local Resource under a specific ID value
 		Created: 05/10/2017
-		Modified: 05/10/2017
+		Modified: 16/10/2026
 
 		param[in] pResource - A shared pointer to the resource to store
 		param[in] pID - The ID to store the resource under
+
+		return LocalResourceBase - Returns the handle to supply to the users of the resource
+
+		NOTE:
+		If a resource is already stored under the ID (e.g. a background load finishing after the same
+		resource was loaded directly) the existing resource is returned and the new one is discarded
+	*/
+	LocalResourceBase Resources::storeResource(LocalResourceBase pResource, const size_t& pID) {
+		//Check for an existing resource
+		auto it = mData->loadedResources.find(pID);
+		if (it == mData->loadedResources.end()) {
+			//Store the resource, unused until the handle is created
+			ResourcesInternalData::StoredResource stored;
+			stored.resource = pResource;
+			stored.bytes = pResource->memoryUsage();
+			stored.unused = mData->unused.end();
+			it = mData->loadedResources.emplace(pID, stored).first;
+			mData->cacheUsage += stored.bytes;
+		}
+
+		//Return the handle to the resource
+		return mData->acquire(pID, it->second);
+	}
+
+	/*
+		Resources : mountArchive - Read resources from a packed Resource Archive
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPath - The path of the archive file to mount
+
+		return bool - Returns true if the archive was mounted
+	*/
+	bool Resources::mountArchive(const char* pPath) {
+		//Check the workers aren't reading from the current archive
+		if (mData->pendingLoads.size()) {
+			Globals::get<Debug::Logger>().logWarning("Resources can't mount the archive '%s' while %zu background loads are pending", pPath, mData->pendingLoads.size());
+			return false;
+		}
+
+		//Open the archive
+		if (!mData->archive.open(pPath)) {
+			Globals::get<Debug::Logger>().logWarning("Resources failed to mount the archive '%s', resources will be loaded from loose files. Error: %s", pPath, SDL_GetError());
+			return false;
+		}
+		return true;
+	}
+
+	/*
+		Resources : unmountArchive - Return to reading resources from loose files
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	void Resources::unmountArchive() {
+		//Check the workers aren't reading from the archive
+		if (mData->pendingLoads.size()) {
+			Globals::get<Debug::Logger>().logWarning("Resources can't unmount the archive while %zu background loads are pending", mData->pendingLoads.size());
+			return;
+		}
+
+		//Close the archive
+		mData->archive.close();
+	}
+
+	/*
+		Resources : getArchive - Get the Resource Archive that resources are read from
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return const ResourceArchive& - Returns a constant reference to the archive, which isn't open if none is mounted
+	*/
+	const ResourceArchive& Resources::getArchive() const { return mData->archive; }
+
+	/*
+		Resources : openFile - Open a stream to read a file through the mounted archive
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pPath - The path of the file to open
+
+		return SDL_RWops* - Returns a stream over the archive entry for the path, the loose file if there is no entry, or nullptr if neither could be opened
+	*/
+	SDL_RWops* Resources::openFile(const char* pPath) const {
+		if (SDL_RWops* entry = mData->archive.openEntry(pPath)) return entry;
+		return SDL_RWFromFile(pPath, "rb");
+	}
+
+	/*
+		Resources : stageFromArchive - Read a resource's data from the mounted archive
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pStaged - The Staged Resource to fill, identifying the path and type of the resource
+
+		return bool - Returns true if the archive had an entry for the resource that was staged successfully
+	*/
+	bool Resources::stageFromArchive(ResourceTypes::StagedResource& pStaged) const {
+		//Look for an entry for the resource
+		SDL_RWops* entry = mData->archive.openEntry(pStaged.path.c_str());
+		if (!entry) return false;
+
+		//Read and decode the data
+		if (!pStaged.stage(entry)) {
+			Globals::get<Debug::Logger>().logError("Resources failed to load '%s' from the archive, trying the loose file. Error: %s", pStaged.path.c_str(), pStaged.error.c_str());
+			pStaged.release();
+			pStaged.error.clear();
+			return false;
+		}
+		return true;
+	}
+
+	/*
+		Resources : getUploadBudget - Get the time allowed each update for finishing background loads
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return float - Returns the budget in seconds
 	*/
-	void Resources::storeResource(LocalResourceBase pResource, const size_t& pID) { mData->loadedResources[pID] = pResource; }
+	float Resources::getUploadBudget() const { return mData->uploadBudget; }
+
+	/*
+		Resources : setUploadBudget - Set the time allowed each update for finishing background loads
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSeconds - The budget in seconds. At least one load is finished per update regardless
+	*/
+	void Resources::setUploadBudget(const float& pSeconds) { mData->uploadBudget = (pSeconds > 0.f ? pSeconds : 0.f); }
+
+	/*
+		Resources : pendingLoads - Get the number of background loads that have not finished
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return size_t - Returns the number of outstanding loads
+	*/
+	size_t Resources::pendingLoads() const { return mData->pendingLoads.size(); }
+
+	/*
+		Resources : getCacheBudget - Get the memory that loaded resources can use before unused ones are freed
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return size_t - Returns the budget in bytes
+	*/
+	size_t Resources::getCacheBudget() const { return mData->cacheBudget; }
+
+	/*
+		Resources : setCacheBudget - Set the memory that loaded resources can use before unused ones are freed
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pBytes - The budget in bytes. A budget of 0 frees every resource once it is unused
+	*/
+	void Resources::setCacheBudget(const size_t& pBytes) { mData->cacheBudget = pBytes; }
+
+	/*
+		Resources : getEvictionInterval - Get the minimum time between freeing unused resources
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return float - Returns the interval in seconds
+	*/
+	float Resources::getEvictionInterval() const { return mData->evictionInterval; }
+
+	/*
+		Resources : setEvictionInterval - Set the minimum time between freeing unused resources
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pSeconds - The interval in seconds. An interval of 0 checks the budget every update
+	*/
+	void Resources::setEvictionInterval(const float& pSeconds) { mData->evictionInterval = (pSeconds > 0.f ? pSeconds : 0.f); }
+
+	/*
+		Resources : getCacheUsage - Get the memory used by the resources stored in the manager
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return size_t - Returns the estimated number of bytes used by resources in use and cached
+	*/
+	size_t Resources::getCacheUsage() const { return mData->cacheUsage; }
+
+	/*
+		Resources : getPendingLoad - Retrieve a background load that is in progress for a specific ID
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pID - The ID of the resource being loaded
+
+		return std::shared_ptr<ResourceTypes::IAsyncResourceBase> - Returns the load or nullptr if not found
+	*/
+	std::shared_ptr<ResourceTypes::IAsyncResourceBase> Resources::getPendingLoad(const size_t& pID) const {
+		//Search for the load
+		auto it = mData->pendingLoads.find(pID);
+
+		//Return the load
+		return (it != mData->pendingLoads.end() ? it->second : nullptr);
+	}
+
+	/*
+		Resources : beginLoad - Pass a background load to the worker threads
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pLoad - The load to be processed
+	*/
+	void Resources::beginLoad(std::shared_ptr<ResourceTypes::IAsyncResourceBase> pLoad) {
+		//Track the load so duplicate requests share it
+		mData->pendingLoads[pLoad->mID] = pLoad;
+
+		//Add the load to the queue
+		{
+			std::lock_guard<std::mutex> guard(mData->lock);
+			mData->waiting.push_back(pLoad);
+		}
+		mData->signal.notify_one();
+	}
 }
\ No newline at end of file
@@ -2,14 +2,18 @@
 
 //! Include the required base values
 #include "../Utilities/IGlobal.hpp"
-#include "../Utilities/TypeID.hpp"
 #include "ResourceTypes/LocalResource.hpp"
+#include "ResourceTypes/AsyncResource.hpp"
+#include "ResourceArchive.hpp"
 
 //! Include Shared Pointers to handle resource acquisition and sharing
 #include <memory>
 
-//! Include standard stream to handle hashing of data sets
-#include <sstream>
+//! Include the STL objects used to hash the identifying values of resources
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
 
 //! Prototype the SDL_Renderer object
 struct SDL_Renderer;
@@ -18,15 +22,30 @@ namespace SDL2_Engine {
 	//! Define a simple alias' to be used for the Local Resource objects
 	typedef std::shared_ptr<ResourceTypes::ILocalResourceBase> LocalResourceBase;
 	template<typename T> using LocalResource = std::shared_ptr<ResourceTypes::__LocalResource<T>>;
+	template<typename T> using AsyncResource = std::shared_ptr<ResourceTypes::__AsyncResource<T>>;
 
 	/*
 	 *		Name: Resources
 	 *		Author: Mitchell Croft
 	 *		Created: 05/10/2017
-	 *		Modified: 11/10/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Provide uniform functionality for loading and managing local resources
+	 *
+	 *		Notes:
+	 *		Resources requested through loadResourceAsync are read and decoded by a
+	 *		pool of worker threads. The objects that must be created on the main
+	 *		thread (Textures, Fonts etc.) are then finished during update, limited
+	 *		to the upload budget each frame.
+	 *
+	 *		While a Resource Archive is mounted, resources are read from the entry
+	 *		matching their path, falling back to the loose file when there isn't one
+	 *
+	 *		Loaded resources stay cached after their last user releases them, so
+	 *		they can be reused if requested again. When the cache exceeds its memory
+	 *		budget, the least recently released resources are freed until it is back
+	 *		within it
 	**/
 	class SDL2_LIB_INC Resources : public Utilities::IGlobal {
 	public:
@@ -37,7 +56,7 @@ namespace SDL2_Engine {
 		/*
 			Resources : loadResource (Generic) - Loads one of the standard Resource types (not Texture) with supplied parameters
 			Created: 05/10/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 
 			Template T - The type of Resource to load (E.g. SFX, Music, Cursor etc.)
 			Template TArgs - A parameter pack of values to used to setup the resource and act as an identifying key
@@ -45,6 +64,10 @@ namespace SDL2_Engine {
 			param[in] pArgs - The parameter pack to use for key and resource construction
 
 			return LocalResource<T> - Returns a shared pointer to the Local Resource requested
+
+			NOTE:
+			Finding a resource that is in use doesn't allocate, it costs one hash of the arguments and one table
+			lookup. Resources that are cached but unused are given a new handle
 		*/
 		template<typename T, typename ... TArgs>
 		LocalResource<typename std::enable_if<!std::is_same<Texture, T>::value, T>::type> loadResource(TArgs ... pArgs) {
@@ -52,31 +75,31 @@ namespace SDL2_Engine {
 			static_assert(std::is_base_of<ResourceTypes::ILocalResourceBase, ResourceTypes::__LocalResource<T>>::value, "Can not load a Local Resource that is of an undefined type");
 
 			//Generate the ID key for the resource
-			const size_t ID = hashData(Utilities::typeToID<T>, pArgs...);
+			const size_t ID = hashData(EResourceType(ResourceTypeOf<T>::value), pArgs...);
 
-			//Look for an existing Resource with the ID
-			auto res = getResource(ID);
+			//Look for an existing Resource of the type with the ID
+			auto res = getResource(ID, EResourceType(ResourceTypeOf<T>::value));
 
 			//If there was no resource found
 			if (!res) {
 				//Create the new resource
-				LocalResource<T> temp = LocalResource<T>(new ResourceTypes::__LocalResource<T>(pArgs...));
+				LocalResource<T> temp = LocalResource<T>(createResource<T>(pArgs...));
 
-				//Store the resource in the manager, if loaded 
-				if (temp->status() == EResourceLoadStatus::Loaded) storeResource(temp, ID);
+				//Store the resource in the manager, if loaded, returning the handle it is tracked through
+				if (temp->status() == EResourceLoadStatus::Loaded) return std::static_pointer_cast<ResourceTypes::__LocalResource<T>>(storeResource(temp, ID));
 
 				//Return the new resource
 				return temp;
 			}
 
 			//Otherwise cast and return found resource
-			else return std::dynamic_pointer_cast<ResourceTypes::__LocalResource<T>>(res);
+			else return std::static_pointer_cast<ResourceTypes::__LocalResource<T>>(res);
 		}
 
 		/*
 			Resources : loadResource (Texture) - Loads a local Texture object, supplying a Renderer pointer for construction
 			Created: 05/10/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 
 			Template T - Function specilisation for T == Texture
 			Template TArgs - A parameter pack of values used to setup the Texture and act as an identifying key
@@ -88,27 +111,220 @@ namespace SDL2_Engine {
 		template<typename T, typename ... TArgs>
 		LocalResource<typename std::enable_if<std::is_same<Texture, T>::value, Texture>::type> loadResource(TArgs ... pArgs) {
 			//Generate the ID key for the resource
-			const size_t ID = hashData(Utilities::typeToID<T>, pArgs...);
+			const size_t ID = hashData(EResourceType(ResourceTypeOf<T>::value), pArgs...);
 
-			//Look for an existing Resource with the ID
-			auto res = getResource(ID);
+			//Look for an existing Resource of the type with the ID
+			auto res = getResource(ID, EResourceType(ResourceTypeOf<T>::value));
 
 			//If there was no resource found
 			if (!res) {
 				//Create the new resource
-				LocalResource<T> temp = LocalResource<T>(new ResourceTypes::__LocalResource<T>(getRenderer(), pArgs...));
+				LocalResource<T> temp = LocalResource<T>(createResource<T>(pArgs...));
 
-				//Store the resource in the manager, if loaded 
-				if (temp->status() == EResourceLoadStatus::Loaded) storeResource(temp, ID);
+				//Store the resource in the manager, if loaded, returning the handle it is tracked through
+				if (temp->status() == EResourceLoadStatus::Loaded) return std::static_pointer_cast<ResourceTypes::__LocalResource<T>>(storeResource(temp, ID));
 
 				//Return the new resource
 				return temp;
 			}
 
 			//Otherwise cast and return found resource
-			else return std::dynamic_pointer_cast<ResourceTypes::__LocalResource<T>>(res);
+			else return std::static_pointer_cast<ResourceTypes::__LocalResource<T>>(res);
+		}
+
+		/*
+			Resources : loadResourceAsync (Generic) - Begin loading one of the standard Resource types (not Texture) in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			Template T - The type of Resource to load (E.g. SFX, Music, Cursor etc.)
+			Template TArgs - A parameter pack of the values following the path used to setup the resource
+
+			param[in] pPath - The path of the file to load the resource from
+			param[in] pArgs - The parameter pack to use for key and resource construction
+
+			return AsyncResource<T> - Returns a shared pointer to the handle tracking the load
+
+			NOTE:
+			The key is generated in the same way as loadResource, so loaded resources are shared between
+			the two. Requests for a resource that is already being loaded return the existing handle
+		*/
+		template<typename T, typename ... TArgs>
+		AsyncResource<typename std::enable_if<!std::is_same<Texture, T>::value, T>::type> loadResourceAsync(const char* pPath, TArgs ... pArgs) {
+			//Ensure load type is valid
+			static_assert(std::is_base_of<ResourceTypes::ILocalResourceBase, ResourceTypes::__LocalResource<T>>::value, "Can not load a Local Resource that is of an undefined type");
+
+			//Generate the ID key for the resource
+			const size_t ID = hashData(EResourceType(ResourceTypeOf<T>::value), pPath, pArgs...);
+
+			//Queue the load with the function to finish the resource on the main thread
+			return queueLoad<T>(pPath, ID, [=](ResourceTypes::StagedResource& pStaged) { return new ResourceTypes::__LocalResource<T>(pStaged, pArgs...); });
+		}
+
+		/*
+			Resources : loadResourceAsync (Texture) - Begin loading a local Texture object in the background
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			Template T - Function specilisation for T == Texture
+			Template TArgs - A parameter pack of the values following the path used to setup the Texture
+
+			param[in] pPath - The path of the image file to load
+			param[in] pArgs - The parameter pack to use for key and resource construction
+
+			return AsyncResource<Texture> - Returns a shared pointer to the handle tracking the load
+		*/
+		template<typename T, typename ... TArgs>
+		AsyncResource<typename std::enable_if<std::is_same<Texture, T>::value, Texture>::type> loadResourceAsync(const char* pPath, TArgs ... pArgs) {
+			//Generate the ID key for the resource
+			const size_t ID = hashData(EResourceType(ResourceTypeOf<T>::value), pPath, pArgs...);
+
+			//Get the Renderer to create the Texture with
+			SDL_Renderer* renderer = getRenderer();
+
+			//Queue the load with the function to finish the resource on the main thread
+			return queueLoad<T>(pPath, ID, [=](ResourceTypes::StagedResource& pStaged) { return new ResourceTypes::__LocalResource<T>(renderer, pStaged, pArgs...); });
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------------Archives------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			Resources : mountArchive - Read resources from a packed Resource Archive
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the archive file to mount
+
+			return bool - Returns true if the archive was mounted
+
+			NOTE:
+			Archives can only be changed while there are no background loads pending. If the archive
+			can't be opened a warning is output and resources continue to be loaded from loose files
+		*/
+		bool mountArchive(const char* pPath);
+
+		/*
+			Resources : unmountArchive - Return to reading resources from loose files
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			NOTE:
+			Resources that have already been loaded are unaffected
+		*/
+		void unmountArchive();
+
+		/*
+			Resources : getArchive - Get the Resource Archive that resources are read from
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const ResourceArchive& - Returns a constant reference to the archive, which isn't open if none is mounted
+		*/
+		const ResourceArchive& getArchive() const;
+
+		/*
+			Resources : openFile - Open a stream to read a file through the mounted archive
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pPath - The path of the file to open
+
+			return SDL_RWops* - Returns a stream over the archive entry for the path, the loose file if there is no entry, or nullptr if neither could be opened
+
+			NOTE:
+			This is intended for data loaded outside of the Local Resource types (e.g. images processed with
+			IMG_Load_RW). The stream must be closed with SDL_RWclose, or passed to a function that takes ownership of it
+		*/
+		SDL_RWops* openFile(const char* pPath) const;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------Loading Management--------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			Resources : getUploadBudget - Get the time allowed each update for finishing background loads
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return float - Returns the budget in seconds
+		*/
+		float getUploadBudget() const;
+
+		/*
+			Resources : setUploadBudget - Set the time allowed each update for finishing background loads
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeconds - The budget in seconds. At least one load is finished per update regardless
+		*/
+		void setUploadBudget(const float& pSeconds);
+
+		/*
+			Resources : pendingLoads - Get the number of background loads that have not finished
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the number of outstanding loads
+		*/
+		size_t pendingLoads() const;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-------------------------------------Cache Management--------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			Resources : getCacheBudget - Get the memory that loaded resources can use before unused ones are freed
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the budget in bytes
+		*/
+		size_t getCacheBudget() const;
+
+		/*
+			Resources : setCacheBudget - Set the memory that loaded resources can use before unused ones are freed
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pBytes - The budget in bytes. A budget of 0 frees every resource once it is unused
+
+			NOTE:
+			Resources that are in use are never freed, so the usage can remain above the budget
+		*/
+		void setCacheBudget(const size_t& pBytes);
+
+		/*
+			Resources : getEvictionInterval - Get the minimum time between freeing unused resources
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return float - Returns the interval in seconds
+		*/
+		float getEvictionInterval() const;
+
+		/*
+			Resources : setEvictionInterval - Set the minimum time between freeing unused resources
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeconds - The interval in seconds. An interval of 0 checks the budget every update
+		*/
+		void setEvictionInterval(const float& pSeconds);
+
+		/*
+			Resources : getCacheUsage - Get the memory used by the resources stored in the manager
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return size_t - Returns the estimated number of bytes used by resources in use and cached
+
+			NOTE:
+			The usage is the sum of the memoryUsage estimates of the resources when they were stored
+		*/
+		size_t getCacheUsage() const;
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////------------------------------------Helper Functions---------------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,24 +332,25 @@ namespace SDL2_Engine {
 		/*
 			Resources : hashData - Convert a series of data to a single hash code
 			Created: 05/10/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			Template TArgs  |
-							- A parameter pack of stream-able data that will make up the hash key
+							- A parameter pack of strings, integral, enumeration and floating point values that will make up the hash key
 			param[in] pArgs |
 
 			return size_t - Returns the hash code as a size_t value
+
+			NOTE:
+			Each value is hashed directly without building a string. Strings are hashed by their contents and
+			numbers by their value, so the same path or size supplied as a different type produces the same key
 		*/
 		template<typename ... TArgs>
 		static inline size_t hashData(const TArgs& ... pArgs) {
-			//Create a string stream to store data values
-			std::ostringstream os;
-
-			//Output the data to the stream
-			compileStream(os, pArgs...);
+			//Combine the hash of each value
+			const uint64_t KEY = combineHashes(14695981039346656037ULL, pArgs...);
 
-			//Return the hash code
-			return std::hash<std::string>{}(os.str());
+			//Fold the key into the size of the ID
+			return (size_t)(KEY ^ (KEY >> 32));
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,16 +360,17 @@ namespace SDL2_Engine {
 		/*
 			Resources : Constructor - Initialise with default values
 			Created: 05/10/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			param[in] pRenderer - A pointer to the Renderer object, to be used to create Textures
+			param[in] pWorkerCount - The number of worker threads used for background loading (Default 0, chosen from the hardware)
 		*/
-		Resources(SDL_Renderer* pRenderer);
+		Resources(SDL_Renderer* pRenderer, const unsigned int& pWorkerCount = 0);
 
 		/*
 			Resources : createInterface - Verify and setup starting information
 			Created: 05/10/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 
 			return bool - Returns true if the Resources Manager was setup correctly
 		*/
@@ -161,14 +379,14 @@ namespace SDL2_Engine {
 		/*
 			Resources : destroyInterface - Deallocate internal memory allocated
 			Created: 05/10/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 		*/
 		void destroyInterface() override;
 
 		/*
 			Resources : update - Update active local resources
 			Created: 05/10/2017
-			Modified: 05/10/2017
+			Modified: 16/10/2026
 		*/
 		void update() override;
 
@@ -180,18 +398,93 @@ namespace SDL2_Engine {
 		//! Function for retrieving the Renderer object from internal data
 		SDL_Renderer* getRenderer();
 
-		//! Retrieve an active resource with a specific ID
-		LocalResourceBase getResource(const size_t& pID) const;
+		//! Retrieve a handle to a stored resource with a specific ID
+		LocalResourceBase getResource(const size_t& pID);
 
-		//! Store a Local Resource in the Manager
-		void storeResource(LocalResourceBase pResource, const size_t& pID);
+		//! Retrieve a handle to a stored resource with a specific ID, if it is of the expected type
+		LocalResourceBase getResource(const size_t& pID, const EResourceType& pType);
+
+		//! Store a Local Resource in the Manager, returning the handle it is tracked through
+		LocalResourceBase storeResource(LocalResourceBase pResource, const size_t& pID);
+
+		//! Read a resource's data from the mounted archive, returning true if an entry was staged
+		bool stageFromArchive(ResourceTypes::StagedResource& pStaged) const;
+
+		//! Create a Local Resource (not Texture), reading it from the mounted archive where possible
+		template<typename T, typename ... TArgs>
+		ResourceTypes::__LocalResource<typename std::enable_if<!std::is_same<Texture, T>::value, T>::type>* createResource(const char* pPath, TArgs ... pArgs) {
+			ResourceTypes::StagedResource staged(EResourceType(ResourceTypeOf<T>::value), pPath);
+			if (stageFromArchive(staged)) return new ResourceTypes::__LocalResource<T>(staged, pArgs...);
+			return new ResourceTypes::__LocalResource<T>(pPath, pArgs...);
+		}
+
+		//! Create a Local Texture, reading it from the mounted archive where possible
+		template<typename T, typename ... TArgs>
+		ResourceTypes::__LocalResource<typename std::enable_if<std::is_same<Texture, T>::value, Texture>::type>* createResource(const char* pPath, TArgs ... pArgs) {
+			ResourceTypes::StagedResource staged(EResourceType::Texture, pPath);
+			if (stageFromArchive(staged)) return new ResourceTypes::__LocalResource<T>(getRenderer(), staged, pArgs...);
+			return new ResourceTypes::__LocalResource<T>(getRenderer(), pPath, pArgs...);
+		}
+
+		//! Retrieve a background load that is in progress for a specific ID
+		std::shared_ptr<ResourceTypes::IAsyncResourceBase> getPendingLoad(const size_t& pID) const;
+
+		//! Pass a background load to the worker threads
+		void beginLoad(std::shared_ptr<ResourceTypes::IAsyncResourceBase> pLoad);
+
+		//! Create the handle for a background load, reusing existing resources and loads where possible
+		template<typename T>
+		AsyncResource<T> queueLoad(const char* pPath, const size_t& pID, const std::function<ResourceTypes::__LocalResource<T>*(ResourceTypes::StagedResource&)>& pCreate) {
+			//Check for a load already in progress
+			if (auto pending = getPendingLoad(pID)) return std::dynamic_pointer_cast<ResourceTypes::__AsyncResource<T>>(pending);
+
+			//Create the new handle
+			AsyncResource<T> load = AsyncResource<T>(new ResourceTypes::__AsyncResource<T>(pPath, pID, pCreate));
+
+			//Check for an existing resource
+			if (auto res = getResource(pID)) load->resolve(std::dynamic_pointer_cast<ResourceTypes::__LocalResource<T>>(res));
+
+			//Otherwise give it to the workers
+			else beginLoad(load);
+
+			//Return the handle
+			return load;
+		}
+
+		//! Scramble the bits of a value so that similar values produce distant hashes
+		static inline uint64_t mixBits(uint64_t pValue) {
+			pValue = (pValue ^ (pValue >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			pValue = (pValue ^ (pValue >> 27)) * 0x94D049BB133111EBULL;
+			return pValue ^ (pValue >> 31);
+		}
+
+		//! Hash a null terminated string by its contents (FNV-1a)
+		static inline uint64_t hashValue(const char* pValue) {
+			uint64_t hash = 14695981039346656037ULL;
+			if (pValue) for (; *pValue; ++pValue) hash = (hash ^ (unsigned char)*pValue) * 1099511628211ULL;
+			return hash;
+		}
+		static inline uint64_t hashValue(const std::string& pValue) { return hashValue(pValue.c_str()); }
+
+		//! Hash integral and enumeration values by value, so the width of the type doesn't change the key
+		template<typename T>
+		static inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, uint64_t>::type hashValue(const T& pValue) { return mixBits((uint64_t)pValue); }
+
+		//! Hash floating point values by their value as a double
+		template<typename T>
+		static inline typename std::enable_if<std::is_floating_point<T>::value, uint64_t>::type hashValue(const T& pValue) {
+			const double VALUE = (pValue == 0 ? 0.0 : (double)pValue);
+			uint64_t bits;
+			memcpy(&bits, &VALUE, sizeof(bits));
+			return mixBits(bits);
+		}
 
-		//! Store data in an output stream
+		//! Combine the hashes of a series of values with a key
 		template<typename T, typename ... TArgs>
-		static void compileStream(std::ostream& pStream, const T& pFirst, const TArgs& ... pArgs) {
-			pStream << pFirst;
-			compileStream(pStream, pArgs...);
+		static inline uint64_t combineHashes(const uint64_t& pKey, const T& pFirst, const TArgs& ... pArgs) {
+			const uint64_t VALUE = hashValue(pFirst);
+			return combineHashes(pKey ^ (VALUE + 0x9E3779B97F4A7C15ULL + (pKey << 6) + (pKey >> 2)), pArgs...);
 		}
-		inline static void compileStream(std::ostream& pStream) {}
+		static inline uint64_t combineHashes(const uint64_t& pKey) { return pKey; }
 	};
 }
\ No newline at end of file
@@ -11,13 +11,13 @@ namespace SDL2_Engine {
 		typedef unsigned char renderOrder;
 
 		//! Export the required Bitmask implementation
-		template class SDL2_LIB_INC Utilities::Bitmask<ESceneProperties>;
+		SDL2_LIB_TEMPLATE(Utilities::Bitmask<ESceneProperties>);
 
 		/*
 		 *		Name: ISceneBase
 		 *		Author: Mitchell Croft
 		 *		Created: 11/10/2017
-		 *		Modified: 11/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Provide an interface for Base Scenes to implement from
@@ -65,6 +65,17 @@ namespace SDL2_Engine {
 			*/
 			inline virtual void update() {}
 
+			/*
+				ISceneBase : fixedUpdate - Function to facilitate the updating of values once per fixed time step
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				NOTE:
+				Only called when the main loop is initialised with ELoopMode::Fixed. Called zero or more
+				times per cycle, before update, with Time::getFixedDelta seconds of simulation each
+			*/
+			inline virtual void fixedUpdate() {}
+
 			/*
 				ISceneBase : render - Function to facilitate the rendering of images once per cycle
 				Created: 11/10/2017
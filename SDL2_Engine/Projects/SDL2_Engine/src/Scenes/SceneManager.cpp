@@ -7,6 +7,7 @@
 //! Include the SDL2_Engine values
 #include "../Globals.hpp"
 #include "../Debug/Logger.hpp"
+#include "../Time.hpp"
 #include "SceneManagerInitialiser.hpp"
 #include "ISceneBase.hpp"
 
@@ -239,7 +240,7 @@ namespace SDL2_Engine {
 		/*
 			SceneManager : update - Update and render the contained Scenes
 			Created: 11/10/2017
-			Modified: 02/11/2017
+			Modified: 16/10/2026
 		*/
 		void SceneManager::update() {
 			//Loop through existing currently active scenes
@@ -296,6 +297,25 @@ namespace SDL2_Engine {
 			//Sort remaining Scenes
 			std::stable_sort(mData->activeScenes.begin(), mData->activeScenes.end());
 
+			//Process the fixed time steps that have accumulated
+			if (Globals::interfaceExists<Time>()) {
+				Time& time = Globals::get<Time>();
+				while (time.stepFixed()) {
+					//Flag if there is a priority Scene in the list
+					bool priorityFlag = false;
+					for (size_t i = 0, COUNT = mData->activeScenes.size(); i < COUNT; ++i) {
+						//Check if has priority
+						if (mData->activeScenes[i]->mProperties & ESceneProperties::Priority) priorityFlag = true;
+
+						//Otherwise check if priority has preceded it
+						else if (priorityFlag) break;
+
+						//Step the Scene
+						mData->activeScenes[i]->fixedUpdate();
+					}
+				}
+			}
+
 			//Flag if there is a priority Scene in the list
 			bool priorityFlag = false;
 			for (size_t i = 0, COUNT = mData->activeScenes.size(); i < COUNT; ++i) {
@@ -5,6 +5,9 @@
 #include "../Utilities/IGlobal.hpp"
 #include "../Utilities/TypeID.hpp"
 
+//! Include the type trait checks used to validate template types
+#include <type_traits>
+
 namespace SDL2_Engine {
 	//! Prototype the Scene Manager Initialiser object
 	namespace Initialisation { struct SceneManagerInitialiser; }
@@ -1,35 +1,96 @@
 #include "Time.hpp"
 
+//! Include the Clock objects
+#include "Utilities/Clock.hpp"
+
+//! Include the math functions
+#include <cmath>
+
+//! Define the fraction of a fixed step that can be missing for the step to still be processed
+#define FIXED_STEP_TOLERANCE 1e-4f
+
 namespace SDL2_Engine {
+	/*
+		Time : setFixedStep - Set the size of the fixed steps that accumulated time is processed in
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		param[in] pStep - The number of seconds of scaled time processed by each step (0 disables fixed steps)
+		param[in] pMaxSteps - The maximum number of steps processed in one update before time is discarded (Default 5)
+	*/
+	void Time::setFixedStep(const float& pStep, const unsigned int& pMaxSteps /*= 5*/) noexcept {
+		mFixedStep = (pStep > 0.f ? pStep : 0.f);
+		mMaxSteps = (pMaxSteps ? pMaxSteps : 1);
+		mAccumulator = mInterpolation = 0.f;
+		mStepsTaken = 0;
+	}
+
+	/*
+		Time : stepFixed - Consume a fixed step from the accumulated time
+		Created: 16/10/2026
+		Modified: 16/10/2026
+
+		return bool - Returns true if a step was consumed and should be simulated
+	*/
+	bool Time::stepFixed() noexcept {
+		//Check there is a full step to process, allowing for rounding error in the accumulated deltas
+		if (mFixedStep <= 0.f || mAccumulator < mFixedStep * (1.f - FIXED_STEP_TOLERANCE)) return false;
+
+		//Discard whole steps that can't be processed this update to prevent the simulation falling further behind
+		if (mStepsTaken >= mMaxSteps) {
+			mAccumulator = fmodf(mAccumulator, mFixedStep);
+			mInterpolation = mAccumulator / mFixedStep;
+			return false;
+		}
+
+		//Consume the step
+		mAccumulator = (mAccumulator > mFixedStep ? mAccumulator - mFixedStep : 0.f);
+		mInterpolation = mAccumulator / mFixedStep;
+		++mStepsTaken;
+		return true;
+	}
+
 	/*
 		Time : Constructor - Initialise with default values
 		Created: 19/07/2017
-		Modified: 22/09/2017
+		Modified: 16/10/2026
+
+		param[in] pClock - A pointer to the clock that time is read from, ownership is taken by the Time object (Default nullptr, uses a SteadyClock)
 	*/
-	Time::Time() :
+	Time::Time(Utilities::IClock* pClock /*= nullptr*/) :
+		//Store the clock
+		mClock(pClock ? pClock : new Utilities::SteadyClock()),
+
 		//Default the time values
 		mDeltaTime(0.f), mRealDeltaTime(0.f),
 		mElapsedTime(0.f), mRealElapsedTime(0.f),
-		mTimeScale(1.f)	{
-	
-		//Get the performance frequency of the CPU
-		QueryPerformanceFrequency(&mPerformanceFreq);
+		mTimeScale(1.f),
+		mFixedStep(0.f), mAccumulator(0.f), mInterpolation(0.f),
+		mMaxSteps(0), mStepsTaken(0),
+		mFrameBudget(0.f), mFrameWork(0.f) {
 
 		//Get the Starting time
-		QueryPerformanceCounter(&mStartTime);
+		mStartTime = mClock->now();
 	}
 
+	/*
+		Time : Destructor - Delete the clock that time is read from
+		Created: 16/10/2026
+		Modified: 16/10/2026
+	*/
+	Time::~Time() { delete mClock; }
+
 	/*
 		Time : update - Update the internal time values
 		Created: 19/07/2017
-		Modified: 06/10/2017
+		Modified: 16/10/2026
 	*/
 	void Time::update() {
 		//Get the finishing time
-		QueryPerformanceCounter(&mEndTime);
+		const Utilities::clockTicks END_TIME = mClock->now();
 
 		//Calculate the real delta time
-		mRealDeltaTime = (mEndTime.QuadPart - mStartTime.QuadPart) / (float)mPerformanceFreq.QuadPart;
+		mRealDeltaTime = (float)mClock->toSeconds(END_TIME - mStartTime);
 
 		//Cap the real delta time to 1
 		mRealDeltaTime = (mRealDeltaTime < 1.f ? mRealDeltaTime : 1.f);
@@ -41,7 +102,14 @@ namespace SDL2_Engine {
 		mElapsedTime += mDeltaTime;
 		mRealElapsedTime += mRealDeltaTime;
 
-		//Store the new start time
-		QueryPerformanceCounter(&mStartTime);
+		//Accumulate the time to be processed in fixed steps
+		if (mFixedStep > 0.f) {
+			mAccumulator += mDeltaTime;
+			mInterpolation = mAccumulator / mFixedStep;
+			mStepsTaken = 0;
+		}
+
+		//The end of this cycle is the start of the next
+		mStartTime = END_TIME;
 	}
 }
\ No newline at end of file
@@ -6,19 +6,27 @@
 //! Include the Singleton interface
 #include "Utilities/IGlobal.hpp"
 
-//! Include time-keeping values 
-#include <windows.h>
-
 namespace SDL2_Engine {
+	//! Prototype the Clock interface
+	namespace Utilities { class IClock; }
+
 	/*
 	 *		Name: Time
 	 *		Author: Mitchell Croft
 	 *		Created: 19/07/2017
-	 *		Modified: 06/10/2017
+	 *		Modified: 16/10/2026
 	 *		
 	 *		Purpose:
 	 *		Track changes in time over the course of the programs
 	 *		execution
+	 *
+	 *		Notes:
+	 *		When a fixed time step is set, scaled time is accumulated each update
+	 *		and consumed in whole steps through stepFixed. The remaining fraction
+	 *		of a step is exposed as an interpolation value for rendering.
+	 *
+	 *		Time is read from an IClock, defaulting to a SteadyClock. A VirtualClock
+	 *		can be supplied for deterministic tests and headless simulations
 	**/
 	class SDL2_LIB_INC Time : public Utilities::IGlobal {
 	public:
@@ -71,6 +79,60 @@ namespace SDL2_Engine {
 		*/
 		inline const float& getScale() const noexcept { return mTimeScale; }
 
+		/*
+			Time : getFixedDelta - Get the amount of scaled time processed by each fixed step
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const float& - Returns the fixed step size as a constant float reference (in seconds, 0 if disabled)
+		*/
+		inline const float& getFixedDelta() const noexcept { return mFixedStep; }
+
+		/*
+			Time : getAccumulator - Get the amount of scaled time that has not yet been processed by a fixed step
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const float& - Returns the accumulated time as a constant float reference (in seconds)
+		*/
+		inline const float& getAccumulator() const noexcept { return mAccumulator; }
+
+		/*
+			Time : getInterpolation - Get the fraction of a fixed step that has accumulated but not been processed
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const float& - Returns the interpolation alpha as a constant float reference (0 - 1)
+		*/
+		inline const float& getInterpolation() const noexcept { return mInterpolation; }
+
+		/*
+			Time : getFrameBudget - Get the amount of time each frame is given by the frame limiter
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const float& - Returns the frame budget as a constant float reference (in seconds, 0 if unlimited)
+		*/
+		inline const float& getFrameBudget() const noexcept { return mFrameBudget; }
+
+		/*
+			Time : getFrameWork - Get the amount of time the last frame spent processing, excluding time spent waiting
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return const float& - Returns the frame processing time as a constant float reference (in seconds)
+		*/
+		inline const float& getFrameWork() const noexcept { return mFrameWork; }
+
+		/*
+			Time : getClock - Get the clock that time is read from
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return Utilities::IClock& - Returns a reference to the clock used by the Time object
+		*/
+		inline Utilities::IClock& getClock() noexcept { return *mClock; }
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////-------------------------------------Set Time Values---------------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +146,47 @@ namespace SDL2_Engine {
 		*/
 		inline void setScale(const float& pScl) noexcept { mTimeScale = (pScl > 0.f ? pScl : 0.f); }
 
+		/*
+			Time : setFixedStep - Set the size of the fixed steps that accumulated time is processed in
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStep - The number of seconds of scaled time processed by each step (0 disables fixed steps)
+			param[in] pMaxSteps - The maximum number of steps processed in one update before time is discarded (Default 5)
+		*/
+		void setFixedStep(const float& pStep, const unsigned int& pMaxSteps = 5) noexcept;
+
+		/*
+			Time : setFrameRate - Set the frame rate that the frame budget is calculated from
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pFrameRate - The number of frames per second being targeted (0 for unlimited)
+		*/
+		inline void setFrameRate(const unsigned int& pFrameRate) noexcept { mFrameBudget = (pFrameRate ? 1.f / (float)pFrameRate : 0.f); }
+
+		/*
+			Time : recordFrameWork - Store the amount of time the last frame spent processing
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeconds - The number of seconds spent processing the frame
+		*/
+		inline void recordFrameWork(const float& pSeconds) noexcept { mFrameWork = pSeconds; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////-----------------------------------Fixed Time Steps----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			Time : stepFixed - Consume a fixed step from the accumulated time
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return bool - Returns true if a step was consumed and should be simulated
+		*/
+		bool stepFixed() noexcept;
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
 		////////--------------------------------Construction/Destruction-----------------------------////////
 		/////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,9 +194,22 @@ namespace SDL2_Engine {
 		/*
 			Time : Constructor - Initialise with default values
 			Created: 19/07/2017
-			Modified: 22/09/2017
+			Modified: 16/10/2026
+
+			param[in] pClock - A pointer to the clock that time is read from, ownership is taken by the Time object (Default nullptr, uses a SteadyClock)
 		*/
-		Time();
+		Time(Utilities::IClock* pClock = nullptr);
+
+		/*
+			Time : Destructor - Delete the clock that time is read from
+			Created: 16/10/2026
+			Modified: 16/10/2026
+		*/
+		~Time();
+
+		//! Prevent copying of the Time object
+		Time(const Time&) = delete;
+		Time& operator=(const Time&) = delete;
 
 		/*
 			Time : createInterface - Blank function, no setup required for the Time object
@@ -118,16 +234,16 @@ namespace SDL2_Engine {
 		/*
 			Time : update - Update the internal time values
 			Created: 19/07/2017
-			Modified: 06/10/2017
+			Modified: 16/10/2026
 		*/
 		void update() override;
 
 	public:
-		//! Store the performance frequency of the CPU
-		LARGE_INTEGER mPerformanceFreq;
+		//! Store the clock that time is read from
+		Utilities::IClock* mClock;
 
-		//! Store the start and end times for tracking delta time
-		LARGE_INTEGER mStartTime, mEndTime;
+		//! Store the clock reading at the start of the current cycle
+		unsigned long long mStartTime;
 
 		//! Store the various delta time values
 		float mDeltaTime, mRealDeltaTime;
@@ -137,5 +253,12 @@ namespace SDL2_Engine {
 
 		//! Store the scale applied to the passage of time
 		float mTimeScale;
+
+		//! Store the fixed step values
+		float mFixedStep, mAccumulator, mInterpolation;
+		unsigned int mMaxSteps, mStepsTaken;
+
+		//! Store the frame pacing values
+		float mFrameBudget, mFrameWork;
 	};
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "Canvas.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "../Utilities/Portability.hpp"
+
 //! Include the SDL2_Engine objects
 #include "../Globals.hpp"
 #include "../Debug/Logger.hpp"
@@ -24,6 +27,9 @@
 //! Include the required STL containers
 #include <vector>
 
+//! Include the integer limits used to find the area covered by elements
+#include <climits>
+
 //! Include GLM vector functions
 #include <glm/ext.hpp>
 
@@ -35,6 +41,9 @@
 //! Flag the different possible movement directions
 enum { Up, Down, Left, Right, Total };
 
+//! Define the maximum number of columns and rows in the grid used to find elements under the mouse
+#define MAX_GRID_DIMENSION 64
+
 namespace SDL2_Engine {
 	namespace UI {
 		/*
@@ -114,7 +123,7 @@ namespace SDL2_Engine {
 		 *		Name: InteractiveUINode
 		 *		Author: Mitchell Croft
 		 *		Created: 12/10/2017
-		 *		Modified: 15/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Manage a network of UI elements that can be interacted with by the user
@@ -123,22 +132,218 @@ namespace SDL2_Engine {
 			//! Store a pointer to current interactive element
 			UIElements::IUIAction* element;
 
+			//! Store the element as its UI base, so its location can be read without casting
+			UIElements::IUIBase* base;
+
 			//! Store the cardinal directions 
 			InteractiveUINode* connections[Total];
 
 			/*
 				InteractiveUINode : Constructor - Initialise with default values
 				Created: 15/10/2017
-				Modified: 15/10/2017
+				Modified: 16/10/2026
+			*/
+			inline InteractiveUINode() : element(nullptr), base(nullptr) { connections[Up] = connections[Down] = connections[Left] = connections[Right] = nullptr; }
+		};
+
+		/*
+		 *		Name: InteractiveUIGrid
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *		
+		 *		Purpose:
+		 *		Index the bounds of the Interactive UI Nodes in a uniform grid, so that the element
+		 *		under a point is found by testing only the elements that overlap its cell
+		 *
+		 *		Notes:
+		 *		The cells are sized to the average element, so each element overlaps few cells. The
+		 *		elements of each cell are stored in map order, so the first element containing a point
+		 *		is the same one the interactive map would find
+		**/
+		struct InteractiveUIGrid {
+			//! Store the screen position of the first cell and the size of each cell (in pixels)
+			glm::ivec2 origin, cellSize;
+
+			//! Store the number of columns and rows of cells
+			glm::ivec2 dimensions;
+
+			//! Store the offset of each cell's first entry, followed by the total number of entries
+			std::vector<unsigned int> cellStart;
+
+			//! Store the indices of the Interactive UI Nodes that overlap each cell
+			std::vector<unsigned int> entries;
+
+			//! Store the locations of the Interactive UI Nodes when they were indexed
+			std::vector<UIElements::UIBounds> indexed;
+
+			//! Store the position each cell is filled from while building
+			std::vector<unsigned int> next;
+
+			//! Store the UI element location version the grid was last checked at
+			unsigned int version;
+
+			/*
+				InteractiveUIGrid : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			inline InteractiveUIGrid() : origin(0), cellSize(1), dimensions(0), version(0) {}
+
+			/*
+				InteractiveUIGrid : clear - Remove all elements from the grid
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			inline void clear() {
+				dimensions = glm::ivec2(0);
+				cellStart.clear();
+				entries.clear();
+				indexed.clear();
+			}
+
+			/*
+				InteractiveUIGrid : cellRange - Get the range of cells that a set of bounds overlaps
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pBounds - The bounds to find the cells of
+				param[out] pMin - Receives the column and row of the first cell
+				param[out] pMax - Receives the column and row of the last cell
+			*/
+			inline void cellRange(const UIElements::UIBounds& pBounds, glm::ivec2& pMin, glm::ivec2& pMax) const {
+				pMin = glm::clamp((glm::ivec2(pBounds.x, pBounds.y) - origin) / cellSize, glm::ivec2(0), dimensions - 1);
+				pMax = glm::clamp((glm::ivec2(pBounds.xMax(), pBounds.yMax()) - origin) / cellSize, glm::ivec2(0), dimensions - 1);
+			}
+
+			/*
+				InteractiveUIGrid : build - Index the current locations of the Interactive UI Nodes
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pNodes - The array of Interactive UI Nodes to index
+				param[in] pCount - The number of Nodes in the array
+			*/
+			void build(const InteractiveUINode* pNodes, const size_t& pCount) {
+				//Clear the previous index
+				clear();
+				version = UIElements::IUIBase::locationVersion();
+
+				//Find the area covered by the elements and their average size, skipping those that can't contain a point
+				glm::ivec2 minimum(INT_MAX), maximum(INT_MIN);
+				glm::dvec2 total(0.0);
+				size_t count = 0;
+				indexed.resize(pCount);
+				for (size_t i = 0; i < pCount; i++) {
+					const UIElements::UIBounds& LOC = indexed[i] = pNodes[i].base->getLocation();
+					if (LOC.w < 0 || LOC.h < 0) continue;
+					minimum = glm::min(minimum, glm::ivec2(LOC.x, LOC.y));
+					maximum = glm::max(maximum, glm::ivec2(LOC.xMax(), LOC.yMax()));
+					total += glm::dvec2(LOC.w + 1, LOC.h + 1);
+					++count;
+				}
+
+				//Check there are elements to index
+				if (!count) return;
+
+				//Size the cells to the average element, limiting the number of cells
+				const glm::ivec2 EXTENT = maximum - minimum + 1;
+				origin = minimum;
+				cellSize = glm::max(glm::ivec2(total / (double)count), glm::ivec2(1));
+				cellSize = glm::max(cellSize, (EXTENT + MAX_GRID_DIMENSION - 1) / MAX_GRID_DIMENSION);
+				dimensions = (EXTENT + cellSize - 1) / cellSize;
+
+				//Count the number of elements overlapping each cell
+				cellStart.assign((size_t)(dimensions.x * dimensions.y) + 1, 0);
+				glm::ivec2 first, last;
+				for (size_t i = 0; i < pCount; i++) {
+					const UIElements::UIBounds& LOC = indexed[i];
+					if (LOC.w < 0 || LOC.h < 0) continue;
+					cellRange(LOC, first, last);
+					for (int y = first.y; y <= last.y; y++) {
+						for (int x = first.x; x <= last.x; x++)
+							++cellStart[(size_t)(y * dimensions.x + x) + 1];
+					}
+				}
+
+				//Convert the counts to offsets
+				for (size_t i = 1; i < cellStart.size(); i++)
+					cellStart[i] += cellStart[i - 1];
+
+				//Fill the cells in map order
+				entries.resize(cellStart.back());
+				next.assign(cellStart.begin(), cellStart.end() - 1);
+				for (size_t i = 0; i < pCount; i++) {
+					const UIElements::UIBounds& LOC = indexed[i];
+					if (LOC.w < 0 || LOC.h < 0) continue;
+					cellRange(LOC, first, last);
+					for (int y = first.y; y <= last.y; y++) {
+						for (int x = first.x; x <= last.x; x++)
+							entries[next[(size_t)(y * dimensions.x + x)]++] = (unsigned int)i;
+					}
+				}
+			}
+
+			/*
+				InteractiveUIGrid : refresh - Rebuild the index if any of the Interactive UI Nodes have moved
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pNodes - The array of Interactive UI Nodes that was indexed
+				param[in] pCount - The number of Nodes in the array
+
+				NOTE:
+				This is only needed when the UI element location version has changed. As any UI element
+				moving changes the version, the indexed locations are compared before rebuilding
 			*/
-			inline InteractiveUINode() : element(nullptr) { connections[Up] = connections[Down] = connections[Left] = connections[Right] = nullptr; }
+			void refresh(const InteractiveUINode* pNodes, const size_t& pCount) {
+				//Store the version that has been checked
+				version = UIElements::IUIBase::locationVersion();
+
+				//Rebuild the index if any location is different
+				for (size_t i = 0; i < pCount; i++) {
+					const UIElements::UIBounds& LOC = pNodes[i].base->getLocation();
+					const UIElements::UIBounds& OLD = indexed[i];
+					if (LOC.x != OLD.x || LOC.y != OLD.y || LOC.w != OLD.w || LOC.h != OLD.h) {
+						build(pNodes, pCount);
+						return;
+					}
+				}
+			}
+
+			/*
+				InteractiveUIGrid : find - Find the first Interactive UI Node containing a point
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pNodes - The array of Interactive UI Nodes that was indexed
+				param[in] pX - The X coordinate of the point
+				param[in] pY - The Y coordinate of the point
+
+				return int - Returns the index of the Node or -1 if no element contains the point
+			*/
+			int find(const InteractiveUINode* pNodes, const int& pX, const int& pY) const {
+				//Find the cell containing the point
+				const glm::ivec2 OFFSET = glm::ivec2(pX, pY) - origin;
+				if (OFFSET.x < 0 || OFFSET.y < 0) return -1;
+				const glm::ivec2 CELL = OFFSET / cellSize;
+				if (CELL.x >= dimensions.x || CELL.y >= dimensions.y) return -1;
+
+				//Test the elements overlapping the cell
+				const size_t INDEX = (size_t)(CELL.y * dimensions.x + CELL.x);
+				for (unsigned int i = cellStart[INDEX]; i < cellStart[INDEX + 1]; i++) {
+					if (pNodes[entries[i]].base->getLocation().contains(pX, pY))
+						return (int)entries[i];
+				}
+				return -1;
+			}
 		};
 
 		/*
 		 *		Name: CanvasInternalData
 		 *		Author: Mitchell Croft
 		 *		Created: 12/10/2017
-		 *		Modified: 16/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Store internal Canvas data values
@@ -156,6 +361,9 @@ namespace SDL2_Engine {
 			//! Track how many elements are in the interactive map
 			size_t mapSize;
 
+			//! Index the locations of the elements in the interactive map
+			InteractiveUIGrid interactiveGrid;
+
 			//! Flag the index of the currently selected object
 			int selectedAction;
 
@@ -167,6 +375,11 @@ namespace SDL2_Engine {
 			Input::vAxisName verticalAxis;
 			Input::vAxisName confirmAxis;
 
+			//! Store the Axis Input handles of the navigation axis
+			Input::vAxisHandle horizontalHandle;
+			Input::vAxisHandle verticalHandle;
+			Input::vAxisHandle confirmHandle;
+
 			//! Store the callbacks used for loading UI elements
 			Utilities::Action<UIElements::IUIBase*(const Objx::Node& pObj)> customLoadUI;
 			Utilities::Action<void(UIElements::IUIAction* pObject, const uiTag& pTag)> actionSetup;
@@ -177,11 +390,30 @@ namespace SDL2_Engine {
 			/*
 				CanvasInternalData : Constructor - Initialise with default values
 				Created: 13/10/2017
-				Modified: 16/10/2017
+				Modified: 16/10/2026
 
 				param[in] pSetup - The CanvasInitialiser object to copy the values of
 			*/
-			inline CanvasInternalData(const Initialisation::CanvasInitialiser& pSetup) : setup(&pSetup), interactiveMap(nullptr), mapSize(0), selectedAction(-1) {}
+			inline CanvasInternalData(const Initialisation::CanvasInitialiser& pSetup) : setup(&pSetup), interactiveMap(nullptr), mapSize(0), selectedAction(-1), horizontalHandle(Input::INVALID_AXIS_HANDLE), verticalHandle(Input::INVALID_AXIS_HANDLE), confirmHandle(Input::INVALID_AXIS_HANDLE) {}
+
+			/*
+				CanvasInternalData : findAction - Find the interactive element containing a point
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pX - The X coordinate of the point
+				param[in] pY - The Y coordinate of the point
+
+				return int - Returns the index of the element in the interactive map or -1 if there is none
+
+				NOTE:
+				The grid is refreshed first if any UI element has been moved since it was last checked
+			*/
+			int findAction(const int& pX, const int& pY) {
+				if (!mapSize) return -1;
+				if (interactiveGrid.version != UIElements::IUIBase::locationVersion()) interactiveGrid.refresh(interactiveMap, mapSize);
+				return interactiveGrid.find(interactiveMap, pX, pY);
+			}
 		};
 
 		/*
@@ -260,12 +492,27 @@ namespace SDL2_Engine {
 		/*
 			Canvas : getActionObject - Get the currently active interactive object
 			Created: 11/11/2017
-			Modified: 11/11/2017
+			Modified: 16/10/2026
 	
 			return IUIBase* - Returns a pointer to a IUIBase object or nullptr if no active object
 		*/
 		UIElements::IUIBase* Canvas::getActionObject() {
-			return (mData->selectedAction == -1 ? nullptr : dynamic_cast<UIElements::IUIBase*>(mData->interactiveMap[mData->selectedAction].element));
+			return (mData->selectedAction == -1 ? nullptr : mData->interactiveMap[mData->selectedAction].base);
+		}
+
+		/*
+			Canvas : getActionObjectAt - Get the interactive object at a screen position
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pX - The X coordinate of the position
+			param[in] pY - The Y coordinate of the position
+
+			return IUIBase* - Returns a pointer to the first interactive object containing the position or nullptr if there is none
+		*/
+		UIElements::IUIBase* Canvas::getActionObjectAt(const int& pX, const int& pY) {
+			const int INDEX = mData->findAction(pX, pY);
+			return (INDEX == -1 ? nullptr : mData->interactiveMap[INDEX].base);
 		}
 
 		/*
@@ -479,14 +726,14 @@ namespace SDL2_Engine {
 		/*
 			Canvas : rebuildInteractionMap - Rebuild the internal interaction map to allow for users to navigate Actionable UI elements
 			Created: 13/10/2017
-			Modified: 02/11/2017
+			Modified: 16/10/2026
 		*/
 		void Canvas::rebuildInteractionMap() {
 			//Clear the previous map
 			destroyInteractiveMap();
 
 			//Store the indexes of Action elements
-			std::vector<UIElements::IUIAction*> interactable;
+			std::vector<UIElements::IUIBase*> interactable;
 			interactable.reserve(mData->uiElements.size());
 
 			//Calculate how many elements are in interactable
@@ -495,8 +742,8 @@ namespace SDL2_Engine {
 				if (!mData->uiElements[i]->isAlive()) continue;
 
 				//Check if this is interactable
-				if (auto pointer = dynamic_cast<UIElements::IUIAction*>(mData->uiElements[i]))
-					interactable.push_back(pointer);
+				if (dynamic_cast<UIElements::IUIAction*>(mData->uiElements[i]))
+					interactable.push_back(mData->uiElements[i]);
 			}
 
 			//Check if there are any interactable elements
@@ -509,13 +756,18 @@ namespace SDL2_Engine {
 			mData->interactiveMap = new InteractiveUINode[mData->mapSize];
 
 			//Store the Action elements in the map
-			for (size_t i = 0; i < mData->mapSize; i++)
-				mData->interactiveMap[i].element = interactable[i];
+			for (size_t i = 0; i < mData->mapSize; i++) {
+				mData->interactiveMap[i].element = dynamic_cast<UIElements::IUIAction*>(interactable[i]);
+				mData->interactiveMap[i].base = interactable[i];
+			}
+
+			//Index the locations of the elements
+			mData->interactiveGrid.build(mData->interactiveMap, mData->mapSize);
 
 			//Setup the connections between the Nodes
 			for (size_t i = 0; i < mData->mapSize; i++) {
 				//Store the location of current
-				const UIElements::UIBounds& posI = dynamic_cast<UIElements::IUIBase*>(mData->interactiveMap[i].element)->getLocation();
+				const UIElements::UIBounds& posI = mData->interactiveMap[i].base->getLocation();
 
 				//Track the distances between all other UI elements
 				InteractiveUINode* nodes[Total];
@@ -528,7 +780,7 @@ namespace SDL2_Engine {
 					if (i == j) continue;
 
 					//Get the position of this other
-					const UIElements::UIBounds& posJ = dynamic_cast<UIElements::IUIBase*>(mData->interactiveMap[j].element)->getLocation();
+					const UIElements::UIBounds& posJ = mData->interactiveMap[j].base->getLocation();
 
 					//Store temporary distance values
 					const glm::vec2 SEP_VEC = posJ.distance(posI);
@@ -581,7 +833,7 @@ namespace SDL2_Engine {
 		/*
 			Canvas : createInterface - Verify and setup starting information
 			Created: 12/10/2017
-			Modified: 16/10/2017
+			Modified: 16/10/2026
 
 			return bool - Returns true if the Canvas was setup correctly
 		*/
@@ -601,13 +853,19 @@ namespace SDL2_Engine {
 			
 			//Retrieve the Logger and Axis Input objects
 			const Debug::Logger& LOG = Globals::get<Debug::Logger>();
-			const Input::AxisInput AXIS = Globals::get<Input::AxisInput>();
+			Input::AxisInput& AXIS = Globals::get<Input::AxisInput>();
+
+			//Resolve the handles of the navigation axis
+			mData->horizontalHandle = AXIS.getHandle(mData->horizontalAxis.c_str());
+			mData->verticalHandle = AXIS.getHandle(mData->verticalAxis.c_str());
+			mData->confirmHandle = AXIS.getHandle(mData->confirmAxis.c_str());
 
 			//Check to see if the Axis names are present
+			const Input::vAxisName* AXIS_NAMES[] = { &mData->horizontalAxis, &mData->verticalAxis, &mData->confirmAxis };
 			for (size_t i = 0; i < 3; i++) {
 				//Check if the name exists
-				if (!AXIS.hasAxis(setup->axisArray[i].c_str()))
-					LOG.logWarning("Canvas object was given the as yet undefined Virtual Axis '%s' to use for player input navigation", setup->axisArray[i].c_str());
+				if (!AXIS.hasAxis(AXIS_NAMES[i]->c_str()))
+					LOG.logWarning("Canvas object was given the as yet undefined Virtual Axis '%s' to use for player input navigation", AXIS_NAMES[i]->c_str());
 			}
 
 			//Return success
@@ -1113,7 +1371,7 @@ namespace SDL2_Engine {
 		/*
 			Canvas : updateActionUI - Update the Actionable UI elements
 			Created: 13/10/2017
-			Modified: 16/10/2017
+			Modified: 16/10/2026
 		*/
 		void Canvas::updateActionUI() {
 			//Update all of the Actionable elements
@@ -1129,24 +1387,8 @@ namespace SDL2_Engine {
 
 				//Check if the position has changed
 				if (newPos != mData->prevPos) {
-					//Reset the selected item index
-					mData->selectedAction = -1;
-
-					//Loop through and see if the mouse overlaps any UI element
-					UIElements::IUIBase* buffer = nullptr;
-					for (size_t i = 0; i < mData->mapSize; i++) {
-						//Get the element
-						buffer = dynamic_cast<UIElements::IUIBase*>(mData->interactiveMap[i].element);
-
-						//Check if contains mouse
-						if (buffer->getLocation().contains(newPos.x, newPos.y)) {
-							//Set the selected item index
-							mData->selectedAction = (int)i;
-
-							//Break the search
-							break;
-						}
-					}
+					//Select the element the mouse is over, if any
+					mData->selectedAction = mData->findAction(newPos.x, newPos.y);
 
 					//Save the new position
 					mData->prevPos = newPos;
@@ -1155,8 +1397,8 @@ namespace SDL2_Engine {
 				//Rely on Axis input 
 				else {
 					//Get the axis inputs
-					float horizontal = (IN.btnPressed(mData->horizontalAxis.c_str()) ? IN.getAxis(mData->horizontalAxis.c_str()) : 0.f);
-					float vertical = (IN.btnPressed(mData->verticalAxis.c_str()) ? IN.getAxis(mData->verticalAxis.c_str()) : 0.f);
+					float horizontal = (IN.btnPressed(mData->horizontalHandle) ? IN.getAxis(mData->horizontalHandle) : 0.f);
+					float vertical = (IN.btnPressed(mData->verticalHandle) ? IN.getAxis(mData->verticalHandle) : 0.f);
 
 					//Check there was input
 					if (horizontal || vertical) {
@@ -1192,15 +1434,12 @@ namespace SDL2_Engine {
 				//Check for selection of UI element
 				if (mData->selectedAction >= 0) {
 					//Flag the action should be run
-					bool takeAction = IN.btnPressed(mData->confirmAxis.c_str());
+					bool takeAction = IN.btnPressed(mData->confirmHandle);
 
 					//Check if the mouse should be considered
 					if (!takeAction && MOUSE.buttonPressed(Input::EMouseButton::Left)) {
-						//Get the selected object
-						UIElements::IUIBase* buffer = dynamic_cast<UIElements::IUIBase*>(mData->interactiveMap[mData->selectedAction].element);
-
 						//Take action if clicked while in UI bounds
-						takeAction = buffer->getLocation().contains(newPos.x, newPos.y);
+						takeAction = mData->interactiveMap[mData->selectedAction].base->getLocation().contains(newPos.x, newPos.y);
 					}
 
 					//Call the action of the UI element
@@ -1212,7 +1451,7 @@ namespace SDL2_Engine {
 		/*
 			Canvas :destroyInteractiveMap - Clear up memory associated with the interactive map
 			Created: 13/10/2017
-			Modified: 13/10/2017
+			Modified: 16/10/2026
 		*/
 		void Canvas::destroyInteractiveMap() {
 			//Check if the map exists
@@ -1224,6 +1463,7 @@ namespace SDL2_Engine {
 				mData->interactiveMap = nullptr;
 				mData->mapSize = 0;
 				mData->selectedAction = -1;
+				mData->interactiveGrid.clear();
 			}
 		}
 	}
@@ -5,6 +5,9 @@
 #include "../Utilities/IGlobal.hpp"
 #include "UIElements/UIValues.hpp"
 
+//! Include the type trait checks used to validate template types
+#include <type_traits>
+
 //! Prototype the Objx Node
 namespace Objx { class Node; }
 
@@ -20,11 +23,16 @@ namespace SDL2_Engine {
 		 *		Name: Canvas
 		 *		Author: Mitchell Croft
 		 *		Created: 11/10/2017
-		 *		Modified: 11/11/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Provide a uniform interface for managing the navigation, operation and displaying 
 		 *		of UI elements
+		 *
+		 *		Notes:
+		 *		The locations of the interactive elements are indexed in a grid when the interaction
+		 *		map is rebuilt, and re-indexed when UI elements are moved, so finding the element under
+		 *		the mouse only tests the elements near it
 		**/
 		class SDL2_LIB_INC Canvas : public Utilities::IGlobal {
 		public:
@@ -93,12 +101,27 @@ namespace SDL2_Engine {
 			/*
 				Canvas : getActionObject - Get the currently active interactive object
 				Created: 11/11/2017
-				Modified: 11/11/2017
+				Modified: 16/10/2026
 
 				return IUIBase* - Returns a pointer to a IUIBase object or nullptr if no active object
 			*/
 			UIElements::IUIBase* getActionObject();
 
+			/*
+				Canvas : getActionObjectAt - Get the interactive object at a screen position
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pX - The X coordinate of the position
+				param[in] pY - The Y coordinate of the position
+
+				return IUIBase* - Returns a pointer to the first interactive object containing the position or nullptr if there is none
+
+				Note:
+				Only elements in the interaction map are found, so rebuildInteractionMap must be called after creating new elements
+			*/
+			UIElements::IUIBase* getActionObjectAt(const int& pX, const int& pY);
+
 			/*
 				Canvas : destroyUI - Destroy the first UI element with the specified tag
 				Created: 13/10/2017
@@ -181,7 +204,7 @@ namespace SDL2_Engine {
 			/*
 				Canvas : rebuildInteractionMap - Rebuild the internal interaction map to allow for users to navigate Actionable UI elements
 				Created: 13/10/2017
-				Modified: 02/11/2017
+				Modified: 16/10/2026
 			*/
 			void rebuildInteractionMap();
 
@@ -11,7 +11,7 @@ namespace SDL2_Engine {
 		 *		Name: CanvasInitialiser
 		 *		Author: Mitchell Croft
 		 *		Created: 13/10/2017
-		 *		Modified: 13/10/2017
+		 *		Modified: 16/10/2026
 		 *		
 		 *		Purpose:
 		 *		Store initialisation values for the Canvas object
@@ -21,21 +21,14 @@ namespace SDL2_Engine {
 			////////----------------------------------Navigation Axis------------------------------------////////
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			
-			union {
-				struct {
-					//! The name of the Virtual Axis to use for horizontal navigation (Default "horizontal")
-					Input::vAxisName horizontalAxis;
+			//! The name of the Virtual Axis to use for horizontal navigation (Default "horizontal")
+			Input::vAxisName horizontalAxis;
 
-					//! The name of the Virtual Axis to use for vertical navigation (Default "vertical")
-					Input::vAxisName verticalAxis;
+			//! The name of the Virtual Axis to use for vertical navigation (Default "vertical")
+			Input::vAxisName verticalAxis;
 
-					//! The name of the Virtual Axis to use for UI element confirmation (Default "confirm")
-					Input::vAxisName confirmAxis;
-				};
-
-				//! Provide access to the axis names as an array
-				Input::vAxisName axisArray[3];
-			};
+			//! The name of the Virtual Axis to use for UI element confirmation (Default "confirm")
+			Input::vAxisName confirmAxis;
 
 			/////////////////////////////////////////////////////////////////////////////////////////////////////
 			////////--------------------------------UI Setup Callbacks-----------------------------------////////
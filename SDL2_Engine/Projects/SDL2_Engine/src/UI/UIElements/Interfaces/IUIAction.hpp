@@ -11,7 +11,7 @@ namespace SDL2_Engine {
 			class IUIAction;
 
 			//! Export the required std::function implementation
-			template class SDL2_LIB_INC std::function<void(IUIAction*, void*)>;
+			SDL2_LIB_TEMPLATE(std::function<void(IUIAction*, void*)>);
 
 			//! Create a type define for UI Actions 
 			typedef std::function<void(IUIAction*, void*)> UIAction;
@@ -0,0 +1,31 @@
+#include "IUIBase.hpp"
+
+namespace SDL2_Engine {
+	namespace UI {
+		namespace UIElements {
+			//! Count the number of times UI elements have been moved
+			static unsigned int gLocationVersion = 0;
+
+			/*
+				IUIBase : setLocation - Set the location values for the UI element
+				Created: 13/10/2017
+				Modified: 16/10/2026
+
+				param[in] pLoc - A UIBounds object defining the new location
+			*/
+			void IUIBase::setLocation(const UIBounds& pLoc) {
+				mLocation = pLoc;
+				++gLocationVersion;
+			}
+
+			/*
+				IUIBase : locationVersion - Get a value that changes whenever any UI element is moved
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return unsigned int - Returns the number of calls made to setLocation
+			*/
+			unsigned int IUIBase::locationVersion() { return gLocationVersion; }
+		}
+	}
+}
@@ -11,7 +11,7 @@ namespace SDL2_Engine {
 			 *		Name: IUIBase
 			 *		Author: Mitchell Croft
 			 *		Created: 12/10/2017
-			 *		Modified: 13/10/2017
+			 *		Modified: 16/10/2026
 			 *		
 			 *		Purpose:
 			 *		Provide an interface for UI elements to implement from
@@ -116,11 +116,24 @@ namespace SDL2_Engine {
 				/*
 					IUIBase : setLocation - Set the location values for the UI element
 					Created: 13/10/2017
-					Modified: 13/10/2017
+					Modified: 16/10/2026
 
 					param[in] pLoc - A UIBounds object defining the new location
 				*/
-				inline void setLocation(const UIBounds& pLoc) { mLocation = pLoc; }
+				void setLocation(const UIBounds& pLoc);
+
+				/*
+					IUIBase : locationVersion - Get a value that changes whenever any UI element is moved
+					Created: 16/10/2026
+					Modified: 16/10/2026
+
+					return unsigned int - Returns the number of calls made to setLocation
+
+					NOTE:
+					This allows the Canvas to tell when the positions it has indexed are out of date
+					without checking each UI element
+				*/
+				static unsigned int locationVersion();
 
 				/*
 					IUIBase : isAlive - Get the alive flag of the current UI element
@@ -188,7 +188,7 @@ namespace SDL2_Engine {
 			/*
 				UIButton : render - Function to facilitate the the rendering of images once per cycle
 				Created: 14/10/2017
-				Modified: 14/10/2017
+				Modified: 16/10/2026
 			*/
 			void UIButton::render() {
 				//Get the renderer
@@ -200,8 +200,8 @@ namespace SDL2_Engine {
 				//Check there is text to render
 				if (!(mData->text.length() && mData->font)) return;
 
-				//Render the text
-				rend.drawText(mData->text.c_str(), mData->font, {mLocation.x + mLocation.w / 2, mLocation.y + mLocation.h / 2}, mData->textColour[(int)mState], Rendering::ETextAlignment::Center, mData->renderType);
+				//Render the text, button labels are static so keep the whole string cached
+				rend.drawText(mData->text.c_str(), mData->font, {mLocation.x + mLocation.w / 2, mLocation.y + mLocation.h / 2}, mData->textColour[(int)mState], Rendering::ETextAlignment::Center, mData->renderType, Rendering::ETextCacheMode::String);
 			}
 		}
 	}
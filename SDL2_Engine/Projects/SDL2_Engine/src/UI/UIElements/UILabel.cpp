@@ -152,7 +152,7 @@ namespace SDL2_Engine {
 			/*
 				UILabel : render - Function to facilitate the the rendering of images once per cycle
 				Created: 14/10/2017
-				Modified: 14/10/2017
+				Modified: 16/10/2026
 			*/
 			void UILabel::render() {
 				//Check there is a font and text to render
@@ -160,8 +160,8 @@ namespace SDL2_Engine {
 					//Get the renderer
 					Rendering::Renderer& rend = Globals::get<Rendering::Renderer>();
 
-					//Render the text
-					rend.drawText(mData->text.c_str(), mData->font, *(SDL_Point*)&mLocation, mData->colour, mData->alignment, mData->renderType);
+					//Render the text, labels are mostly static so keep the whole string cached
+					rend.drawText(mData->text.c_str(), mData->font, *(SDL_Point*)&mLocation, mData->colour, mData->alignment, mData->renderType, Rendering::ETextCacheMode::String);
 				}
 			}
 		}
@@ -244,7 +244,7 @@ namespace SDL2_Engine {
 			/*
 				UITextbox : render - Function to facilitate the the rendering of images once per cycle
 				Created: 15/10/2017
-				Modified: 15/10/2017
+				Modified: 16/10/2026
 			*/
 			void UITextbox::render() {
 				//Get the renderer
@@ -269,7 +269,7 @@ namespace SDL2_Engine {
 					tempCol.a >>= 1;
 
 					//Output the instructions
-					rend.drawText("Type Here...", mData->font, { mLocation.x + mLocation.w / 2, mLocation.y + mLocation.h / 2 }, tempCol, Rendering::ETextAlignment::Center, mData->renderType);
+					rend.drawText("Type Here...", mData->font, { mLocation.x + mLocation.w / 2, mLocation.y + mLocation.h / 2 }, tempCol, Rendering::ETextAlignment::Center, mData->renderType, Rendering::ETextCacheMode::String);
 				}
 			}
 		}
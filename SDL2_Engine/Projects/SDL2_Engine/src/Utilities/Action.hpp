@@ -21,10 +21,10 @@ namespace SDL2_Engine {
 			/*
 				Action (Default) : Constructor - Unused, inclusion is to provide user help on failed compile
 				Created: 13/07/2017
-				Modified: 13/07/2017
+				Modified: 16/10/2026
 			*/
 			inline Action() {
-				static_assert(false, "The Action object requires a template signature in the form of a function. E.g. Action<int(const char*, int, float)>");
+				static_assert(sizeof(T*) == 0, "The Action object requires a template signature in the form of a function. E.g. Action<int(const char*, int, float)>");
 			}
 		};
 
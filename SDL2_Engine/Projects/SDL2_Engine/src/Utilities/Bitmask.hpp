@@ -374,13 +374,13 @@ namespace SDL2_Engine {
 			/*
 				Bitmask : extractValues - Extract integral binary data from an indiscriminate number of values
 				Created: 18/07/2017
-				Modified: 18/07/2017
+				Modified: 16/10/2026
 
 				param[in] pFirst - The next value to be processed
 				param[in] pRest - A parameter pack of values left to process
 			*/
-			template<typename T, typename ... TArgs>
-			inline void extractValues(const T& pFirst, const TArgs& ... pRest) {
+			template<typename U, typename ... TArgs>
+			inline void extractValues(const U& pFirst, const TArgs& ... pRest) {
 				//Save the bit values store in the first value
 				mMask |= (baseType)pFirst;
 
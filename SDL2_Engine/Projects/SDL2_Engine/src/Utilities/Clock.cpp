@@ -0,0 +1,117 @@
+#include "Clock.hpp"
+
+//! Include the STL time values
+#include <chrono>
+#include <thread>
+
+namespace SDL2_Engine {
+	namespace Utilities {
+		/*
+			toTicks - Convert a number of seconds into nanosecond ticks
+			Author: Mitchell Croft
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeconds - The number of seconds to convert (Negative values are clamped to 0)
+
+			return clockTicks - Returns the number of ticks the seconds represent
+		*/
+		static inline clockTicks toTicks(const double& pSeconds) { return (pSeconds > 0.0 ? (clockTicks)(pSeconds * 1e9 + 0.5) : 0); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////------------------------------------------IClock-------------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			IClock : waitUntil - Block until the clock reaches a point in time
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pTime - The point in time to wait for
+			param[in] pSpinTicks - The number of ticks before the point in time to stop sleeping and spin for accuracy
+		*/
+		void IClock::waitUntil(const clockTicks& pTime, const clockTicks& pSpinTicks) {
+			//Get the ticks in a millisecond
+			const clockTicks MILLISECOND = frequency() / 1000;
+			clockTicks current = peek();
+
+			//Sleep while the point in time is far enough away for the scheduler to be trusted
+			while (MILLISECOND && current + pSpinTicks < pTime) {
+				const clockTicks SLEEP_MS = (pTime - current - pSpinTicks) / MILLISECOND;
+				if (!SLEEP_MS) break;
+				std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
+				current = peek();
+			}
+
+			//Spin for the remaining time
+			while (current < pTime) current = peek();
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////---------------------------------------SteadyClock-----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			SteadyClock : now - Read the current time of the steady clock
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return clockTicks - Returns the number of nanoseconds since the clocks epoch
+		*/
+		clockTicks SteadyClock::now() { return (clockTicks)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+		////////--------------------------------------VirtualClock-----------------------------------////////
+		/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+		/*
+			VirtualClock : Constructor - Initialise with default values
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStep - The number of seconds the clock advances after each reading (Default 0)
+		*/
+		VirtualClock::VirtualClock(const double& pStep /*= 0.0*/) : mTicks(0), mStepTicks(toTicks(pStep)) {}
+
+		/*
+			VirtualClock : now - Read the current time of the clock and apply the step
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			return clockTicks - Returns the number of nanoseconds the clock has been advanced by
+		*/
+		clockTicks VirtualClock::now() {
+			const clockTicks CURRENT = mTicks;
+			mTicks += mStepTicks;
+			return CURRENT;
+		}
+
+		/*
+			VirtualClock : waitUntil - Advance the clock to a point in time without blocking
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pTime - The point in time to advance the clock to (Earlier times are ignored)
+			param[in] pSpinTicks - Unused
+		*/
+		void VirtualClock::waitUntil(const clockTicks& pTime, const clockTicks& /*pSpinTicks*/) { if (pTime > mTicks) mTicks = pTime; }
+
+		/*
+			VirtualClock : advance - Move the clock forward by a number of seconds
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pSeconds - The number of seconds to advance the clock by (Negative values are ignored)
+		*/
+		void VirtualClock::advance(const double& pSeconds) { mTicks += toTicks(pSeconds); }
+
+		/*
+			VirtualClock : setStep - Set the number of seconds the clock advances after each reading
+			Created: 16/10/2026
+			Modified: 16/10/2026
+
+			param[in] pStep - The number of seconds to advance by (0 to only move when advanced manually)
+		*/
+		void VirtualClock::setStep(const double& pStep) { mStepTicks = toTicks(pStep); }
+	}
+}
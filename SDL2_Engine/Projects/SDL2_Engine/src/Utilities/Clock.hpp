@@ -0,0 +1,224 @@
+#pragma once
+
+//! Include the library management definitions
+#include "../__LibraryManagement.hpp"
+
+namespace SDL2_Engine {
+	namespace Utilities {
+		//! Define the type used to store clock readings
+		typedef unsigned long long clockTicks;
+
+		/*
+		 *		Name: IClock
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Abstract Interface for a monotonic source of time that the 
+		 *		Time object reads to calculate the passage of time
+		**/
+		class SDL2_LIB_INC IClock {
+		public:
+			/*
+				IClock : Destructor - Default virtual destructor
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			virtual ~IClock() {}
+
+			/*
+				IClock : now - Read the current time of the clock
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns the current time as a number of ticks from an arbitrary point
+			*/
+			virtual clockTicks now() = 0;
+
+			/*
+				IClock : frequency - Get the number of ticks that occur each second
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns the tick frequency of the clock
+			*/
+			virtual clockTicks frequency() const = 0;
+
+			/*
+				IClock : peek - Read the current time of the clock without any side effects
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns the current time as a number of ticks from an arbitrary point
+
+				NOTE:
+				Clocks that change when they are read should override this so that measuring
+				a frame doesn't alter the time that the Time object reads
+			*/
+			inline virtual clockTicks peek() { return now(); }
+
+			/*
+				IClock : waitUntil - Block until the clock reaches a point in time
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pTime - The point in time to wait for
+				param[in] pSpinTicks - The number of ticks before the point in time to stop sleeping and spin for accuracy
+			*/
+			virtual void waitUntil(const clockTicks& pTime, const clockTicks& pSpinTicks);
+
+			/*
+				IClock : toSeconds - Convert a number of clock ticks into seconds
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pTicks - The number of ticks to convert
+
+				return double - Returns the number of seconds the ticks represent
+			*/
+			inline double toSeconds(const clockTicks& pTicks) const { return (double)pTicks / (double)frequency(); }
+		};
+
+		/*
+		 *		Name: SteadyClock
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Read the time from the platforms monotonic high resolution 
+		 *		clock (std::chrono::steady_clock) in nanoseconds
+		**/
+		class SDL2_LIB_INC SteadyClock : public IClock {
+		public:
+			/*
+				SteadyClock : now - Read the current time of the steady clock
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns the number of nanoseconds since the clocks epoch
+			*/
+			clockTicks now() override;
+
+			/*
+				SteadyClock : frequency - Get the number of ticks that occur each second
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns 1,000,000,000
+			*/
+			inline clockTicks frequency() const override { return 1000000000ULL; }
+		};
+
+		/*
+		 *		Name: VirtualClock
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Provide a clock that only moves when it is told to, allowing 
+		 *		for deterministic timing in tests and headless simulations
+		 *
+		 *		Notes:
+		 *		If a step is set, the clock advances by the step after each 
+		 *		reading. As the Time object reads the clock once per update 
+		 *		this results in every update receiving a delta of the step
+		 *
+		 *		Waiting on the clock moves it straight to the requested time, 
+		 *		so a limited frame rate advances the clock a full frame each update
+		**/
+		class SDL2_LIB_INC VirtualClock : public IClock {
+		public:
+			/*
+				VirtualClock : Constructor - Initialise with default values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStep - The number of seconds the clock advances after each reading (Default 0)
+			*/
+			VirtualClock(const double& pStep = 0.0);
+
+			/*
+				VirtualClock : now - Read the current time of the clock and apply the step
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns the number of nanoseconds the clock has been advanced by
+			*/
+			clockTicks now() override;
+
+			/*
+				VirtualClock : frequency - Get the number of ticks that occur each second
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns 1,000,000,000
+			*/
+			inline clockTicks frequency() const override { return 1000000000ULL; }
+
+			/*
+				VirtualClock : peek - Read the current time of the clock without applying the step
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return clockTicks - Returns the number of nanoseconds the clock has been advanced by
+			*/
+			inline clockTicks peek() override { return mTicks; }
+
+			/*
+				VirtualClock : waitUntil - Advance the clock to a point in time without blocking
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pTime - The point in time to advance the clock to (Earlier times are ignored)
+				param[in] pSpinTicks - Unused
+			*/
+			void waitUntil(const clockTicks& pTime, const clockTicks& /*pSpinTicks*/) override;
+
+			/*
+				VirtualClock : advance - Move the clock forward by a number of seconds
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pSeconds - The number of seconds to advance the clock by (Negative values are ignored)
+			*/
+			void advance(const double& pSeconds);
+
+			/*
+				VirtualClock : advanceTicks - Move the clock forward by a number of ticks
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pTicks - The number of ticks to advance the clock by
+			*/
+			inline void advanceTicks(const clockTicks& pTicks) { mTicks += pTicks; }
+
+			/*
+				VirtualClock : setStep - Set the number of seconds the clock advances after each reading
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pStep - The number of seconds to advance by (0 to only move when advanced manually)
+			*/
+			void setStep(const double& pStep);
+
+			/*
+				VirtualClock : getTicks - Get the current time of the clock without applying the step
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return const clockTicks& - Returns a constant reference to the current tick count
+			*/
+			inline const clockTicks& getTicks() const { return mTicks; }
+
+		private:
+			//! Store the current time of the clock
+			clockTicks mTicks;
+
+			//! Store the number of ticks to advance after each reading
+			clockTicks mStepTicks;
+		};
+	}
+}
@@ -1,5 +1,8 @@
 #include "DebugCallback.hpp"
 
+//! Include the bounds checked runtime functions on all platforms
+#include "Portability.hpp"
+
 #include <stdio.h>
 #include <stdarg.h>
 
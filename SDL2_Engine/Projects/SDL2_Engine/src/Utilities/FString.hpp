@@ -5,6 +5,9 @@
 #include <cstring>
 #include <string.h>
 
+//! Include the bounds checked runtime functions on all platforms
+#include "Portability.hpp"
+
 namespace SDL2_Engine {
 	namespace Utilities {
 		/*
@@ -0,0 +1,130 @@
+#pragma once
+
+/*
+ *		Name: Portability
+ *		Author: Mitchell Croft
+ *		Created: 16/10/2026
+ *		Modified: 16/10/2026
+ *
+ *		Purpose:
+ *		Provide the bounds checked C runtime functions used throughout the engine
+ *		on platforms whose runtime does not supply them
+ *
+ *		Notes:
+ *		On Windows this header includes nothing extra and the runtime versions are used.
+ *		Elsewhere each function is implemented in terms of its standard counterpart, with
+ *		the same argument order as the Microsoft version so call sites are unchanged
+**/
+
+#ifndef _WIN32
+
+//! Include the standard runtime functions being wrapped
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <cstdarg>
+#include <ctime>
+#include <cerrno>
+
+//! Define the error type returned by the bounds checked functions
+typedef int errno_t;
+
+/*
+	memcpy_s - Copy a block of memory, refusing to write past the end of the destination
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	param[in] pDest - The memory to copy the data to
+	param[in] pDestSize - The size of the destination in bytes
+	param[in] pSrc - The memory to copy the data from
+	param[in] pCount - The number of bytes to copy
+
+	return errno_t - Returns 0 on success, or ERANGE if the destination is too small
+*/
+inline errno_t memcpy_s(void* pDest, const size_t pDestSize, const void* pSrc, const size_t pCount) {
+	//Check the copy fits in the destination
+	if (pCount > pDestSize) return ERANGE;
+
+	//Copy the data
+	memcpy(pDest, pSrc, pCount);
+	return 0;
+}
+
+/*
+	fopen_s - Open a file, storing the resulting handle in the supplied pointer
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	param[out] pFile - A pointer to the FILE handle to be set (nullptr on failure)
+	param[in] pPath - The path of the file to open
+	param[in] pMode - The mode string to open the file with
+
+	return errno_t - Returns 0 on success, or the errno value describing the failure
+*/
+inline errno_t fopen_s(FILE** pFile, const char* pPath, const char* pMode) {
+	*pFile = fopen(pPath, pMode);
+	return (*pFile ? 0 : errno);
+}
+
+/*
+	strerror_s - Copy the description of an error number into a character buffer
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	Template N - The length of the buffer in characters
+
+	param[in/out] pBuffer - The buffer to fill with the description
+	param[in] pError - The error number to describe
+
+	return errno_t - Returns 0
+*/
+template<size_t N>
+inline errno_t strerror_s(char(&pBuffer)[N], const int pError) {
+	//Copy as much of the description as will fit
+	strncpy(pBuffer, strerror(pError), N - 1);
+
+	//Null terminate the buffer
+	pBuffer[N - 1] = '\0';
+	return 0;
+}
+
+/*
+	localtime_s - Convert a time value into the local calendar time
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	param[out] pResult - The tm structure to fill
+	param[in] pTime - The time value to convert
+
+	return errno_t - Returns 0 on success, or EINVAL if the conversion failed
+*/
+inline errno_t localtime_s(std::tm* pResult, const std::time_t* pTime) {
+	return (localtime_r(pTime, pResult) ? 0 : EINVAL);
+}
+
+/*
+	vswprintf_s - Write formatted wide character output to a buffer
+	Author: Mitchell Croft
+	Created: 16/10/2026
+	Modified: 16/10/2026
+
+	param[in/out] pBuffer - The buffer to write the output to
+	param[in] pCount - The number of characters that can be stored in the buffer
+	param[in] pFormat - The format string for the output
+	param[in] pArgs - The arguments to be used by the format string
+
+	return int - Returns the number of characters written, or a negative value on error
+*/
+inline int vswprintf_s(wchar_t* pBuffer, const size_t pCount, const wchar_t* pFormat, va_list pArgs) {
+	return vswprintf(pBuffer, pCount, pFormat, pArgs);
+}
+
+//! The scanned values used by the engine are all numeric, so no buffer sizes are passed
+#define sscanf_s sscanf
+
+#endif
@@ -0,0 +1,201 @@
+#pragma once
+
+//! Include the library management definitions
+#include "../__LibraryManagement.hpp"
+
+//! Include the fixed width and size types
+#include <cstdint>
+#include <cstddef>
+
+namespace SDL2_Engine {
+	namespace Utilities {
+		/*
+		 *		Name: Random
+		 *		Author: Mitchell Croft
+		 *		Created: 16/10/2026
+		 *		Modified: 16/10/2026
+		 *
+		 *		Purpose:
+		 *		Provide a small, seedable pseudo-random number generator that is
+		 *		owned by the object drawing values from it, allowing a sequence of
+		 *		draws to be reproduced from a seed
+		 *
+		 *		Notes:
+		 *		The generator is xoshiro256**, with the state expanded from seeds using
+		 *		splitmix64. Each object is an independent stream, so separate threads
+		 *		should each own their own Random object. Independent streams can be
+		 *		created from a seed and stream index, or by splitting an existing object.
+		 *
+		 *		The object satisfies the UniformRandomBitGenerator requirements so that
+		 *		it can be used with the STL distributions and algorithms
+		**/
+		class Random {
+		public:
+			//! Define the type of the values that are generated
+			typedef uint64_t result_type;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////---------------------------------------Construction----------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			/*
+				Random : Constructor - Initialise with a seed value
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pSeed - The seed to initialise the generator with (Default 0)
+				param[in] pStream - The index of the stream to derive from the seed (Default 0)
+			*/
+			inline Random(const uint64_t& pSeed = 0, const uint64_t& pStream = 0) { seed(pSeed, pStream); }
+
+			/*
+				Random : seed - Reset the generator to the start of the sequence for a seed
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pSeed - The seed to initialise the generator with
+				param[in] pStream - The index of the stream to derive from the seed (Default 0)
+
+				NOTE:
+				Different stream indices for the same seed produce unrelated sequences, allowing
+				numbered tasks (e.g. generation attempts) to draw values independently
+			*/
+			inline void seed(const uint64_t& pSeed, const uint64_t& pStream = 0) {
+				//Combine the seed and the hashed stream into the splitmix state
+				uint64_t stream = pStream;
+				uint64_t mix = pSeed ^ splitMix(stream);
+
+				//Expand the state
+				for (size_t i = 0; i < 4; i++)
+					mState[i] = splitMix(mix);
+			}
+
+			/*
+				Random : split - Create a new generator with a stream independent of this one
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return Random - Returns a Random object that continues this sequence
+
+				NOTE:
+				This generator is advanced 2^128 values, so the returned object and this one
+				won't overlap in any practical number of draws
+			*/
+			inline Random split() {
+				Random child = *this;
+				jump();
+				return child;
+			}
+
+			/*
+				Random : jump - Advance the generator the equivalent of 2^128 values
+				Created: 16/10/2026
+				Modified: 16/10/2026
+			*/
+			inline void jump() {
+				//Store the jump polynomial
+				static const uint64_t JUMP[4] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+
+				//Accumulate the states selected by the polynomial
+				uint64_t state[4] = { 0, 0, 0, 0 };
+				for (size_t i = 0; i < 4; i++) {
+					for (size_t b = 0; b < 64; b++) {
+						if (JUMP[i] & (1ULL << b)) {
+							for (size_t s = 0; s < 4; s++)
+								state[s] ^= mState[s];
+						}
+						next();
+					}
+				}
+
+				//Assign the new state
+				for (size_t s = 0; s < 4; s++)
+					mState[s] = state[s];
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////------------------------------------------Values-------------------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			/*
+				Random : next - Get the next value in the sequence
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return uint64_t - Returns a value uniformly distributed across the full 64 bit range
+			*/
+			inline uint64_t next() {
+				const uint64_t RESULT = rotate(mState[1] * 5, 7) * 9;
+				const uint64_t TEMP = mState[1] << 17;
+
+				mState[2] ^= mState[0];
+				mState[3] ^= mState[1];
+				mState[1] ^= mState[2];
+				mState[0] ^= mState[3];
+
+				mState[2] ^= TEMP;
+				mState[3] = rotate(mState[3], 45);
+
+				return RESULT;
+			}
+
+			/*
+				Random : nextFloat - Get a float value in the scale of 0 - 1 (exclusive)
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				return float - Returns a value in the range [0, 1)
+			*/
+			inline float nextFloat() { return (float)(next() >> 40) * (1.f / 16777216.f); }
+
+			/*
+				Random : range - Get an unbiased integral value below a limit
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pCount - The number of values that can be returned (Must be greater than 0)
+
+				return uint64_t - Returns a value in the range [0, pCount)
+			*/
+			inline uint64_t range(const uint64_t& pCount) {
+				//Reject the values that would bias the result towards the low end
+				const uint64_t THRESHOLD = (0 - pCount) % pCount;
+				uint64_t value;
+				do value = next();
+				while (value < THRESHOLD);
+				return value % pCount;
+			}
+
+			/*
+				Random : chance - Check a random draw against a probability
+				Created: 16/10/2026
+				Modified: 16/10/2026
+
+				param[in] pChance - The probability of returning true, in the scale of 0 - 1
+
+				return bool - Returns true with the specified probability
+			*/
+			inline bool chance(const float& pChance) { return nextFloat() < pChance; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			////////----------------------------------Generator Requirements-----------------------------////////
+			/////////////////////////////////////////////////////////////////////////////////////////////////////
+			inline static constexpr result_type (min)() { return 0; }
+			inline static constexpr result_type (max)() { return UINT64_MAX; }
+			inline result_type operator()() { return next(); }
+
+		private:
+			//! Store the state of the generator
+			uint64_t mState[4];
+
+			//! Rotate the bits of a value to the left
+			inline static uint64_t rotate(const uint64_t& pValue, const int& pBits) { return (pValue << pBits) | (pValue >> (64 - pBits)); }
+
+			//! Advance a splitmix64 state and return the next value
+			inline static uint64_t splitMix(uint64_t& pState) {
+				uint64_t z = (pState += 0x9e3779b97f4a7c15ULL);
+				z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+				z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+				return z ^ (z >> 31);
+			}
+		};
+	}
+}
@@ -3,24 +3,30 @@
 //! Get information on types used
 #include <typeinfo>
 
+//! Include the standard size type
+#include <cstddef>
+
 namespace SDL2_Engine {
 	namespace Utilities {
 		//! Define the type used to identify the separate interfaces
 		typedef size_t typeID;
 
+		//! Wrap a type so that prototyped (incomplete) types can still be identified
+		template<typename T> struct TypeTag {};
+
 		/*
 			typeToID - Convert a template type value into a unique hash code
 			Created: 19/07/2017
-			Modified: 11/10/2017
+			Modified: 16/10/2026
 
-			Template T - A generic, non-void type
+			Template T - A generic type, which may be incomplete
 
 			return typeID - Returns the ID as typeID value
 		*/
 		template<typename T>
 		inline typeID typeToID() {
 			//Get the type information
-			const std::type_info& type = typeid(T);
+			const std::type_info& type = typeid(TypeTag<T>);
 
 			//Return the hash code
 			return type.hash_code();
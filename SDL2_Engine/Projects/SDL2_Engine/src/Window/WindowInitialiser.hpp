@@ -12,10 +12,10 @@
 namespace SDL2_Engine {
 	namespace Initialisation {
 		//! Export the required FString implementation
-		template class SDL2_LIB_INC Utilities::FString<FILENAME_MAX>;
+		SDL2_LIB_TEMPLATE(Utilities::FString<FILENAME_MAX>);
 
 		//! Export the required Bitmask implementation
-		template class SDL2_LIB_INC Utilities::Bitmask<EWindowProperties>;
+		SDL2_LIB_TEMPLATE(Utilities::Bitmask<EWindowProperties>);
 
 		/*
 		 *		Name: WindowInitialiser
@@ -1,14 +1,35 @@
 #pragma once
 
+//! Include the standard size type used throughout the library interface
+#include <cstddef>
+
+//! Remove previously defined values for the library include macro
+#ifdef SDL2_LIB_INC
+	#undef SDL2_LIB_INC
+#endif
+
 //! Specify the method of inclusion used when handling the library
-#ifdef _BUILD_SDL2_ENGINE_LIB_
-		//! Remove previously defined values for the library include macro
-		#ifdef SDL2_LIB_INC
-			#undef SDL2_LIB_INC
-		#endif
-	#define SDL2_LIB_INC __declspec(dllexport)
+#ifdef _WIN32
+	#ifdef _BUILD_SDL2_ENGINE_LIB_
+		#define SDL2_LIB_INC __declspec(dllexport)
+	#else
+		#define SDL2_LIB_INC __declspec(dllimport)
+	#endif
+#else
+	//! Shared objects export symbols with default visibility
+	#define SDL2_LIB_INC __attribute__((visibility("default")))
+#endif
+
+//! Remove previously defined values for the template export macro
+#ifdef SDL2_LIB_TEMPLATE
+	#undef SDL2_LIB_TEMPLATE
+#endif
+
+//! Explicitly instantiate exported template types, which is only required across a DLL boundary
+#ifdef _WIN32
+	#define SDL2_LIB_TEMPLATE(...) template class SDL2_LIB_INC __VA_ARGS__
 #else
-	#define SDL2_LIB_INC __declspec(dllimport)
+	#define SDL2_LIB_TEMPLATE(...) static_assert(true, "Template export is not required")
 #endif
 
 //! Identify the version of the SDL2_Engine that is in use